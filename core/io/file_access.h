@@ -193,6 +193,9 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	// Returns the next p_length bytes without copying them and advances past them. The view is valid until the file is closed.
+	// If the file can't provide a view, or fewer than p_length bytes are left, returns an empty span without moving; use get_buffer() then.
+	virtual Span<uint8_t> get_buffer_view(uint64_t p_length) const { return Span<uint8_t>(); }
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
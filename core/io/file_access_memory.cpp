@@ -143,6 +143,18 @@ uint64_t FileAccessMemory::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+Span<uint8_t> FileAccessMemory::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_NULL_V(data, Span<uint8_t>());
+
+	if (p_length == 0 || p_length > length - pos) {
+		return Span<uint8_t>();
+	}
+
+	Span<uint8_t> view(&data[pos], p_length);
+	pos += p_length;
+	return view;
+}
+
 Error FileAccessMemory::get_error() const {
 	return pos >= length ? ERR_FILE_EOF : OK;
 }
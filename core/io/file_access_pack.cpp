@@ -493,6 +493,21 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return to_read;
 }
 
+Span<uint8_t> FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), Span<uint8_t>(), "File must be opened before use.");
+
+	if (eof || p_length > pf.size - pos) {
+		return Span<uint8_t>();
+	}
+
+	// The pack file is kept positioned at `off + pos`, so this views the same bytes get_buffer() would read.
+	Span<uint8_t> view = f->get_buffer_view(p_length);
+	if (view.size() == p_length) {
+		pos += p_length;
+	}
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
@@ -215,6 +215,7 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> get_buffer_view(uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
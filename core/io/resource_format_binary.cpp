@@ -96,11 +96,22 @@ enum {
 	// Version 4: New string ID for ext/subresources, breaks forward compat.
 	// Version 5: Ability to store script class in the header.
 	// Version 6: Added PackedVector4Array Variant type.
-	FORMAT_VERSION = 6,
+	// Version 7: Packed arrays of fixed-size elements start on a PACKED_ARRAY_ALIGNMENT boundary.
+	FORMAT_VERSION = 7,
 	FORMAT_VERSION_CAN_RENAME_DEPS = 1,
 	FORMAT_VERSION_NO_NODEPATH_PROPERTY = 3,
+	FORMAT_VERSION_ALIGNED_PACKED_ARRAYS = 7,
+	PACKED_ARRAY_ALIGNMENT = 16,
 };
 
+static inline bool is_native_endian(const Ref<FileAccess> &f) {
+#ifdef BIG_ENDIAN_ENABLED
+	return f->is_big_endian();
+#else
+	return !f->is_big_endian();
+#endif
+}
+
 void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	uint32_t extra = 4 - (p_len % 4);
 	if (extra < 4) {
@@ -110,11 +121,60 @@ void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	}
 }
 
+Error ResourceLoaderBinary::_advance_block_padding() {
+	if (ver_format < FORMAT_VERSION_ALIGNED_PACKED_ARRAYS) {
+		return OK;
+	}
+	uint32_t pad = f->get_32();
+	ERR_FAIL_COND_V(pad >= PACKED_ARRAY_ALIGNMENT, ERR_FILE_CORRUPT);
+	if (pad > 0) {
+		f->seek(f->get_position() + pad);
+	}
+	return OK;
+}
+
+// Copies packed array data straight out of the file mapping when the file provides one.
+static void read_block(uint8_t *dst, Ref<FileAccess> &f, uint64_t size) {
+	Span<uint8_t> view = f->get_buffer_view(size);
+	if (view.size() == size) {
+		memcpy(dst, view.ptr(), size);
+		return;
+	}
+	f->get_buffer(dst, size);
+}
+
+// Math types are read in one call when the file matches the memory layout, rather than one call per component.
+static void read_real_fields(real_t *dst, Ref<FileAccess> &f, uint32_t count) {
+	if (is_native_endian(f) && f->real_is_double == (sizeof(real_t) == 8)) {
+		f->get_buffer((uint8_t *)dst, count * sizeof(real_t));
+		return;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		dst[i] = f->get_real();
+	}
+}
+
+template <typename T>
+static void read_32_fields(T *dst, Ref<FileAccess> &f, uint32_t count) {
+	static_assert(sizeof(T) == 4);
+	if (is_native_endian(f)) {
+		f->get_buffer((uint8_t *)dst, count * sizeof(T));
+		return;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		if constexpr (std::is_same_v<T, float>) {
+			dst[i] = f->get_float();
+		} else {
+			dst[i] = f->get_32();
+		}
+	}
+}
+
 static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	if (f->real_is_double) {
 		if constexpr (sizeof(real_t) == 8) {
 			// Ideal case with double-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(double));
+			read_block((uint8_t *)dst, f, count * sizeof(double));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint64_t *dst = (uint64_t *)dst;
@@ -134,7 +194,7 @@ static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	} else {
 		if constexpr (sizeof(real_t) == 4) {
 			// Ideal case with float-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(float));
+			read_block((uint8_t *)dst, f, count * sizeof(float));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *dst = (uint32_t *)dst;
@@ -164,6 +224,10 @@ StringName ResourceLoaderBinary::_get_string() {
 		if (len == 0) {
 			return StringName();
 		}
+		Span<uint8_t> view = f->get_buffer_view(len);
+		if (view.size() == len) {
+			return String::utf8((const char *)view.ptr(), len);
+		}
 		f->get_buffer((uint8_t *)&str_buf[0], len);
 		return String::utf8(&str_buf[0], len);
 	}
@@ -199,161 +263,106 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_VECTOR2: {
 			Vector2 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
+			static_assert(sizeof(Vector2) == 2 * sizeof(real_t));
+			read_real_fields(reinterpret_cast<real_t *>(&v), f, 2);
 			r_v = v;
 
 		} break;
 		case VARIANT_VECTOR2I: {
 			Vector2i v;
-			v.x = f->get_32();
-			v.y = f->get_32();
+			static_assert(sizeof(Vector2i) == 2 * sizeof(int32_t));
+			read_32_fields(reinterpret_cast<int32_t *>(&v), f, 2);
 			r_v = v;
 
 		} break;
 		case VARIANT_RECT2: {
 			Rect2 v;
-			v.position.x = f->get_real();
-			v.position.y = f->get_real();
-			v.size.x = f->get_real();
-			v.size.y = f->get_real();
+			static_assert(sizeof(Rect2) == 4 * sizeof(real_t));
+			read_real_fields(reinterpret_cast<real_t *>(&v), f, 4);
 			r_v = v;
 
 		} break;
 		case VARIANT_RECT2I: {
 			Rect2i v;
-			v.position.x = f->get_32();
-			v.position.y = f->get_32();
-			v.size.x = f->get_32();
-			v.size.y = f->get_32();
+			static_assert(sizeof(Rect2i) == 4 * sizeof(int32_t));
+			read_32_fields(reinterpret_cast<int32_t *>(&v), f, 4);
 			r_v = v;
 
 		} break;
 		case VARIANT_VECTOR3: {
 			Vector3 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
+			static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
+			read_real_fields(reinterpret_cast<real_t *>(&v), f, 3);
 			r_v = v;
 		} break;
 		case VARIANT_VECTOR3I: {
 			Vector3i v;
-			v.x = f->get_32();
-			v.y = f->get_32();
-			v.z = f->get_32();
+			static_assert(sizeof(Vector3i) == 3 * sizeof(int32_t));
+			read_32_fields(reinterpret_cast<int32_t *>(&v), f, 3);
 			r_v = v;
 		} break;
 		case VARIANT_VECTOR4: {
 			Vector4 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
-			v.w = f->get_real();
+			static_assert(sizeof(Vector4) == 4 * sizeof(real_t));
+			read_real_fields(reinterpret_cast<real_t *>(&v), f, 4);
 			r_v = v;
 		} break;
 		case VARIANT_VECTOR4I: {
 			Vector4i v;
-			v.x = f->get_32();
-			v.y = f->get_32();
-			v.z = f->get_32();
-			v.w = f->get_32();
+			static_assert(sizeof(Vector4i) == 4 * sizeof(int32_t));
+			read_32_fields(reinterpret_cast<int32_t *>(&v), f, 4);
 			r_v = v;
 		} break;
 		case VARIANT_PLANE: {
 			Plane v;
-			v.normal.x = f->get_real();
-			v.normal.y = f->get_real();
-			v.normal.z = f->get_real();
-			v.d = f->get_real();
+			static_assert(sizeof(Plane) == 4 * sizeof(real_t));
+			read_real_fields(reinterpret_cast<real_t *>(&v), f, 4);
 			r_v = v;
 		} break;
 		case VARIANT_QUATERNION: {
 			Quaternion v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
-			v.w = f->get_real();
+			static_assert(sizeof(Quaternion) == 4 * sizeof(real_t));
+			read_real_fields(reinterpret_cast<real_t *>(&v), f, 4);
 			r_v = v;
 
 		} break;
 		case VARIANT_AABB: {
 			AABB v;
-			v.position.x = f->get_real();
-			v.position.y = f->get_real();
-			v.position.z = f->get_real();
-			v.size.x = f->get_real();
-			v.size.y = f->get_real();
-			v.size.z = f->get_real();
+			static_assert(sizeof(AABB) == 6 * sizeof(real_t));
+			read_real_fields(reinterpret_cast<real_t *>(&v), f, 6);
 			r_v = v;
 
 		} break;
 		case VARIANT_TRANSFORM2D: {
 			Transform2D v;
-			v.columns[0].x = f->get_real();
-			v.columns[0].y = f->get_real();
-			v.columns[1].x = f->get_real();
-			v.columns[1].y = f->get_real();
-			v.columns[2].x = f->get_real();
-			v.columns[2].y = f->get_real();
+			static_assert(sizeof(Transform2D) == 6 * sizeof(real_t));
+			read_real_fields(reinterpret_cast<real_t *>(&v), f, 6);
 			r_v = v;
 
 		} break;
 		case VARIANT_BASIS: {
 			Basis v;
-			v.rows[0].x = f->get_real();
-			v.rows[0].y = f->get_real();
-			v.rows[0].z = f->get_real();
-			v.rows[1].x = f->get_real();
-			v.rows[1].y = f->get_real();
-			v.rows[1].z = f->get_real();
-			v.rows[2].x = f->get_real();
-			v.rows[2].y = f->get_real();
-			v.rows[2].z = f->get_real();
+			static_assert(sizeof(Basis) == 9 * sizeof(real_t));
+			read_real_fields(reinterpret_cast<real_t *>(&v), f, 9);
 			r_v = v;
 
 		} break;
 		case VARIANT_TRANSFORM3D: {
 			Transform3D v;
-			v.basis.rows[0].x = f->get_real();
-			v.basis.rows[0].y = f->get_real();
-			v.basis.rows[0].z = f->get_real();
-			v.basis.rows[1].x = f->get_real();
-			v.basis.rows[1].y = f->get_real();
-			v.basis.rows[1].z = f->get_real();
-			v.basis.rows[2].x = f->get_real();
-			v.basis.rows[2].y = f->get_real();
-			v.basis.rows[2].z = f->get_real();
-			v.origin.x = f->get_real();
-			v.origin.y = f->get_real();
-			v.origin.z = f->get_real();
+			static_assert(sizeof(Transform3D) == 12 * sizeof(real_t));
+			read_real_fields(reinterpret_cast<real_t *>(&v), f, 12);
 			r_v = v;
 		} break;
 		case VARIANT_PROJECTION: {
 			Projection v;
-			v.columns[0].x = f->get_real();
-			v.columns[0].y = f->get_real();
-			v.columns[0].z = f->get_real();
-			v.columns[0].w = f->get_real();
-			v.columns[1].x = f->get_real();
-			v.columns[1].y = f->get_real();
-			v.columns[1].z = f->get_real();
-			v.columns[1].w = f->get_real();
-			v.columns[2].x = f->get_real();
-			v.columns[2].y = f->get_real();
-			v.columns[2].z = f->get_real();
-			v.columns[2].w = f->get_real();
-			v.columns[3].x = f->get_real();
-			v.columns[3].y = f->get_real();
-			v.columns[3].z = f->get_real();
-			v.columns[3].w = f->get_real();
+			static_assert(sizeof(Projection) == 16 * sizeof(real_t));
+			read_real_fields(reinterpret_cast<real_t *>(&v), f, 16);
 			r_v = v;
 		} break;
 		case VARIANT_COLOR: {
 			Color v; // Colors should always be in single-precision.
-			v.r = f->get_float();
-			v.g = f->get_float();
-			v.b = f->get_float();
-			v.a = f->get_float();
+			static_assert(sizeof(Color) == 4 * sizeof(float));
+			read_32_fields(reinterpret_cast<float *>(&v), f, 4);
 			r_v = v;
 
 		} break;
@@ -521,11 +530,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_INT32_ARRAY: {
 			uint32_t len = f->get_32();
+			Error pad_err = _advance_block_padding();
+			ERR_FAIL_COND_V(pad_err != OK, pad_err);
 
 			Vector<int32_t> array;
 			array.resize(len);
 			int32_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
+			read_block((uint8_t *)w, f, len * sizeof(int32_t));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -540,11 +551,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_INT64_ARRAY: {
 			uint32_t len = f->get_32();
+			Error pad_err = _advance_block_padding();
+			ERR_FAIL_COND_V(pad_err != OK, pad_err);
 
 			Vector<int64_t> array;
 			array.resize(len);
 			int64_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
+			read_block((uint8_t *)w, f, len * sizeof(int64_t));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint64_t *ptr = (uint64_t *)w.ptr();
@@ -559,11 +572,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_FLOAT32_ARRAY: {
 			uint32_t len = f->get_32();
+			Error pad_err = _advance_block_padding();
+			ERR_FAIL_COND_V(pad_err != OK, pad_err);
 
 			Vector<float> array;
 			array.resize(len);
 			float *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(float));
+			read_block((uint8_t *)w, f, len * sizeof(float));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -578,11 +593,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_FLOAT64_ARRAY: {
 			uint32_t len = f->get_32();
+			Error pad_err = _advance_block_padding();
+			ERR_FAIL_COND_V(pad_err != OK, pad_err);
 
 			Vector<double> array;
 			array.resize(len);
 			double *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(double));
+			read_block((uint8_t *)w, f, len * sizeof(double));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint64_t *ptr = (uint64_t *)w.ptr();
@@ -609,6 +626,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_VECTOR2_ARRAY: {
 			uint32_t len = f->get_32();
+			Error pad_err = _advance_block_padding();
+			ERR_FAIL_COND_V(pad_err != OK, pad_err);
 
 			Vector<Vector2> array;
 			array.resize(len);
@@ -622,6 +641,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_VECTOR3_ARRAY: {
 			uint32_t len = f->get_32();
+			Error pad_err = _advance_block_padding();
+			ERR_FAIL_COND_V(pad_err != OK, pad_err);
 
 			Vector<Vector3> array;
 			array.resize(len);
@@ -635,13 +656,15 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_COLOR_ARRAY: {
 			uint32_t len = f->get_32();
+			Error pad_err = _advance_block_padding();
+			ERR_FAIL_COND_V(pad_err != OK, pad_err);
 
 			Vector<Color> array;
 			array.resize(len);
 			Color *w = array.ptrw();
 			// Colors always use `float` even with double-precision support enabled
 			static_assert(sizeof(Color) == 4 * sizeof(float));
-			f->get_buffer((uint8_t *)w, len * sizeof(float) * 4);
+			read_block((uint8_t *)w, f, len * sizeof(float) * 4);
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -656,6 +679,8 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PACKED_VECTOR4_ARRAY: {
 			uint32_t len = f->get_32();
+			Error pad_err = _advance_block_padding();
+			ERR_FAIL_COND_V(pad_err != OK, pad_err);
 
 			Vector<Vector4> array;
 			array.resize(len);
@@ -930,6 +955,10 @@ String ResourceLoaderBinary::get_unicode_string() {
 	if (len == 0) {
 		return String();
 	}
+	Span<uint8_t> view = f->get_buffer_view(len);
+	if (view.size() == (uint64_t)len) {
+		return String::utf8((const char *)view.ptr(), len);
+	}
 	f->get_buffer((uint8_t *)&str_buf[0], len);
 	return String::utf8(&str_buf[0], len);
 }
@@ -1622,6 +1651,15 @@ void ResourceFormatSaverBinaryInstance::_pad_buffer(Ref<FileAccess> f, int p_byt
 	}
 }
 
+void ResourceFormatSaverBinaryInstance::_pad_block(Ref<FileAccess> f) {
+	// The pad count itself takes 4 bytes, the data starts right after the padding.
+	uint32_t pad = (PACKED_ARRAY_ALIGNMENT - ((f->get_position() + 4) % PACKED_ARRAY_ALIGNMENT)) % PACKED_ARRAY_ALIGNMENT;
+	f->store_32(pad);
+	for (uint32_t i = 0; i < pad; i++) {
+		f->store_8(0);
+	}
+}
+
 void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const Variant &p_property, HashMap<Ref<Resource>, int> &resource_map, HashMap<Ref<Resource>, int> &external_resources, HashMap<StringName, int> &string_map, const PropertyInfo &p_hint) {
 	switch (p_property.get_type()) {
 		case Variant::NIL: {
@@ -1936,6 +1974,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<int32_t> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_block(f);
 			const int32_t *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_32(uint32_t(r[i]));
@@ -1947,6 +1986,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<int64_t> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_block(f);
 			const int64_t *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_64(uint64_t(r[i]));
@@ -1958,6 +1998,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<float> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_block(f);
 			const float *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_float(r[i]);
@@ -1969,6 +2010,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<double> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_block(f);
 			const double *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_double(r[i]);
@@ -1991,6 +2033,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Vector2> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_block(f);
 			const Vector2 *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_real(r[i].x);
@@ -2003,6 +2046,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Vector3> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_block(f);
 			const Vector3 *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_real(r[i].x);
@@ -2016,6 +2060,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Color> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_block(f);
 			const Color *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_float(r[i].r);
@@ -2030,6 +2075,7 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			Vector<Vector4> arr = p_property;
 			int len = arr.size();
 			f->store_32(uint32_t(len));
+			_pad_block(f);
 			const Vector4 *r = arr.ptr();
 			for (int i = 0; i < len; i++) {
 				f->store_real(r[i].x);
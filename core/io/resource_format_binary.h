@@ -80,6 +80,7 @@ class ResourceLoaderBinary {
 
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
+	Error _advance_block_padding();
 
 	HashMap<String, String> remaps;
 	Error error = OK;
@@ -160,6 +161,7 @@ class ResourceFormatSaverBinaryInstance {
 	};
 
 	static void _pad_buffer(Ref<FileAccess> f, int p_bytes);
+	static void _pad_block(Ref<FileAccess> f);
 	void _find_resources(const Variant &p_variant, bool p_main = false);
 	static void save_unicode_string(Ref<FileAccess> f, const String &p_string, bool p_bit_on_len = false);
 	int get_string_index(const String &p_string);
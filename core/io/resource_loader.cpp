@@ -474,6 +474,230 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 	curr_load_task = curr_load_task_backup;
 }
 
+struct ResourceLoader::DependencyGraph {
+	struct Vertex {
+		String local_path;
+		String type_hint;
+		LocalVector<uint32_t> dependencies;
+		LocalVector<uint32_t> dependents;
+		uint32_t pending_dependencies = 0;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+		Ref<Resource> resource; // Kept alive until the root has been loaded.
+		uint64_t load_usec = 0;
+		DependencyGraph *graph = nullptr;
+	};
+
+	ThreadLoadTask *root_task = nullptr;
+	LocalVector<Vertex> vertices; // The root is always the first one.
+	LocalVector<uint32_t> order; // Dependencies before their dependents.
+	BinaryMutex mutex;
+	uint64_t scan_usec = 0;
+	uint64_t load_usec = 0;
+};
+
+bool ResourceLoader::_build_dependency_graph(DependencyGraph &r_graph) {
+	HashMap<String, uint32_t> indices;
+	r_graph.vertices.resize(1);
+	r_graph.vertices[0].local_path = r_graph.root_task->local_path;
+	r_graph.vertices[0].type_hint = r_graph.root_task->type_hint;
+	indices[r_graph.root_task->local_path] = 0;
+
+	// Breadth-first over the dependency lists, which loaders read from the file headers alone.
+	for (uint32_t i = 0; i < r_graph.vertices.size(); i++) {
+		const String type_hint = r_graph.vertices[i].type_hint;
+		if (!type_hint.is_empty() && ClassDB::is_parent_class(type_hint, SNAME("Script"))) {
+			continue; // Scripts find their dependencies by parsing, which costs about as much as loading them.
+		}
+
+		List<String> dependencies;
+		get_dependencies(r_graph.vertices[i].local_path, &dependencies, true);
+
+		for (const String &dependency : dependencies) {
+			String path = dependency.get_slice("::", 0);
+			if (path.begins_with("uid://")) {
+				const ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(path);
+				path = ResourceUID::get_singleton()->has_id(uid) ? ResourceUID::get_singleton()->get_id_path(uid) : dependency.get_slice("::", 2);
+			}
+			if (path.is_empty()) {
+				continue;
+			}
+			path = _validate_local_path(path);
+			if (ResourceCache::has(path)) {
+				continue;
+			}
+
+			uint32_t dependency_index;
+			const uint32_t *existing = indices.getptr(path);
+			if (existing) {
+				dependency_index = *existing;
+			} else {
+				dependency_index = r_graph.vertices.size();
+				indices[path] = dependency_index;
+				r_graph.vertices.resize(dependency_index + 1);
+				r_graph.vertices[dependency_index].local_path = path;
+				r_graph.vertices[dependency_index].type_hint = dependency.get_slice("::", 1);
+			}
+
+			if (dependency_index == i || r_graph.vertices[i].dependencies.has(dependency_index)) {
+				continue;
+			}
+			r_graph.vertices[i].dependencies.push_back(dependency_index);
+			r_graph.vertices[dependency_index].dependents.push_back(i);
+		}
+	}
+
+	// Topological sort. Anything left over is part of a cycle, which only the regular
+	// path knows how to break, so the graph is given up on in that case.
+	for (DependencyGraph::Vertex &vertex : r_graph.vertices) {
+		vertex.graph = &r_graph;
+		vertex.pending_dependencies = vertex.dependencies.size();
+		if (vertex.pending_dependencies == 0) {
+			r_graph.order.push_back(&vertex - r_graph.vertices.ptr());
+		}
+	}
+	for (uint32_t i = 0; i < r_graph.order.size(); i++) {
+		for (uint32_t dependent : r_graph.vertices[r_graph.order[i]].dependents) {
+			if (--r_graph.vertices[dependent].pending_dependencies == 0) {
+				r_graph.order.push_back(dependent);
+			}
+		}
+	}
+	if (r_graph.order.size() != r_graph.vertices.size()) {
+		return false;
+	}
+
+	for (DependencyGraph::Vertex &vertex : r_graph.vertices) {
+		vertex.pending_dependencies = vertex.dependencies.size();
+	}
+	return true;
+}
+
+void ResourceLoader::_run_dependency_graph_node(void *p_userdata) {
+	DependencyGraph::Vertex &vertex = *(DependencyGraph::Vertex *)p_userdata;
+	DependencyGraph &graph = *vertex.graph;
+
+	// Load as a sub-task of the root, so progress and resource changed connections add up there.
+	ThreadLoadTask *curr_load_task_backup = curr_load_task;
+	curr_load_task = graph.root_task;
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	Ref<LoadToken> load_token = _load_start(vertex.local_path, vertex.type_hint, LOAD_THREAD_FROM_CURRENT, ResourceFormatLoader::CACHE_MODE_REUSE);
+	if (load_token.is_valid()) {
+		vertex.resource = _load_complete(*load_token.ptr(), nullptr);
+	}
+	vertex.load_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	curr_load_task = curr_load_task_backup;
+
+	// A failed load still releases its dependents; they report the missing dependency themselves.
+	MutexLock lock(graph.mutex);
+	for (uint32_t dependent : vertex.dependents) {
+		DependencyGraph::Vertex &dependent_vertex = graph.vertices[dependent];
+		if (--dependent_vertex.pending_dependencies == 0 && dependent != 0) {
+			dependent_vertex.task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_dependency_graph_node, &dependent_vertex);
+		}
+	}
+}
+
+void ResourceLoader::_run_dependency_graph_load_task(void *p_userdata) {
+	ThreadLoadTask &load_task = *(ThreadLoadTask *)p_userdata;
+
+	DependencyGraph graph;
+	graph.root_task = &load_task;
+
+	bool use_graph = false;
+	{
+		MutexLock thread_load_lock(thread_load_mutex);
+		use_graph = !cleaning_tasks;
+	}
+
+	const uint64_t scan_begin = OS::get_singleton()->get_ticks_usec();
+	use_graph = use_graph && _build_dependency_graph(graph);
+	const uint64_t load_begin = OS::get_singleton()->get_ticks_usec();
+	graph.scan_usec = load_begin - scan_begin;
+
+	if (use_graph && graph.vertices.size() > 1) {
+		{
+			MutexLock lock(graph.mutex);
+			for (uint32_t i = 1; i < graph.vertices.size(); i++) {
+				if (graph.vertices[i].pending_dependencies == 0) {
+					graph.vertices[i].task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_dependency_graph_node, &graph.vertices[i]);
+				}
+			}
+		}
+
+		// Each load spawns the dependents it was the last one blocking, so going through the
+		// topological order finds every task already created by the time it is awaited.
+		for (uint32_t index : graph.order) {
+			if (index == 0) {
+				continue;
+			}
+			WorkerThreadPool::TaskID task_id;
+			{
+				MutexLock lock(graph.mutex);
+				task_id = graph.vertices[index].task_id;
+			}
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+		}
+	}
+
+	// All dependencies are in the cache now, so the root only has to parse itself.
+	// The task may be gone as soon as this returns.
+	const uint64_t root_begin = OS::get_singleton()->get_ticks_usec();
+	_run_load_task(p_userdata);
+	const uint64_t end = OS::get_singleton()->get_ticks_usec();
+
+	if (use_graph) {
+		graph.vertices[0].load_usec = end - root_begin;
+		graph.load_usec = end - load_begin;
+		_report_dependency_graph(graph);
+	}
+}
+
+void ResourceLoader::_report_dependency_graph(const DependencyGraph &p_graph) {
+	const uint32_t count = p_graph.vertices.size();
+	LocalVector<uint64_t> path_usec;
+	LocalVector<int64_t> path_next;
+	path_usec.resize(count);
+	path_next.resize(count);
+
+	DependencyGraphReport report;
+	report.path = p_graph.vertices[0].local_path;
+	report.resource_count = count;
+	report.scan_usec = p_graph.scan_usec;
+	report.load_usec = p_graph.load_usec;
+
+	for (uint32_t index : p_graph.order) {
+		const DependencyGraph::Vertex &vertex = p_graph.vertices[index];
+		uint64_t longest = 0;
+		int64_t longest_dependency = -1;
+		for (uint32_t dependency : vertex.dependencies) {
+			if (longest_dependency == -1 || path_usec[dependency] > longest) {
+				longest = path_usec[dependency];
+				longest_dependency = dependency;
+			}
+		}
+		path_usec[index] = vertex.load_usec + longest;
+		path_next[index] = longest_dependency;
+		report.serial_usec += vertex.load_usec;
+	}
+
+	report.critical_path_usec = path_usec[0];
+	for (int64_t i = 0; i != -1; i = path_next[i]) {
+		report.critical_path.push_back(p_graph.vertices[i].local_path);
+	}
+
+	print_verbose(vformat("Loaded \"%s\" by dependency graph: %d resources, scan %d usec, load %d usec (serial %d usec, critical path %d usec through %s).", report.path, report.resource_count, report.scan_usec, report.load_usec, report.serial_usec, report.critical_path_usec, String(" <- ").join(report.critical_path)));
+
+	MutexLock thread_load_lock(thread_load_mutex);
+	last_dependency_graph_report = report;
+}
+
+ResourceLoader::DependencyGraphReport ResourceLoader::get_last_dependency_graph_report() {
+	MutexLock thread_load_lock(thread_load_mutex);
+	return last_dependency_graph_report;
+}
+
 String ResourceLoader::_validate_local_path(const String &p_path) {
 	ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(p_path);
 	if (uid != ResourceUID::INVALID_ID) {
@@ -486,7 +710,12 @@ String ResourceLoader::_validate_local_path(const String &p_path) {
 }
 
 Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode) {
-	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode, true);
+	LoadThreadMode thread_mode = LOAD_THREAD_SPAWN_SINGLE;
+	if (p_use_sub_threads) {
+		const bool use_dependency_graph = p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && bool(GLOBAL_GET("threading/resource_loader/use_dependency_graph"));
+		thread_mode = use_dependency_graph ? LOAD_THREAD_DEPENDENCY_GRAPH : LOAD_THREAD_DISTRIBUTE;
+	}
+	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, thread_mode, p_cache_mode, true);
 	return token.is_valid() ? OK : FAILED;
 }
 
@@ -584,7 +813,7 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			load_task.local_path = local_path;
 			load_task.type_hint = p_type_hint;
 			load_task.cache_mode = p_cache_mode;
-			load_task.use_sub_threads = p_thread_mode == LOAD_THREAD_DISTRIBUTE;
+			load_task.use_sub_threads = p_thread_mode == LOAD_THREAD_DISTRIBUTE || p_thread_mode == LOAD_THREAD_DEPENDENCY_GRAPH;
 			if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
 				Ref<Resource> existing = ResourceCache::get_ref(local_path);
 				if (existing.is_valid()) {
@@ -630,7 +859,8 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 				load_task_ptr->thread_id = Thread::get_caller_id();
 			}
 		} else {
-			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_load_task, load_task_ptr);
+			void (*task_func)(void *) = p_thread_mode == LOAD_THREAD_DEPENDENCY_GRAPH ? &ResourceLoader::_run_dependency_graph_load_task : &ResourceLoader::_run_load_task;
+			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(task_func, load_task_ptr);
 		}
 	} // MutexLock(thread_load_mutex).
 
@@ -1576,6 +1806,7 @@ thread_local SafeBinaryMutex<ResourceLoader::BINARY_MUTEX_TAG>::TLSData SafeBina
 SafeBinaryMutex<ResourceLoader::BINARY_MUTEX_TAG> ResourceLoader::thread_load_mutex;
 HashMap<String, ResourceLoader::ThreadLoadTask> ResourceLoader::thread_load_tasks;
 bool ResourceLoader::cleaning_tasks = false;
+ResourceLoader::DependencyGraphReport ResourceLoader::last_dependency_graph_report;
 
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
 
@@ -124,6 +124,17 @@ public:
 		LOAD_THREAD_FROM_CURRENT,
 		LOAD_THREAD_SPAWN_SINGLE,
 		LOAD_THREAD_DISTRIBUTE,
+		LOAD_THREAD_DEPENDENCY_GRAPH, // Like LOAD_THREAD_DISTRIBUTE, but all dependencies are scanned first and loaded leaves-up across the pool.
+	};
+
+	struct DependencyGraphReport {
+		String path;
+		uint32_t resource_count = 0;
+		uint64_t scan_usec = 0;
+		uint64_t load_usec = 0; // Wall time from the end of the scan until the root was loaded.
+		uint64_t serial_usec = 0; // Sum of the load times of every resource in the graph.
+		uint64_t critical_path_usec = 0;
+		Vector<String> critical_path; // Root first.
 	};
 
 	struct LoadToken : public RefCounted {
@@ -211,6 +222,13 @@ private:
 	};
 	static void _run_load_task(void *p_userdata);
 
+	struct DependencyGraph;
+	static bool _build_dependency_graph(DependencyGraph &r_graph);
+	static void _run_dependency_graph_node(void *p_userdata);
+	static void _run_dependency_graph_load_task(void *p_userdata);
+	static void _report_dependency_graph(const DependencyGraph &p_graph);
+	static DependencyGraphReport last_dependency_graph_report;
+
 	static thread_local bool import_thread;
 	static thread_local int load_nesting;
 	static thread_local HashMap<int, HashMap<String, Ref<Resource>>> res_ref_overrides; // Outermost key is nesting level.
@@ -234,6 +252,7 @@ public:
 	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
 	static Ref<Resource> load_threaded_get(const String &p_path, Error *r_error = nullptr);
+	static DependencyGraphReport get_last_dependency_graph_report();
 
 	static bool is_within_load() { return load_nesting > 0; }
 
@@ -52,6 +52,7 @@
 
 #include "core/math/bvh_tree.h"
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #include <climits> // INT_MAX
@@ -90,6 +91,14 @@ public:
 		tree.params_set_pairing_expansion(p_value);
 	}
 
+	// When at least this many items changed since the last update, the tree queries for
+	// their new pairs are spread across the WorkerThreadPool. Pair callbacks are still sent
+	// from the calling thread, in the same order as when checking serially. 0 disables it.
+	void params_set_parallel_pairing_threshold(uint32_t p_threshold) {
+		BVH_LOCKED_FUNCTION
+		_parallel_pairing_threshold = p_threshold;
+	}
+
 	void set_pair_callback(PairCallback p_callback, void *p_userdata) {
 		BVH_LOCKED_FUNCTION
 		pair_callback = p_callback;
@@ -437,6 +446,11 @@ private:
 			return;
 		}
 
+		if (_parallel_pairing_threshold && changed_items.size() >= _parallel_pairing_threshold) {
+			_check_for_collisions_parallel(p_full_check);
+			return;
+		}
+
 		typename BVHTREE_CLASS::CullParams params;
 
 		params.result_count_overall = 0;
@@ -480,6 +494,76 @@ private:
 		_reset();
 	}
 
+	// Finds the candidate pairs of one changed item. Only reads the tree, so it can run on any thread.
+	void _find_pair_candidates(uint32_t p_index, void *p_userdata) {
+		BVHHandle h = changed_items[p_index];
+		LocalVector<uint32_t> &hits = _pair_candidates[p_index];
+
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+		params.hits = &hits;
+
+		tree.item_fill_cullparams(h, params);
+		params.abb.from(tree._pairs[h.id()].expanded_aabb);
+		tree.cull_aabb(params, false);
+
+		// Discard what _collide() would reject anyway, so less work is left for the serial pass.
+		uint32_t candidate_count = 0;
+		for (uint32_t i = 0; i < hits.size(); i++) {
+			if (hits[i] == h.id()) {
+				continue;
+			}
+
+			BVHHandle ha = h;
+			BVHHandle hb;
+			hb.set_id(hits[i]);
+			tree._handle_sort(ha, hb);
+
+			const typename BVHTREE_CLASS::ItemExtra &exa = _get_extra(ha);
+			const typename BVHTREE_CLASS::ItemExtra &exb = _get_extra(hb);
+			if (!USER_PAIR_TEST_FUNCTION::user_pair_check(exa.userdata, exb.userdata)) {
+				continue;
+			}
+			if ((exa.userdata == exb.userdata) && exa.userdata) {
+				continue;
+			}
+
+			hits[candidate_count++] = hits[i];
+		}
+		hits.resize(candidate_count);
+	}
+
+	void _check_for_collisions_parallel(bool p_full_check) {
+		uint32_t changed_count = changed_items.size();
+		if (_pair_candidates.size() < changed_count) {
+			_pair_candidates.resize(changed_count);
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_find_pair_candidates, nullptr, changed_count, -1, true, SNAME("BVHFindPairCandidates"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		// Leavers and enterers are processed in changed items order, so callbacks are deterministic.
+		// The tree isn't modified by pairing, so the candidates found up front are still valid.
+		for (uint32_t n = 0; n < changed_count; n++) {
+			BVHHandle h = changed_items[n];
+
+			BVHABB_CLASS abb;
+			abb.from(tree._pairs[h.id()].expanded_aabb);
+			_find_leavers(h, abb, p_full_check);
+
+			for (const uint32_t ref_id : _pair_candidates[n]) {
+				BVHHandle h_collidee;
+				h_collidee.set_id(ref_id);
+				_collide(h, h_collidee);
+			}
+		}
+		_reset();
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -773,6 +857,10 @@ private:
 	LocalVector<BVHHandle> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	// One list per changed item, kept between updates to avoid reallocating.
+	LocalVector<LocalVector<uint32_t>> _pair_candidates;
+	uint32_t _parallel_pairing_threshold = 0;
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
@@ -57,6 +57,8 @@ subject to the following restrictions:
 // The DynamicBVH class implements a fast dynamic bounding volume tree based on axis aligned bounding boxes (aabb tree).
 
 class DynamicBVH {
+	friend class WideBVH;
+
 	struct Node;
 
 public:
@@ -151,7 +153,10 @@ private:
 			}
 
 			// Make sure all points in the shape aren't fully separated from the AABB on
-			// each axis.
+			// each axis. Without points, only the planes are tested.
+			if (p_point_count == 0) {
+				return true;
+			}
 			int bad_point_counts_positive[3] = { 0 };
 			int bad_point_counts_negative[3] = { 0 };
 
@@ -391,7 +396,7 @@ void DynamicBVH::convex_query(const Plane *p_planes, int p_plane_count, const Ve
 	do {
 		depth--;
 		const Node *n = stack[depth];
-		if (n->volume.intersects(volume) && n->volume.intersects_convex(p_planes, p_plane_count, p_points, p_point_count)) {
+		if ((p_point_count == 0 || n->volume.intersects(volume)) && n->volume.intersects_convex(p_planes, p_plane_count, p_points, p_point_count)) {
 			if (n->is_internal()) {
 				if (depth > threshold) {
 					if (aux_stack.is_empty()) {
@@ -0,0 +1,276 @@
+/**************************************************************************/
+/*  wide_bvh.cpp                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "wide_bvh.h"
+
+#if !defined(REAL_T_IS_DOUBLE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define WIDE_BVH_SSE
+#include <xmmintrin.h>
+#endif
+
+void WideBVH::clear() {
+	nodes.clear();
+	leaves.clear();
+	leaf_map.clear();
+	build_cost = 0;
+	cost = 0;
+	valid = false;
+}
+
+void WideBVH::build(const DynamicBVH &p_bvh) {
+	clear();
+	valid = true;
+
+	if (!p_bvh.bvh_root) {
+		return;
+	}
+
+	struct Pending {
+		const DynamicBVH::Node *node = nullptr;
+		uint32_t parent = INVALID_INDEX;
+		uint32_t slot = 0;
+	};
+
+	LocalVector<Pending> pending;
+	pending.push_back({ p_bvh.bvh_root, INVALID_INDEX, 0 });
+	leaves.reserve(p_bvh.total_leaves);
+	leaf_map.reserve(p_bvh.total_leaves);
+
+	while (!pending.is_empty()) {
+		const Pending current = pending[pending.size() - 1];
+		pending.resize(pending.size() - 1);
+
+		// Gather up to four descendants, opening the largest internal node each time.
+		const DynamicBVH::Node *children[WIDTH];
+		uint32_t count = 0;
+		if (current.node->is_leaf()) {
+			// Only happens for a root holding a single leaf.
+			children[count++] = current.node;
+		} else {
+			children[count++] = current.node->children[0];
+			children[count++] = current.node->children[1];
+			while (count < WIDTH) {
+				int largest = -1;
+				real_t largest_size = -1;
+				for (uint32_t i = 0; i < count; i++) {
+					if (children[i]->is_internal() && children[i]->volume.get_size() > largest_size) {
+						largest = i;
+						largest_size = children[i]->volume.get_size();
+					}
+				}
+				if (largest < 0) {
+					break;
+				}
+				const DynamicBVH::Node *opened = children[largest];
+				children[largest] = opened->children[0];
+				children[count++] = opened->children[1];
+			}
+		}
+
+		const uint32_t index = nodes.size();
+		nodes.push_back(Node());
+		if (current.parent != INVALID_INDEX) {
+			nodes[current.parent].children[current.slot] = index;
+		}
+
+		Node &node = nodes[index];
+		node.count = count;
+		node.parent = current.parent;
+		node.parent_slot = current.slot;
+		for (uint32_t i = 0; i < count; i++) {
+			const DynamicBVH::Node *child = children[i];
+			node.set_bounds(i, child->volume.min, child->volume.max);
+			if (child->is_leaf()) {
+				const uint32_t leaf_index = leaves.size();
+				leaves.push_back({ child->data, index, i });
+				leaf_map.insert((uint64_t)child, leaf_index);
+				node.children[i] = leaf_index | LEAF_BIT;
+			} else {
+				node.children[i] = INVALID_INDEX; // Set when the child node is created.
+				pending.push_back({ child, index, i });
+				cost += _slot_area(node, i);
+			}
+		}
+	}
+	build_cost = cost;
+}
+
+void WideBVH::update(const DynamicBVH::ID &p_id, const AABB &p_box) {
+	if (!valid) {
+		return;
+	}
+
+	const uint32_t *leaf_index = leaf_map.getptr((uint64_t)p_id.node);
+	ERR_FAIL_NULL(leaf_index);
+	const Leaf &leaf = leaves[*leaf_index];
+	nodes[leaf.node].set_bounds(leaf.slot, p_box.position, p_box.position + p_box.size);
+	_refit_path(leaf.node);
+}
+
+void WideBVH::_refit_path(uint32_t p_node) {
+	uint32_t index = p_node;
+	while (nodes[index].parent != INVALID_INDEX) {
+		const Node &n = nodes[index];
+		Vector3 min(n.min_x[0], n.min_y[0], n.min_z[0]);
+		Vector3 max(n.max_x[0], n.max_y[0], n.max_z[0]);
+		for (uint32_t i = 1; i < n.count; i++) {
+			min = min.min(Vector3(n.min_x[i], n.min_y[i], n.min_z[i]));
+			max = max.max(Vector3(n.max_x[i], n.max_y[i], n.max_z[i]));
+		}
+		Node &parent = nodes[n.parent];
+		cost -= _slot_area(parent, n.parent_slot);
+		parent.set_bounds(n.parent_slot, min, max);
+		cost += _slot_area(parent, n.parent_slot);
+		index = n.parent;
+	}
+}
+
+bool WideBVH::_separated_by_points(const Node &p_node, uint32_t p_slot, const Vector3 *p_points, int p_point_count) {
+	// Same as DynamicBVH: the shape misses the box if all its points are past one side of it.
+	if (p_point_count == 0) {
+		return false;
+	}
+	const Vector3 min(p_node.min_x[p_slot], p_node.min_y[p_slot], p_node.min_z[p_slot]);
+	const Vector3 max(p_node.max_x[p_slot], p_node.max_y[p_slot], p_node.max_z[p_slot]);
+	for (int k = 0; k < 3; k++) {
+		int positive = 0;
+		int negative = 0;
+		for (int i = 0; i < p_point_count; i++) {
+			if (p_points[i].coord[k] > max.coord[k]) {
+				positive++;
+			}
+			if (p_points[i].coord[k] < min.coord[k]) {
+				negative++;
+			}
+		}
+		if (positive == p_point_count || negative == p_point_count) {
+			return true;
+		}
+	}
+	return false;
+}
+
+#ifdef WIDE_BVH_SSE
+
+uint32_t WideBVH::_cull_convex(const Node &p_node, const Plane *p_planes, int p_plane_count, const Vector3 &p_min, const Vector3 &p_max, uint32_t &r_inside) const {
+	const __m128 min_x = _mm_loadu_ps(p_node.min_x);
+	const __m128 min_y = _mm_loadu_ps(p_node.min_y);
+	const __m128 min_z = _mm_loadu_ps(p_node.min_z);
+	const __m128 max_x = _mm_loadu_ps(p_node.max_x);
+	const __m128 max_y = _mm_loadu_ps(p_node.max_y);
+	const __m128 max_z = _mm_loadu_ps(p_node.max_z);
+	const int valid_mask = (1 << p_node.count) - 1;
+
+	__m128 outside = _mm_or_ps(_mm_cmpgt_ps(min_x, _mm_set1_ps(p_max.x)), _mm_cmplt_ps(max_x, _mm_set1_ps(p_min.x)));
+	outside = _mm_or_ps(outside, _mm_or_ps(_mm_cmpgt_ps(min_y, _mm_set1_ps(p_max.y)), _mm_cmplt_ps(max_y, _mm_set1_ps(p_min.y))));
+	outside = _mm_or_ps(outside, _mm_or_ps(_mm_cmpgt_ps(min_z, _mm_set1_ps(p_max.z)), _mm_cmplt_ps(max_z, _mm_set1_ps(p_min.z))));
+	__m128 not_inside = _mm_setzero_ps();
+
+	for (int i = 0; i < p_plane_count; i++) {
+		if ((_mm_movemask_ps(outside) & valid_mask) == valid_mask) {
+			break;
+		}
+
+		const Plane &p = p_planes[i];
+		const __m128 nx = _mm_set1_ps(p.normal.x);
+		const __m128 ny = _mm_set1_ps(p.normal.y);
+		const __m128 nz = _mm_set1_ps(p.normal.z);
+		const __m128 d = _mm_set1_ps(p.d);
+
+		// The corner furthest behind the plane decides if the box is outside,
+		// and the corner furthest in front of it if the box is fully inside.
+		const bool px = p.normal.x > 0;
+		const bool py = p.normal.y > 0;
+		const bool pz = p.normal.z > 0;
+		const __m128 near_distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, px ? min_x : max_x), _mm_mul_ps(ny, py ? min_y : max_y)), _mm_mul_ps(nz, pz ? min_z : max_z));
+		const __m128 far_distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, px ? max_x : min_x), _mm_mul_ps(ny, py ? max_y : min_y)), _mm_mul_ps(nz, pz ? max_z : min_z));
+		outside = _mm_or_ps(outside, _mm_cmpgt_ps(near_distance, d));
+		not_inside = _mm_or_ps(not_inside, _mm_cmpgt_ps(far_distance, d));
+	}
+
+	const uint32_t mask = ~_mm_movemask_ps(outside) & valid_mask;
+	r_inside = ~_mm_movemask_ps(not_inside) & mask;
+	return mask;
+}
+
+uint32_t WideBVH::_cull_aabb(const Node &p_node, const Vector3 &p_min, const Vector3 &p_max) const {
+	__m128 outside = _mm_or_ps(_mm_cmpgt_ps(_mm_loadu_ps(p_node.min_x), _mm_set1_ps(p_max.x)), _mm_cmplt_ps(_mm_loadu_ps(p_node.max_x), _mm_set1_ps(p_min.x)));
+	outside = _mm_or_ps(outside, _mm_or_ps(_mm_cmpgt_ps(_mm_loadu_ps(p_node.min_y), _mm_set1_ps(p_max.y)), _mm_cmplt_ps(_mm_loadu_ps(p_node.max_y), _mm_set1_ps(p_min.y))));
+	outside = _mm_or_ps(outside, _mm_or_ps(_mm_cmpgt_ps(_mm_loadu_ps(p_node.min_z), _mm_set1_ps(p_max.z)), _mm_cmplt_ps(_mm_loadu_ps(p_node.max_z), _mm_set1_ps(p_min.z))));
+	return ~_mm_movemask_ps(outside) & ((1 << p_node.count) - 1);
+}
+
+#else
+
+uint32_t WideBVH::_cull_convex(const Node &p_node, const Plane *p_planes, int p_plane_count, const Vector3 &p_min, const Vector3 &p_max, uint32_t &r_inside) const {
+	uint32_t mask = _cull_aabb(p_node, p_min, p_max);
+	uint32_t inside = mask;
+
+	for (int i = 0; i < p_plane_count && mask; i++) {
+		const Plane &p = p_planes[i];
+		const bool px = p.normal.x > 0;
+		const bool py = p.normal.y > 0;
+		const bool pz = p.normal.z > 0;
+		const real_t *near_x = px ? p_node.min_x : p_node.max_x;
+		const real_t *near_y = py ? p_node.min_y : p_node.max_y;
+		const real_t *near_z = pz ? p_node.min_z : p_node.max_z;
+		const real_t *far_x = px ? p_node.max_x : p_node.min_x;
+		const real_t *far_y = py ? p_node.max_y : p_node.min_y;
+		const real_t *far_z = pz ? p_node.max_z : p_node.min_z;
+
+		for (uint32_t j = 0; j < WIDTH; j++) {
+			const real_t near_distance = p.normal.x * near_x[j] + p.normal.y * near_y[j] + p.normal.z * near_z[j];
+			const real_t far_distance = p.normal.x * far_x[j] + p.normal.y * far_y[j] + p.normal.z * far_z[j];
+			if (near_distance > p.d) {
+				mask &= ~(1u << j);
+			}
+			if (far_distance > p.d) {
+				inside &= ~(1u << j);
+			}
+		}
+	}
+
+	r_inside = inside & mask;
+	return mask;
+}
+
+uint32_t WideBVH::_cull_aabb(const Node &p_node, const Vector3 &p_min, const Vector3 &p_max) const {
+	uint32_t mask = 0;
+	for (uint32_t i = 0; i < p_node.count; i++) {
+		if (p_node.min_x[i] <= p_max.x && p_node.max_x[i] >= p_min.x &&
+				p_node.min_y[i] <= p_max.y && p_node.max_y[i] >= p_min.y &&
+				p_node.min_z[i] <= p_max.z && p_node.max_z[i] >= p_min.z) {
+			mask |= 1u << i;
+		}
+	}
+	return mask;
+}
+
+#endif // WIDE_BVH_SSE
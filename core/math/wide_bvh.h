@@ -0,0 +1,274 @@
+/**************************************************************************/
+/*  wide_bvh.h                                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/aabb.h"
+#include "core/math/dynamic_bvh.h"
+#include "core/math/plane.h"
+#include "core/templates/a_hash_map.h"
+#include "core/templates/local_vector.h"
+
+// A read-only, 4-wide copy of a DynamicBVH for faster queries.
+//
+// Every node keeps the bounds of its four children in separate arrays per axis, so
+// one node is tested against a plane or a box with a few SIMD instructions, and the
+// tree is about half as deep as the binary one.
+//
+// It is built by collapsing the DynamicBVH, so it benefits from its incremental
+// optimization. Moving a leaf only refits the path to the root; inserting or removing
+// leaves invalidates it until the next build(), and queries must go to the DynamicBVH
+// in the meantime. Refitting keeps the topology of the last build, so once leaves
+// have moved far enough for is_degraded() to report it, the tree should be rebuilt.
+class WideBVH {
+public:
+	static constexpr uint32_t WIDTH = 4;
+
+private:
+	static constexpr uint32_t LEAF_BIT = 1u << 31;
+	// Marks a stack entry whose subtree is fully inside the query, and needs no more tests.
+	static constexpr uint32_t INSIDE_BIT = 1u << 30;
+	static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+	static constexpr int STACK_SIZE = 128;
+	// How much the summed area of the internal nodes may grow through refits before a rebuild pays off.
+	static constexpr real_t REBUILD_COST_RATIO = 1.5;
+
+	struct alignas(16) Node {
+		real_t min_x[WIDTH] = {};
+		real_t min_y[WIDTH] = {};
+		real_t min_z[WIDTH] = {};
+		real_t max_x[WIDTH] = {};
+		real_t max_y[WIDTH] = {};
+		real_t max_z[WIDTH] = {};
+		// Index of the child node, or of the leaf when LEAF_BIT is set.
+		uint32_t children[WIDTH] = {};
+		uint32_t count = 0;
+		uint32_t parent = INVALID_INDEX;
+		uint32_t parent_slot = 0;
+
+		_FORCE_INLINE_ void set_bounds(uint32_t p_slot, const Vector3 &p_min, const Vector3 &p_max) {
+			min_x[p_slot] = p_min.x;
+			min_y[p_slot] = p_min.y;
+			min_z[p_slot] = p_min.z;
+			max_x[p_slot] = p_max.x;
+			max_y[p_slot] = p_max.y;
+			max_z[p_slot] = p_max.z;
+		}
+	};
+
+	struct Leaf {
+		void *data = nullptr;
+		uint32_t node = 0;
+		uint32_t slot = 0;
+	};
+
+	LocalVector<Node> nodes;
+	LocalVector<Leaf> leaves;
+	// DynamicBVH leaf node to leaf index.
+	AHashMap<uint64_t, uint32_t> leaf_map;
+	bool valid = false;
+	// Summed surface area of the internal nodes, at the last build and now.
+	real_t build_cost = 0;
+	real_t cost = 0;
+
+	void _refit_path(uint32_t p_node);
+	static _FORCE_INLINE_ real_t _slot_area(const Node &p_node, uint32_t p_slot) {
+		const real_t x = p_node.max_x[p_slot] - p_node.min_x[p_slot];
+		const real_t y = p_node.max_y[p_slot] - p_node.min_y[p_slot];
+		const real_t z = p_node.max_z[p_slot] - p_node.min_z[p_slot];
+		return x * y + y * z + z * x;
+	}
+
+	// Return the mask of the children that may intersect the query.
+	// `r_inside` gets the children fully inside all planes.
+	uint32_t _cull_convex(const Node &p_node, const Plane *p_planes, int p_plane_count, const Vector3 &p_min, const Vector3 &p_max, uint32_t &r_inside) const;
+	uint32_t _cull_aabb(const Node &p_node, const Vector3 &p_min, const Vector3 &p_max) const;
+	static bool _separated_by_points(const Node &p_node, uint32_t p_slot, const Vector3 *p_points, int p_point_count);
+
+	// Emits the leaves under `p_node`, which is fully inside the planes of a convex query.
+	// The bounds and points of the shape are still tested. Returns true if the query was stopped.
+	template <typename QueryResult>
+	bool _emit_subtree(uint32_t p_node, const Vector3 &p_min, const Vector3 &p_max, const Vector3 *p_points, int p_point_count, QueryResult &r_result) const;
+
+	class Stack {
+		uint32_t fixed[STACK_SIZE];
+		LocalVector<uint32_t> aux; // Only used if the tree is unusually deep.
+		uint32_t *entries = fixed;
+		uint32_t capacity = STACK_SIZE;
+		uint32_t depth = 0;
+
+	public:
+		_FORCE_INLINE_ void push(uint32_t p_entry) {
+			if (unlikely(depth == capacity)) {
+				if (aux.is_empty()) {
+					aux.resize(STACK_SIZE * 2);
+					memcpy(aux.ptr(), fixed, sizeof(fixed));
+				} else {
+					aux.resize(aux.size() * 2);
+				}
+				entries = aux.ptr();
+				capacity = aux.size();
+			}
+			entries[depth++] = p_entry;
+		}
+		_FORCE_INLINE_ uint32_t pop() { return entries[--depth]; }
+		_FORCE_INLINE_ bool is_empty() const { return depth == 0; }
+	};
+
+public:
+	// Rebuilds the tree from the current state of `p_bvh`.
+	void build(const DynamicBVH &p_bvh);
+	// Refits the tree after `p_bvh.update(p_id, p_box)` returned true.
+	void update(const DynamicBVH::ID &p_id, const AABB &p_box);
+	// Must be called when leaves are inserted into or removed from the source DynamicBVH.
+	void invalidate() { valid = false; }
+	void clear();
+
+	bool is_valid() const { return valid; }
+	// True once refits made the tree loose enough that queries would be faster after a build().
+	bool is_degraded() const { return valid && cost > build_cost * REBUILD_COST_RATIO; }
+	uint32_t get_leaf_count() const { return leaves.size(); }
+	uint32_t get_node_count() const { return nodes.size(); }
+
+	// Same queries and results as in DynamicBVH. Only valid while is_valid() is true.
+	template <typename QueryResult>
+	void aabb_query(const AABB &p_aabb, QueryResult &r_result) const;
+	template <typename QueryResult>
+	void convex_query(const Plane *p_planes, int p_plane_count, const Vector3 *p_points, int p_point_count, QueryResult &r_result) const;
+};
+
+template <typename QueryResult>
+bool WideBVH::_emit_subtree(uint32_t p_node, const Vector3 &p_min, const Vector3 &p_max, const Vector3 *p_points, int p_point_count, QueryResult &r_result) const {
+	Stack stack;
+	stack.push(p_node);
+	while (!stack.is_empty()) {
+		const Node &n = nodes[stack.pop()];
+		// Planes don't bound the shape when some are missing, so the leaves may still be outside of it.
+		const uint32_t mask = _cull_aabb(n, p_min, p_max);
+		for (uint32_t i = 0; i < n.count; i++) {
+			if (!(mask & (1u << i))) {
+				continue;
+			}
+			if (n.children[i] & LEAF_BIT) {
+				if (_separated_by_points(n, i, p_points, p_point_count)) {
+					continue;
+				}
+				if (r_result(leaves[n.children[i] & ~LEAF_BIT].data)) {
+					return true;
+				}
+			} else {
+				stack.push(n.children[i]);
+			}
+		}
+	}
+	return false;
+}
+
+template <typename QueryResult>
+void WideBVH::aabb_query(const AABB &p_aabb, QueryResult &r_result) const {
+	if (nodes.is_empty()) {
+		return;
+	}
+	DEV_ASSERT(valid);
+
+	const Vector3 min = p_aabb.position;
+	const Vector3 max = p_aabb.position + p_aabb.size;
+
+	Stack stack;
+	stack.push(0);
+	while (!stack.is_empty()) {
+		const Node &n = nodes[stack.pop()];
+		const uint32_t mask = _cull_aabb(n, min, max);
+		for (uint32_t i = 0; i < n.count; i++) {
+			if (!(mask & (1u << i))) {
+				continue;
+			}
+			if (n.children[i] & LEAF_BIT) {
+				if (r_result(leaves[n.children[i] & ~LEAF_BIT].data)) {
+					return;
+				}
+			} else {
+				stack.push(n.children[i]);
+			}
+		}
+	}
+}
+
+template <typename QueryResult>
+void WideBVH::convex_query(const Plane *p_planes, int p_plane_count, const Vector3 *p_points, int p_point_count, QueryResult &r_result) const {
+	if (nodes.is_empty()) {
+		return;
+	}
+	DEV_ASSERT(valid);
+
+	// Bounds of the convex shape, to improve pre-testing. Without points, only the planes are tested.
+	Vector3 min = Vector3(-Math::INF, -Math::INF, -Math::INF);
+	Vector3 max = Vector3(Math::INF, Math::INF, Math::INF);
+	if (p_point_count > 0) {
+		min = p_points[0];
+		max = p_points[0];
+		for (int i = 1; i < p_point_count; i++) {
+			min = min.min(p_points[i]);
+			max = max.max(p_points[i]);
+		}
+	}
+
+	Stack stack;
+	stack.push(0);
+	while (!stack.is_empty()) {
+		const uint32_t entry = stack.pop();
+		if (entry & INSIDE_BIT) {
+			if (_emit_subtree(entry & ~INSIDE_BIT, min, max, p_points, p_point_count, r_result)) {
+				return;
+			}
+			continue;
+		}
+
+		const Node &n = nodes[entry];
+		uint32_t inside = 0;
+		const uint32_t mask = _cull_convex(n, p_planes, p_plane_count, min, max, inside);
+		for (uint32_t i = 0; i < n.count; i++) {
+			if (!(mask & (1u << i))) {
+				continue;
+			}
+			const bool is_inside = inside & (1u << i);
+			if (n.children[i] & LEAF_BIT) {
+				if (_separated_by_points(n, i, p_points, p_point_count)) {
+					continue;
+				}
+				if (r_result(leaves[n.children[i] & ~LEAF_BIT].data)) {
+					return;
+				}
+			} else {
+				stack.push(is_inside ? (n.children[i] | INSIDE_BIT) : n.children[i]);
+			}
+		}
+	}
+}
@@ -644,6 +644,20 @@ Object *ClassDB::instantiate(const StringName &p_class) {
 	return _instantiate_internal(p_class);
 }
 
+ClassDB::CreationFunc ClassDB::get_native_creation_func(const StringName &p_class) {
+	Locker::Lock lock(Locker::STATE_READ);
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!_can_instantiate(ti) || ti->gdextension || ti->is_runtime) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR || ti->api == API_EDITOR_EXTENSION) {
+		return nullptr;
+	}
+#endif
+	return ti->creation_func;
+}
+
 Object *ClassDB::instantiate_no_placeholders(const StringName &p_class) {
 	return _instantiate_internal(p_class, true);
 }
@@ -1664,6 +1678,24 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+MethodBind *ClassDB::get_property_setter_bind(const StringName &p_class, const StringName &p_property, int *r_index) {
+	ClassInfo *type = classes.getptr(p_class);
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			if (r_index) {
+				*r_index = psg->index;
+			}
+			return psg->_setptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -117,6 +117,8 @@ public:
 		Variant::Type type;
 	};
 
+	typedef Object *(*CreationFunc)(bool);
+
 	struct ClassInfo {
 		APIType api = API_NONE;
 		ClassInfo *inherits_ptr = nullptr;
@@ -342,6 +344,8 @@ public:
 	static Object *instantiate(const StringName &p_class);
 	static Object *instantiate_no_placeholders(const StringName &p_class);
 	static Object *instantiate_without_postinitialization(const StringName &p_class);
+	// Constructor of a native class that needs none of the extra handling done by instantiate(), or nullptr.
+	static CreationFunc get_native_creation_func(const StringName &p_class);
 	static void set_object_extension_instance(Object *p_object, const StringName &p_class, GDExtensionClassInstancePtr p_instance);
 
 	static APIType get_api_type(const StringName &p_class);
@@ -474,6 +478,7 @@ public:
 	static int get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static Variant::Type get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
 	static StringName get_property_setter(const StringName &p_class, const StringName &p_property);
+	static MethodBind *get_property_setter_bind(const StringName &p_class, const StringName &p_property, int *r_index = nullptr);
 	static StringName get_property_getter(const StringName &p_class, const StringName &p_property);
 
 	static bool has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance = false);
@@ -39,24 +39,23 @@
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 #include "core/string/translation_server.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/typed_array.h"
+#include "core/variant/variant_internal.h"
 
 #ifdef DEBUG_ENABLED
 
-struct _ObjectDebugLock {
-	ObjectID obj_id;
+_ObjectDebugLock::_ObjectDebugLock(Object *p_obj) {
+	obj_id = p_obj->get_instance_id();
+	p_obj->_lock_index.ref();
+}
 
-	_ObjectDebugLock(Object *p_obj) {
-		obj_id = p_obj->get_instance_id();
-		p_obj->_lock_index.ref();
-	}
-	~_ObjectDebugLock() {
-		Object *obj_ptr = ObjectDB::get_instance(obj_id);
-		if (likely(obj_ptr)) {
-			obj_ptr->_lock_index.unref();
-		}
+_ObjectDebugLock::~_ObjectDebugLock() {
+	Object *obj_ptr = ObjectDB::get_instance(obj_id);
+	if (likely(obj_ptr)) {
+		obj_ptr->_lock_index.unref();
 	}
-};
+}
 
 #define OBJ_DEBUG_LOCK _ObjectDebugLock _debug_lock(this);
 
@@ -299,6 +298,110 @@ void Object::set(const StringName &p_name, const Variant &p_value, bool *r_valid
 	}
 }
 
+void Object::set_batch(const Array &p_objects, const StringName &p_name, const Variant &p_values) {
+	ERR_FAIL_COND_MSG(!p_values.is_array(), "Values must be an Array or a packed array.");
+	const int count = p_objects.size();
+	ERR_FAIL_COND_MSG(p_values.get_indexed_size() != (uint64_t)count, vformat("Expected %d values, one for each object, but got %d.", count, p_values.get_indexed_size()));
+
+	// Elements of these packed arrays have the same layout ptrcall uses for their Variant type,
+	// so they can be passed to the setter in place.
+	const uint8_t *packed_ptr = nullptr;
+	size_t packed_stride = 0;
+	Variant::Type packed_type = Variant::NIL;
+	switch (p_values.get_type()) {
+		case Variant::PACKED_INT64_ARRAY: {
+			packed_ptr = (const uint8_t *)VariantInternal::get_int64_array(&p_values)->ptr();
+			packed_stride = sizeof(int64_t);
+			packed_type = Variant::INT;
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			packed_ptr = (const uint8_t *)VariantInternal::get_float64_array(&p_values)->ptr();
+			packed_stride = sizeof(double);
+			packed_type = Variant::FLOAT;
+		} break;
+		case Variant::PACKED_STRING_ARRAY: {
+			packed_ptr = (const uint8_t *)VariantInternal::get_string_array(&p_values)->ptr();
+			packed_stride = sizeof(String);
+			packed_type = Variant::STRING;
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			packed_ptr = (const uint8_t *)VariantInternal::get_vector2_array(&p_values)->ptr();
+			packed_stride = sizeof(Vector2);
+			packed_type = Variant::VECTOR2;
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			packed_ptr = (const uint8_t *)VariantInternal::get_vector3_array(&p_values)->ptr();
+			packed_stride = sizeof(Vector3);
+			packed_type = Variant::VECTOR3;
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			packed_ptr = (const uint8_t *)VariantInternal::get_color_array(&p_values)->ptr();
+			packed_stride = sizeof(Color);
+			packed_type = Variant::COLOR;
+		} break;
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			packed_ptr = (const uint8_t *)VariantInternal::get_vector4_array(&p_values)->ptr();
+			packed_stride = sizeof(Vector4);
+			packed_type = Variant::VECTOR4;
+		} break;
+		default: {
+		}
+	}
+
+	// The setter is looked up once per class rather than once per object.
+	StringName setter_class;
+	MethodBind *setter = nullptr;
+	int setter_index = -1;
+	bool setter_ptrcall = false;
+
+	for (int i = 0; i < count; i++) {
+		Object *obj = p_objects[i].get_validated_object();
+		ERR_CONTINUE_MSG(!obj, vformat("Object at index %d is null or was freed.", i));
+
+		const StringName &class_name = obj->get_class_name();
+		if (class_name != setter_class) {
+			setter_class = class_name;
+			setter_index = -1;
+			setter = ClassDB::get_property_setter_bind(class_name, p_name, &setter_index);
+			const int arg_count = setter_index >= 0 ? 2 : 1;
+			setter_ptrcall = setter && packed_ptr && !setter->is_vararg() && !setter->has_return() && setter->get_argument_count() == arg_count && setter->get_argument_type(arg_count - 1) == packed_type;
+		}
+
+		// Extensions can intercept any property, and so can scripts; they get the same chance they would in `set()`.
+		if (!setter || (obj->_extension && obj->_extension->set)) {
+			bool valid;
+			bool oob;
+			obj->set(p_name, p_values.get_indexed(i, valid, oob));
+			continue;
+		}
+		if (obj->script_instance) {
+			bool valid;
+			bool oob;
+			if (obj->script_instance->set(p_name, p_values.get_indexed(i, valid, oob))) {
+				continue;
+			}
+		}
+
+#ifdef TOOLS_ENABLED
+		obj->_edited = true;
+#endif
+
+		if (setter_ptrcall) {
+			const int64_t index = setter_index;
+			const void *args[2] = { &index, packed_ptr + i * packed_stride };
+			setter->ptrcall(obj, setter_index >= 0 ? args : args + 1, nullptr);
+		} else {
+			bool valid;
+			bool oob;
+			const Variant value = p_values.get_indexed(i, valid, oob);
+			const Variant index = setter_index;
+			const Variant *args[2] = { &index, &value };
+			Callable::CallError ce;
+			setter->call(obj, setter_index >= 0 ? args : args + 1, setter_index >= 0 ? 2 : 1, ce);
+		}
+	}
+}
+
 Variant Object::get(const StringName &p_name, bool *r_valid) const {
 	Variant ret;
 
@@ -1822,6 +1925,7 @@ void Object::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_class"), &Object::get_class);
 	ClassDB::bind_method(D_METHOD("is_class", "class"), &Object::is_class);
 	ClassDB::bind_method(D_METHOD("set", "property", "value"), &Object::_set_bind);
+	ClassDB::bind_static_method("Object", D_METHOD("set_batch", "objects", "property", "values"), &Object::set_batch);
 	ClassDB::bind_method(D_METHOD("get", "property"), &Object::_get_bind);
 	ClassDB::bind_method(D_METHOD("set_indexed", "property_path", "value"), &Object::_set_indexed_bind);
 	ClassDB::bind_method(D_METHOD("get_indexed", "property_path"), &Object::_get_indexed_bind);
@@ -2370,18 +2474,6 @@ void postinitialize_handler(Object *p_object) {
 	p_object->_postinitialize();
 }
 
-void ObjectDB::debug_objects(DebugFunc p_func, void *p_user_data) {
-	spin_lock.lock();
-
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object, p_user_data);
-			count--;
-		}
-	}
-	spin_lock.unlock();
-}
-
 #ifdef TOOLS_ENABLED
 void Object::get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const {
 	const String pf = p_function;
@@ -2428,91 +2520,152 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 }
 #endif
 
-SpinLock ObjectDB::spin_lock;
-uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+struct ObjectDB::Shard {
+	SpinLock spin_lock;
+	SafeNumeric<uint32_t> slot_count;
+	uint32_t slot_max = 0;
+	uint64_t validator_counter = 0;
+	LocalVector<uint32_t> free_slots;
+};
 
-int ObjectDB::get_object_count() {
-	return slot_count;
+ObjectDB::Shard ObjectDB::shards[SHARD_COUNT];
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::slot_pages[SHARD_COUNT][PAGES_PER_SHARD] = {};
+
+static SafeNumeric<uint32_t> objectdb_shards_assigned;
+static thread_local uint32_t objectdb_home_shard = UINT32_MAX;
+
+ObjectDB::ObjectSlot &ObjectDB::_get_slot(uint32_t p_shard, uint32_t p_index) {
+	return slot_pages[p_shard][p_index >> PAGE_BITS].load(std::memory_order_relaxed)[p_index & PAGE_MASK];
 }
 
-ObjectID ObjectDB::add_instance(Object *p_object) {
-	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
+void ObjectDB::debug_objects(DebugFunc p_func, void *p_user_data) {
+	for (Shard &shard : shards) {
+		shard.spin_lock.lock();
+	}
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+	for (uint32_t i = 0; i < SHARD_COUNT; i++) {
+		for (uint32_t j = 0, count = shards[i].slot_count.get(); j < shards[i].slot_max && count != 0; j++) {
+			ObjectSlot &object_slot = _get_slot(i, j);
+			if (object_slot.validator.load(std::memory_order_relaxed)) {
+				p_func(object_slot.object.load(std::memory_order_relaxed), p_user_data);
+				count--;
+			}
 		}
-		slot_max = new_slot_max;
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
-		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+	for (Shard &shard : shards) {
+		shard.spin_lock.unlock();
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
+}
+
+int ObjectDB::get_object_count() {
+	uint32_t count = 0;
+	for (const Shard &shard : shards) {
+		count += shard.slot_count.get();
 	}
-	object_slots[slot].validator = validator_counter;
+	return count;
+}
 
-	uint64_t id = validator_counter;
-	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
-	id |= uint64_t(slot);
+ObjectID ObjectDB::add_instance(Object *p_object) {
+	if (unlikely(objectdb_home_shard == UINT32_MAX)) {
+		objectdb_home_shard = objectdb_shards_assigned.postincrement() & SHARD_MASK;
+	}
+
+	// Only fall back to other shards once the home shard is full.
+	for (uint32_t i = 0; i < SHARD_COUNT; i++) {
+		const uint32_t shard_index = (objectdb_home_shard + i) & SHARD_MASK;
+		Shard &shard = shards[shard_index];
+
+		shard.spin_lock.lock();
+
+		uint32_t index;
+		if (!shard.free_slots.is_empty()) {
+			index = shard.free_slots[shard.free_slots.size() - 1];
+			shard.free_slots.resize(shard.free_slots.size() - 1);
+		} else if (shard.slot_max < PAGES_PER_SHARD * PAGE_SIZE) {
+			index = shard.slot_max;
+			if ((index & PAGE_MASK) == 0) {
+				ObjectSlot *page = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * PAGE_SIZE);
+				for (uint32_t j = 0; j < PAGE_SIZE; j++) {
+					memnew_placement(&page[j].validator, std::atomic<uint64_t>(0));
+					memnew_placement(&page[j].object, std::atomic<Object *>(nullptr));
+				}
+				slot_pages[shard_index][index >> PAGE_BITS].store(page, std::memory_order_release);
+			}
+			shard.slot_max++;
+		} else {
+			shard.spin_lock.unlock();
+			continue;
+		}
 
-	if (p_object->is_ref_counted()) {
-		id |= OBJECTDB_REFERENCE_BIT;
-	}
+		ObjectSlot &object_slot = _get_slot(shard_index, index);
+		if (object_slot.object.load(std::memory_order_relaxed) != nullptr) {
+			shard.spin_lock.unlock();
+			ERR_FAIL_COND_V(object_slot.object.load(std::memory_order_relaxed) != nullptr, ObjectID());
+		}
 
-	slot_count++;
+		shard.validator_counter = (shard.validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
+		if (unlikely(shard.validator_counter == 0)) {
+			shard.validator_counter = 1;
+		}
 
-	spin_lock.unlock();
+		uint64_t id = shard.validator_counter;
+		if (p_object->is_ref_counted()) {
+			id |= uint64_t(1) << OBJECTDB_VALIDATOR_BITS;
+		}
+
+		// Publish the object before the validator, lookups check the validator first.
+		object_slot.object.store(p_object, std::memory_order_release);
+		object_slot.validator.store(id, std::memory_order_release);
+
+		id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
+		id |= uint64_t((index << SHARD_BITS) | shard_index);
 
-	return ObjectID(id);
+		shard.slot_count.increment();
+
+		shard.spin_lock.unlock();
+
+		return ObjectID(id);
+	}
+
+	CRASH_NOW_MSG("ObjectDB is full.");
+	return ObjectID();
 }
 
 void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
+	uint32_t index = slot >> SHARD_BITS;
+
+	Shard &shard = shards[slot & SHARD_MASK];
+	ObjectSlot &object_slot = _get_slot(slot & SHARD_MASK, index);
 
-	spin_lock.lock();
+	shard.spin_lock.lock();
 
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
-		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+	if (object_slot.object.load(std::memory_order_relaxed) != p_object) {
+		shard.spin_lock.unlock();
+		ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	}
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
+		if ((object_slot.validator.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator) {
+			shard.spin_lock.unlock();
+			ERR_FAIL_COND((object_slot.validator.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator);
 		}
 	}
 
 #endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
 	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	object_slot.validator.store(0, std::memory_order_release);
+	object_slot.object.store(nullptr, std::memory_order_release);
+	//set the free slot properly
+	shard.free_slots.push_back(index);
+	//decrease slot count
+	shard.slot_count.decrement();
 
-	spin_lock.unlock();
+	shard.spin_lock.unlock();
 }
 
 void ObjectDB::setup() {
@@ -2520,8 +2673,11 @@ void ObjectDB::setup() {
 }
 
 void ObjectDB::cleanup() {
-	spin_lock.lock();
+	for (Shard &shard : shards) {
+		shard.spin_lock.lock();
+	}
 
+	const int slot_count = get_object_count();
 	if (slot_count > 0) {
 		WARN_PRINT(vformat("%d ObjectDB %s leaked at exit (run with `--verbose` for details).", slot_count, slot_count == 1 ? "instance was" : "instances were"));
 		if (OS::get_singleton()->is_stdout_verbose()) {
@@ -2532,35 +2688,49 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
-
-					String extra_info;
-					if (obj->is_class("Node")) {
-						extra_info = " - Node path: " + String(node_get_path->call(obj, nullptr, 0, call_error));
-					}
-					if (obj->is_class("Resource")) {
-						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
-					}
-					if (obj->is_class("RefCounted")) {
-						extra_info = " - Reference count: " + itos((static_cast<RefCounted *>(obj))->get_reference_count());
+			for (uint32_t i = 0; i < SHARD_COUNT; i++) {
+				for (uint32_t j = 0, count = shards[i].slot_count.get(); j < shards[i].slot_max && count != 0; j++) {
+					ObjectSlot &object_slot = _get_slot(i, j);
+					const uint64_t validator = object_slot.validator.load(std::memory_order_relaxed);
+					if (validator) {
+						Object *obj = object_slot.object.load(std::memory_order_relaxed);
+
+						String extra_info;
+						if (obj->is_class("Node")) {
+							extra_info = " - Node path: " + String(node_get_path->call(obj, nullptr, 0, call_error));
+						}
+						if (obj->is_class("Resource")) {
+							extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
+						}
+						if (obj->is_class("RefCounted")) {
+							extra_info = " - Reference count: " + itos((static_cast<RefCounted *>(obj))->get_reference_count());
+						}
+
+						uint64_t id = uint64_t((j << SHARD_BITS) | i) | (validator << OBJECTDB_SLOT_MAX_COUNT_BITS);
+						DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
+						print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
+
+						count--;
 					}
-
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
-					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
-					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
-
-					count--;
 				}
 			}
 			print_line("Hint: Leaked instances typically happen when nodes are removed from the scene tree (with `remove_child()`) but not freed (with `free()` or `queue_free()`).");
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < SHARD_COUNT; i++) {
+		for (std::atomic<ObjectSlot *> &page : slot_pages[i]) {
+			if (page.load(std::memory_order_relaxed)) {
+				memfree(page.load(std::memory_order_relaxed));
+				page.store(nullptr, std::memory_order_relaxed);
+			}
+		}
+		shards[i].slot_count.set(0);
+		shards[i].slot_max = 0;
+		shards[i].free_slots.reset();
 	}
 
-	spin_lock.unlock();
+	for (Shard &shard : shards) {
+		shard.spin_lock.unlock();
+	}
 }
@@ -683,6 +683,7 @@ public:
 
 	void set(const StringName &p_name, const Variant &p_value, bool *r_valid = nullptr);
 	Variant get(const StringName &p_name, bool *r_valid = nullptr) const;
+	static void set_batch(const Array &p_objects, const StringName &p_name, const Variant &p_values);
 	void set_indexed(const Vector<StringName> &p_names, const Variant &p_value, bool *r_valid = nullptr);
 	Variant get_indexed(const Vector<StringName> &p_names, bool *r_valid = nullptr) const;
 
@@ -847,6 +848,16 @@ public:
 bool predelete_handler(Object *p_object);
 void postinitialize_handler(Object *p_object);
 
+#ifdef DEBUG_ENABLED
+// Held while calling a method on an object, so the method can't free its own receiver.
+struct _ObjectDebugLock {
+	ObjectID obj_id;
+
+	_ObjectDebugLock(Object *p_obj);
+	~_ObjectDebugLock();
+};
+#endif // DEBUG_ENABLED
+
 template <typename T, typename O>
 bool Object::derives_from() const {
 	if constexpr (std::is_base_of_v<T, O>) {
@@ -874,18 +885,29 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
+	// Slots are spread over shards, each with its own lock and free list, and every thread allocates from its
+	// own home shard. Slot pages never move once allocated, so lookups don't lock at all.
+	// A slot index stores its shard in the low bits, followed by the page and the index within it.
+	static constexpr uint32_t SHARD_BITS = 6;
+	static constexpr uint32_t SHARD_COUNT = 1 << SHARD_BITS;
+	static constexpr uint32_t SHARD_MASK = SHARD_COUNT - 1;
+	static constexpr uint32_t PAGE_BITS = 10;
+	static constexpr uint32_t PAGE_SIZE = 1 << PAGE_BITS;
+	static constexpr uint32_t PAGE_MASK = PAGE_SIZE - 1;
+	static constexpr uint32_t PAGES_PER_SHARD = 1 << (OBJECTDB_SLOT_MAX_COUNT_BITS - SHARD_BITS - PAGE_BITS);
+
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		// The validator, with the reference bit above it. Zero while the slot is free.
+		std::atomic<uint64_t> validator;
+		std::atomic<Object *> object;
 	};
 
-	static SpinLock spin_lock;
-	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	struct Shard;
+
+	static Shard shards[SHARD_COUNT];
+	static std::atomic<ObjectSlot *> slot_pages[SHARD_COUNT][PAGES_PER_SHARD];
+
+	static ObjectSlot &_get_slot(uint32_t p_shard, uint32_t p_index);
 
 	friend class Object;
 	friend void unregister_core_types();
@@ -903,21 +925,24 @@ public:
 	_ALWAYS_INLINE_ static Object *get_instance(ObjectID p_instance_id) {
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
+		uint32_t index = slot >> SHARD_BITS;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		ObjectSlot *page = slot_pages[slot & SHARD_MASK][index >> PAGE_BITS].load(std::memory_order_acquire);
+		ERR_FAIL_NULL_V(page, nullptr); // This should never happen unless RID is corrupted.
 
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		ObjectSlot &object_slot = page[index & PAGE_MASK];
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		if (unlikely(validator == 0 || (object_slot.validator.load(std::memory_order_acquire) & OBJECTDB_VALIDATOR_MASK) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed and reused while reading it.
+		if (unlikely((object_slot.validator.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
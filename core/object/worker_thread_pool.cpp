@@ -33,6 +33,7 @@
 #include "core/object/class_db.h"
 #include "core/object/message_queue.h"
 #include "core/object/script_language.h"
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "core/os/safe_binary_mutex.h"
 #include "core/os/thread_safe.h"
@@ -100,12 +101,16 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			if (work_index >= p_task->group->max) {
 				break;
 			}
-			if (p_task->native_group_func) {
-				p_task->native_group_func(p_task->native_func_userdata, work_index);
-			} else if (p_task->template_userdata) {
-				p_task->template_userdata->callback_indexed(work_index);
-			} else {
-				p_task->callable.call(work_index);
+			{
+				// Whatever the task allocates from the frame arena only lives until it returns.
+				FrameArena::Scope frame_arena_scope;
+				if (p_task->native_group_func) {
+					p_task->native_group_func(p_task->native_func_userdata, work_index);
+				} else if (p_task->template_userdata) {
+					p_task->template_userdata->callback_indexed(work_index);
+				} else {
+					p_task->callable.call(work_index);
+				}
 			}
 
 			// This is the only way to ensure posting is done when all tasks are really complete.
@@ -138,13 +143,16 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		task_mutex.lock();
 		task_allocator.free(p_task);
 	} else {
-		if (p_task->native_func) {
-			p_task->native_func(p_task->native_func_userdata);
-		} else if (p_task->template_userdata) {
-			p_task->template_userdata->callback();
-			memdelete(p_task->template_userdata);
-		} else {
-			p_task->callable.call();
+		{
+			FrameArena::Scope frame_arena_scope;
+			if (p_task->native_func) {
+				p_task->native_func(p_task->native_func_userdata);
+			} else if (p_task->template_userdata) {
+				p_task->template_userdata->callback();
+				memdelete(p_task->template_userdata);
+			} else {
+				p_task->callable.call();
+			}
 		}
 
 		task_mutex.lock();
@@ -188,8 +196,9 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 	Thread::set_name(vformat("WorkerThread %d", thread_data->index));
 
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		// Fast path: take work from the own queue or steal it from other threads, without locking.
+		Task *task_to_process = thread_data->pool->_pop_queued_task(thread_data);
+		if (!task_to_process) {
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
 			MutexLock lock(thread_data->pool->task_mutex);
@@ -202,17 +211,23 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 				thread_data->signaled = false;
 
-				if (!thread_data->pool->task_queue.first()) {
-					// There wasn't a task available yet.
-					// Let's wait for the next notification, then recheck.
-					thread_data->cond_var.wait(lock);
-					continue;
+				if (thread_data->pool->task_queue.first()) {
+					// Got a task to process! Remove it from the queue, then break into the task handling section.
+					task_to_process = thread_data->pool->task_queue.first()->self();
+					thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
+					break;
 				}
 
-				// Got a task to process! Remove it from the queue, then break into the task handling section.
-				task_to_process = thread_data->pool->task_queue.first()->self();
-				thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
-				break;
+				// Work queues are only pushed to with the lock held, so checking them again here
+				// guarantees no notification about them can be missed before waiting.
+				task_to_process = thread_data->pool->_pop_queued_task(thread_data);
+				if (task_to_process) {
+					break;
+				}
+
+				// There wasn't a task available yet.
+				// Let's wait for the next notification, then recheck.
+				thread_data->cond_var.wait(lock);
 			}
 		}
 
@@ -246,9 +261,15 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
 
+	// Pool threads keep the high priority tasks they spawn in their own work queue,
+	// so they can be taken back or stolen by idle threads without contending for the lock.
+	bool use_work_queue = caller_pool_thread && p_high_priority && !p_pump_task;
+
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
-		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
+		if (use_work_queue && caller_pool_thread->work_queue.push(p_tasks[i])) {
+			to_process++;
+		} else if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
 			task_queue.add_last(&p_tasks[i]->task_elem);
 			if (!p_high_priority) {
 				low_priority_threads_used++;
@@ -340,6 +361,39 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	}
 }
 
+WorkerThreadPool::Task *WorkerThreadPool::_pop_queued_task(ThreadData *p_thread_data) {
+	Task *task = nullptr;
+	if (p_thread_data->work_queue.pop(task)) {
+		return task;
+	}
+
+	// Steal, starting from the next thread to spread thieves across victims.
+	// The array is never relocated while threads are running, so it's fine to access it without locking.
+	ThreadData *threads_ptr = threads.ptr();
+	uint32_t count = work_queue_count.get();
+	for (uint32_t i = 1; i < count; i++) {
+		ThreadData &victim = threads_ptr[(p_thread_data->index + i) % count];
+		while (!victim.work_queue.is_empty()) {
+			if (victim.work_queue.steal(task)) {
+				return task;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+bool WorkerThreadPool::_has_queued_tasks() const {
+	const ThreadData *threads_ptr = threads.ptr();
+	uint32_t count = work_queue_count.get();
+	for (uint32_t i = 0; i < count; i++) {
+		if (!threads_ptr[i].work_queue.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
@@ -373,6 +427,7 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 			threads[thread_count].pool = this;
 			threads[thread_count].thread.start(&WorkerThreadPool::_thread_function, &threads[thread_count]);
 			thread_ids.insert(threads[thread_count].thread.get_id(), thread_count);
+			work_queue_count.set(thread_count + 1);
 		}
 	}
 #endif
@@ -518,7 +573,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || _has_queued_tasks()) ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -536,7 +591,10 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				}
 			}
 
-			if (p_caller_pool_thread->pool->task_queue.first()) {
+			// Prefer the own queue, where the tasks this thread may be waiting for most likely are.
+			task_to_process = _pop_queued_task(p_caller_pool_thread);
+
+			if (!task_to_process && p_caller_pool_thread->pool->task_queue.first()) {
 				task_to_process = task_queue.first()->self();
 				if ((p_task == ThreadData::YIELDING || p_caller_pool_thread->has_pump_task == true) && task_to_process->is_pump_task) {
 					task_to_process = nullptr;
@@ -589,7 +647,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_has_queued_tasks()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -834,6 +892,7 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 		threads[i].thread.start(&WorkerThreadPool::_thread_function, &threads[i]);
 		thread_ids.insert(threads[i].thread.get_id(), i);
 	}
+	work_queue_count.set(threads.size());
 }
 
 void WorkerThreadPool::exit_languages_threads() {
@@ -875,6 +934,7 @@ void WorkerThreadPool::finish() {
 	for (ThreadData &data : threads) {
 		data.thread.wait_to_finish();
 	}
+	work_queue_count.set(0);
 
 	{
 		MutexLock lock(task_mutex);
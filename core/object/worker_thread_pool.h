@@ -39,6 +39,7 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
+#include "core/templates/work_stealing_deque.h"
 #include "core/variant/callable.h"
 
 class WorkerThreadPool : public Object {
@@ -100,6 +101,7 @@ private:
 
 	static const uint32_t TASKS_PAGE_SIZE = 1024;
 	static const uint32_t GROUPS_PAGE_SIZE = 256;
+	static const uint32_t WORK_QUEUE_CAPACITY = 256;
 
 	PagedAllocator<Task, false, TASKS_PAGE_SIZE> task_allocator;
 	PagedAllocator<Group, false, GROUPS_PAGE_SIZE> group_allocator;
@@ -123,6 +125,9 @@ private:
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
 		WorkerThreadPool *pool = nullptr;
+		// High priority tasks posted by this thread. Only pushed to by the owner,
+		// with task_mutex held, but popped and stolen from without locking.
+		WorkStealingDeque<Task *, WORK_QUEUE_CAPACITY> work_queue;
 
 		ThreadData() :
 				signaled(false),
@@ -133,6 +138,7 @@ private:
 	};
 
 	TightLocalVector<ThreadData> threads;
+	SafeNumeric<uint32_t> work_queue_count; // So thieves don't need to read the size of threads without locking.
 	enum Runlevel {
 		RUNLEVEL_NORMAL,
 		RUNLEVEL_PRE_EXIT_LANGUAGES, // Block adding new tasks
@@ -183,6 +189,9 @@ private:
 
 	bool _try_promote_low_priority_task();
 
+	Task *_pop_queued_task(ThreadData *p_thread_data);
+	bool _has_queued_tasks() const;
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -0,0 +1,219 @@
+/**************************************************************************/
+/*  frame_arena.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_arena.h"
+
+#include "core/os/thread.h"
+#include "core/templates/safe_refcount.h"
+
+static SafeNumeric<uint64_t> frame_arena_high_water;
+static SafeNumeric<uint64_t> frame_arena_reserved;
+
+struct FrameArenaBlock {
+	FrameArenaBlock *prev = nullptr;
+	size_t size = 0;
+
+	_FORCE_INLINE_ uint8_t *get_data();
+};
+
+static constexpr size_t FRAME_ARENA_BLOCK_HEADER_SIZE = Memory::get_aligned_address(sizeof(FrameArenaBlock), Memory::MAX_ALIGN);
+
+uint8_t *FrameArenaBlock::get_data() {
+	return (uint8_t *)this + FRAME_ARENA_BLOCK_HEADER_SIZE;
+}
+
+struct FrameArenaThread {
+	FrameArenaBlock *block = nullptr; // Current block, older ones are chained through `prev`.
+	size_t offset = 0;
+	size_t used = 0;
+	size_t reserved = 0;
+	void *last = nullptr; // Last allocation, which can be resized in place.
+	FrameArena::Scope *scope = nullptr; // Innermost open scope.
+
+	void add_block(size_t p_size) {
+		FrameArenaBlock *new_block = (FrameArenaBlock *)Memory::alloc_static(FRAME_ARENA_BLOCK_HEADER_SIZE + p_size);
+		CRASH_COND_MSG(!new_block, "Out of memory");
+		new_block->prev = block;
+		new_block->size = p_size;
+		block = new_block;
+		offset = 0;
+		reserved += p_size;
+		frame_arena_reserved.add(p_size);
+	}
+
+	void free_blocks() {
+		while (block) {
+			FrameArenaBlock *prev = block->prev;
+			Memory::free_static(block);
+			block = prev;
+		}
+		frame_arena_reserved.sub(reserved);
+		reserved = 0;
+		offset = 0;
+	}
+
+	void recycle() {
+		frame_arena_high_water.exchange_if_greater(used);
+		if (block && block->prev) {
+			// The arena overflowed its block, replace the chain with a single block big enough for it.
+			free_blocks();
+			add_block(MAX(used, FrameArena::DEFAULT_BLOCK_SIZE));
+		}
+#ifdef DEV_ENABLED
+		if (block) {
+			// Make use of memory from a previous frame easier to spot.
+			memset(block->get_data(), 0xCD, block->size);
+		}
+#endif
+		offset = 0;
+		used = 0;
+		last = nullptr;
+	}
+
+	void rewind(const FrameArena::Scope &p_scope) {
+		if (!p_scope.block) {
+			// Nothing was allocated when the scope was opened.
+			recycle();
+			return;
+		}
+		frame_arena_high_water.exchange_if_greater(used);
+		while (block != p_scope.block) {
+			FrameArenaBlock *prev = block->prev;
+			reserved -= block->size;
+			frame_arena_reserved.sub(block->size);
+			Memory::free_static(block);
+			block = prev;
+		}
+		offset = p_scope.offset;
+		used = p_scope.used;
+		last = nullptr;
+	}
+
+	void open_scope(FrameArena::Scope &p_scope) {
+		p_scope.prev = scope;
+		p_scope.block = block;
+		p_scope.offset = offset;
+		p_scope.used = used;
+		scope = &p_scope;
+		// Growing an allocation made outside the scope in place would be undone by the rewind.
+		last = nullptr;
+	}
+
+	void close_scope(FrameArena::Scope &p_scope) {
+		DEV_ASSERT(scope == &p_scope);
+		rewind(p_scope);
+		scope = p_scope.prev;
+	}
+
+	~FrameArenaThread() {
+		frame_arena_high_water.exchange_if_greater(used);
+		free_blocks();
+	}
+};
+
+static thread_local FrameArenaThread frame_arena_thread;
+
+FrameArena::Scope::Scope() {
+	frame_arena_thread.open_scope(*this);
+}
+
+FrameArena::Scope::~Scope() {
+	frame_arena_thread.close_scope(*this);
+}
+
+void *FrameArena::alloc(size_t p_bytes) {
+	FrameArenaThread &arena = frame_arena_thread;
+
+	const size_t size = Memory::get_aligned_address(p_bytes, Memory::MAX_ALIGN);
+	if (unlikely(!arena.block || arena.offset + size > arena.block->size)) {
+		// Grow geometrically so a frame that overflows doesn't end up with a long chain.
+		arena.add_block(MAX(size, arena.block ? arena.block->size * 2 : DEFAULT_BLOCK_SIZE));
+	}
+
+	void *mem = arena.block->get_data() + arena.offset;
+	arena.offset += size;
+	arena.used += size;
+	arena.last = mem;
+	return mem;
+}
+
+void *FrameArena::realloc(void *p_memory, size_t p_old_bytes, size_t p_bytes) {
+	if (p_memory == nullptr) {
+		return alloc(p_bytes);
+	}
+
+	FrameArenaThread &arena = frame_arena_thread;
+	if (p_memory == arena.last) {
+		const size_t old_size = Memory::get_aligned_address(p_old_bytes, Memory::MAX_ALIGN);
+		const size_t new_size = Memory::get_aligned_address(p_bytes, Memory::MAX_ALIGN);
+		if (arena.offset - old_size + new_size <= arena.block->size) {
+			arena.offset = arena.offset - old_size + new_size;
+			arena.used = arena.used - old_size + new_size;
+			return p_memory;
+		}
+	}
+
+	void *mem = alloc(p_bytes);
+	memcpy(mem, p_memory, MIN(p_old_bytes, p_bytes));
+	return mem;
+}
+
+void FrameArena::begin_frame() {
+	// Only the main thread follows the main loop. Recycling another thread's
+	// arena here could release memory a task is still using.
+	ERR_FAIL_COND_MSG(!Thread::is_main_thread(), "FrameArena::begin_frame() can only be called from the main thread. Use reset() on other threads.");
+	ERR_FAIL_COND_MSG(frame_arena_thread.scope, "FrameArena::begin_frame() can't be called while a FrameArena::Scope is open, e.g. from a WorkerThreadPool task.");
+	reset();
+}
+
+void FrameArena::reset() {
+	FrameArenaThread &arena = frame_arena_thread;
+	if (arena.scope) {
+		arena.rewind(*arena.scope);
+	} else {
+		arena.recycle();
+	}
+}
+
+uint64_t FrameArena::get_thread_usage() {
+	return frame_arena_thread.used;
+}
+
+uint64_t FrameArena::get_high_water_mark() {
+	return MAX(frame_arena_high_water.get(), (uint64_t)frame_arena_thread.used);
+}
+
+void FrameArena::reset_high_water_mark() {
+	frame_arena_high_water.set(0);
+}
+
+uint64_t FrameArena::get_reserved_bytes() {
+	return frame_arena_reserved.get();
+}
@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*  frame_arena.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+
+struct FrameArenaBlock;
+
+// Thread-local bump allocator for transient, per-frame data.
+//
+// Each thread owns its own arena, so allocating never locks. Memory is
+// released all at once, following these rules:
+// - The main thread's arena is recycled by `begin_frame()`, which
+//   `Main::iteration()` calls at the start of every frame.
+// - WorkerThreadPool opens a `Scope` around every task it runs, so whatever
+//   a task allocates is released as soon as the task returns. This holds no
+//   matter which thread submitted the task or how long it runs, so task
+//   results must be written to memory the submitter owns.
+// - Any other thread (e.g. the rendering thread) calls `reset()` at its own
+//   frame boundaries. Inside a scope, `reset()` only releases what was
+//   allocated since the scope was opened.
+// Nothing allocated here may outlive the point where it is released.
+//
+// `free()` is a no-op, so the class can be used directly as the allocator of
+// containers such as LocalVector (see FrameLocalVector).
+class FrameArena {
+public:
+	static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+	// Releases everything the calling thread allocates while it is alive.
+	// Scopes nest, and must be closed in the reverse order they were opened.
+	class Scope {
+		friend struct FrameArenaThread;
+
+		Scope *prev = nullptr;
+		FrameArenaBlock *block = nullptr;
+		size_t offset = 0;
+		size_t used = 0;
+
+	public:
+		Scope();
+		~Scope();
+	};
+
+	static void *alloc(size_t p_bytes);
+	static void *realloc(void *p_memory, size_t p_old_bytes, size_t p_bytes);
+	_FORCE_INLINE_ static void free(void *p_memory) {}
+
+	static void begin_frame();
+	static void reset();
+
+	// Bytes handed out by the calling thread's arena since it was last recycled.
+	static uint64_t get_thread_usage();
+	// Largest amount of memory a single arena used within one frame.
+	static uint64_t get_high_water_mark();
+	static void reset_high_water_mark();
+	// Memory currently held by the arenas of all threads.
+	static uint64_t get_reserved_bytes();
+};
+
+template <typename T, typename U = uint32_t>
+using FrameLocalVector = LocalVector<T, U, false, false, FrameArena>;
@@ -101,6 +101,7 @@ uint64_t get_mem_max_usage();
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_old_memory, size_t p_memory) { return Memory::realloc_static(p_ptr, p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
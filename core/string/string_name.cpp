@@ -33,18 +33,127 @@
 #include "core/os/mutex.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
-#include "core/templates/paged_allocator.h"
+#include "core/templates/thread_cached_allocator.h"
 
 struct StringName::Table {
 	constexpr static uint32_t TABLE_BITS = 16;
 	constexpr static uint32_t TABLE_LEN = 1 << TABLE_BITS;
 	constexpr static uint32_t TABLE_MASK = TABLE_LEN - 1;
 
+	// Buckets are split into shards with their own lock, so threads interning unrelated names don't contend.
+	constexpr static uint32_t SHARD_BITS = 6;
+	constexpr static uint32_t SHARD_LEN = 1 << SHARD_BITS;
+	constexpr static uint32_t BUCKETS_PER_SHARD = TABLE_LEN / SHARD_LEN;
+	// Names whose refcount dropped to zero stay in the table until this many accumulate in their shard.
+	constexpr static uint32_t SWEEP_THRESHOLD = 32;
+
+	struct Shard {
+		BinaryMutex mutex;
+		SafeNumeric<uint32_t> dead_count;
+	};
+
 	static inline _Data *table[TABLE_LEN];
-	static inline BinaryMutex mutex;
-	static inline PagedAllocator<_Data> allocator;
+	static inline Shard shards[SHARD_LEN];
+	// Names are interned from many threads, so each one keeps a few free entries of its own.
+	static inline ThreadCachedAllocator<_Data> allocator;
+	static inline thread_local ThreadCachedAllocator<_Data>::Cache allocator_cache;
+
+	_FORCE_INLINE_ static uint32_t get_shard_index(uint32_t p_hash) {
+		return (p_hash & TABLE_MASK) / BUCKETS_PER_SHARD;
+	}
+
+	static void sweep(uint32_t p_shard);
+
+	template <typename T>
+	static _Data *intern(const T &p_name, uint32_t p_hash, bool p_static);
 };
 
+// Frees the dead names of a shard. Its mutex must be held.
+void StringName::Table::sweep(uint32_t p_shard) {
+	const uint32_t dead = shards[p_shard].dead_count.get();
+
+	for (uint32_t i = p_shard * BUCKETS_PER_SHARD; i < (p_shard + 1) * BUCKETS_PER_SHARD; i++) {
+		_Data **link = &table[i];
+		while (*link) {
+			_Data *d = *link;
+			if (d->refcount.get() != 0) {
+				link = &d->next;
+				continue;
+			}
+
+			if (CoreGlobals::leak_reporting_enabled && d->static_count.get() > 0) {
+				ERR_PRINT("BUG: Unreferenced static string to 0: " + d->name);
+			}
+			*link = d->next;
+			allocator.free(allocator_cache, d);
+		}
+	}
+
+	// Names can die while sweeping, only forget about the ones counted before.
+	shards[p_shard].dead_count.sub(dead);
+}
+
+template <typename T>
+StringName::_Data *StringName::Table::intern(const T &p_name, uint32_t p_hash, bool p_static) {
+	const uint32_t idx = p_hash & TABLE_MASK;
+	const uint32_t shard = get_shard_index(p_hash);
+
+	MutexLock lock(shards[shard].mutex);
+
+	if (shards[shard].dead_count.get() >= SWEEP_THRESHOLD) {
+		sweep(shard);
+	}
+
+	_Data *data = table[idx];
+	while (data) {
+		// compare hash first
+		if (data->hash == p_hash && data->name == p_name) {
+			break;
+		}
+		data = data->next;
+	}
+
+	if (data) {
+		// exists
+		if (data->refcount.ref()) {
+			if (p_static) {
+				data->static_count.increment();
+			}
+		} else {
+			// Dead but not swept yet. Nobody else can reference it, so it's safe to revive,
+			// with the counts of a new entry.
+			if (CoreGlobals::leak_reporting_enabled && data->static_count.get() > 0) {
+				ERR_PRINT("BUG: Unreferenced static string to 0: " + data->name);
+			}
+			data->refcount.init();
+			data->static_count.set(p_static ? 1 : 0);
+		}
+#ifdef DEBUG_ENABLED
+		if (unlikely(debug_stringname)) {
+			data->debug_references++;
+		}
+#endif
+		return data;
+	}
+
+	data = allocator.alloc(allocator_cache);
+	data->name = p_name;
+	data->refcount.init();
+	data->static_count.set(p_static ? 1 : 0);
+	data->hash = p_hash;
+	data->next = table[idx];
+
+#ifdef DEBUG_ENABLED
+	if (unlikely(debug_stringname)) {
+		// Keep in memory, force static.
+		data->refcount.ref();
+		data->static_count.increment();
+	}
+#endif
+	table[idx] = data;
+	return data;
+}
+
 void StringName::setup() {
 	ERR_FAIL_COND(configured);
 	for (uint32_t i = 0; i < Table::TABLE_LEN; i++) {
@@ -54,8 +163,6 @@ void StringName::setup() {
 }
 
 void StringName::cleanup() {
-	MutexLock lock(Table::mutex);
-
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		Vector<_Data *> data;
@@ -87,6 +194,8 @@ void StringName::cleanup() {
 #endif
 	int lost_strings = 0;
 	for (uint32_t i = 0; i < Table::TABLE_LEN; i++) {
+		MutexLock lock(Table::shards[i / Table::BUCKETS_PER_SHARD].mutex);
+
 		while (Table::table[i]) {
 			_Data *d = Table::table[i];
 			if (d->static_count.get() != d->refcount.get()) {
@@ -98,9 +207,12 @@ void StringName::cleanup() {
 			}
 
 			Table::table[i] = Table::table[i]->next;
-			Table::allocator.free(d);
+			Table::allocator.free(Table::allocator_cache, d);
 		}
 	}
+	for (uint32_t i = 0; i < Table::SHARD_LEN; i++) {
+		Table::shards[i].dead_count.set(0);
+	}
 	if (lost_strings) {
 		print_verbose(vformat("StringName: %d unclaimed string names at exit.", lost_strings));
 	}
@@ -110,23 +222,13 @@ void StringName::cleanup() {
 void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
-	if (_data && _data->refcount.unref()) {
-		MutexLock lock(Table::mutex);
-
-		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
-			ERR_PRINT("BUG: Unreferenced static string to 0: " + _data->name);
-		}
-		if (_data->prev) {
-			_data->prev->next = _data->next;
-		} else {
-			const uint32_t idx = _data->hash & Table::TABLE_MASK;
-			Table::table[idx] = _data->next;
-		}
-
-		if (_data->next) {
-			_data->next->prev = _data->prev;
+	if (_data) {
+		// Dead names are left in the table and freed by the next lookup that sweeps their shard,
+		// so dropping a reference never has to lock. `_data` must not be touched after the last unref.
+		Table::Shard &shard = Table::shards[Table::get_shard_index(_data->hash)];
+		if (_data->refcount.unref()) {
+			shard.dead_count.increment();
 		}
-		Table::allocator.free(_data);
 	}
 
 	_data = nullptr;
@@ -211,52 +313,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	const uint32_t hash = String::hash(p_name);
-	const uint32_t idx = hash & Table::TABLE_MASK;
-
-	MutexLock lock(Table::mutex);
-	_data = Table::table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->name == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
-	}
-
-	_data = Table::allocator.alloc();
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->next = Table::table[idx];
-	_data->prev = nullptr;
-
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-	if (Table::table[idx]) {
-		Table::table[idx]->prev = _data;
-	}
-	Table::table[idx] = _data;
+	_data = Table::intern(p_name, String::hash(p_name), p_static);
 }
 
 StringName::StringName(const String &p_name, bool p_static) {
@@ -268,51 +325,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	const uint32_t hash = p_name.hash();
-	const uint32_t idx = hash & Table::TABLE_MASK;
-
-	MutexLock lock(Table::mutex);
-	_data = Table::table[idx];
-
-	while (_data) {
-		if (_data->hash == hash && _data->name == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
-#ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
-#endif
-		return;
-	}
-
-	_data = Table::allocator.alloc();
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->next = Table::table[idx];
-	_data->prev = nullptr;
-#ifdef DEBUG_ENABLED
-	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
-	}
-#endif
-
-	if (Table::table[idx]) {
-		Table::table[idx]->prev = _data;
-	}
-	Table::table[idx] = _data;
+	_data = Table::intern(p_name, p_name.hash(), p_static);
 }
 
 bool operator==(const String &p_name, const StringName &p_string_name) {
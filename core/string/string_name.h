@@ -49,7 +49,6 @@ class [[nodiscard]] StringName {
 #endif
 
 		uint32_t hash = 0;
-		_Data *prev = nullptr;
 		_Data *next = nullptr;
 	};
 
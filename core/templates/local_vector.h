@@ -41,7 +41,8 @@
 
 // If tight, it grows strictly as much as needed.
 // Otherwise, it grows exponentially (the default and what you want in most cases).
-template <typename T, typename U = uint32_t, bool force_trivial = false, bool tight = false>
+// The allocator must provide static alloc(), realloc() and free(), like DefaultAllocator does.
+template <typename T, typename U = uint32_t, bool force_trivial = false, bool tight = false, typename A = DefaultAllocator>
 class LocalVector {
 	static_assert(!force_trivial, "force_trivial is no longer supported. Use resize_uninitialized instead.");
 
@@ -154,7 +155,7 @@ public:
 	_FORCE_INLINE_ void reset() {
 		clear();
 		if (data) {
-			memfree(data);
+			A::free(data);
 			data = nullptr;
 			capacity = 0;
 		}
@@ -163,6 +164,7 @@ public:
 	_FORCE_INLINE_ U get_capacity() const { return capacity; }
 	void reserve(U p_size) {
 		if (p_size > capacity) {
+			const U old_capacity = capacity;
 			if (tight) {
 				capacity = p_size;
 			} else {
@@ -175,7 +177,7 @@ public:
 					capacity = p_size;
 				}
 			}
-			data = (T *)memrealloc(data, capacity * sizeof(T));
+			data = (T *)A::realloc(data, old_capacity * sizeof(T), capacity * sizeof(T));
 			CRASH_COND_MSG(!data, "Out of memory");
 		} else if (p_size < count) {
 			WARN_VERBOSE("reserve() called with a capacity smaller than the current size. This is likely a mistake.");
@@ -410,5 +412,5 @@ template <typename T, typename U = uint32_t>
 using TightLocalVector = LocalVector<T, U, false, true>;
 
 // Zero-constructing LocalVector initializes count, capacity and data to 0 and thus empty.
-template <typename T, typename U, bool force_trivial, bool tight>
-struct is_zero_constructible<LocalVector<T, U, force_trivial, tight>> : std::true_type {};
+template <typename T, typename U, bool force_trivial, bool tight, typename A>
+struct is_zero_constructible<LocalVector<T, U, force_trivial, tight, A>> : std::true_type {};
@@ -0,0 +1,766 @@
+/**************************************************************************/
+/*  ordered_a_hash_map.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/math_funcs_binary.h"
+#include "core/os/memory.h"
+#include "core/string/print_string.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+/**
+ * An array-based hash map like AHashMap, which keeps the insertion order when elements
+ * are erased, and never moves its elements.
+ *
+ * Elements live in slots, allocated in chunks that grow with the map. Growing adds a
+ * chunk instead of reallocating the ones in use, and erased slots are reused by later
+ * insertions. The insertion order is a separate array of slot indices. Erasing leaves a
+ * hole in it, which iteration skips, and holes are compacted away once they make up half
+ * of the array, or when it needs to grow. Only the indices move:
+ *
+ *  6 8 X 9 32 -1 5 -10 7 X X X
+ *  6 8 9 32 -1 5 -10 7 X X X X   (after compaction)
+ *
+ * Like HashMap, pointers to keys and values stay valid until their element is erased.
+ * Iterators are invalidated by any insertion or erase.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class OrderedAHashMap {
+public:
+	// Must be a power of two.
+	static constexpr uint32_t INITIAL_CAPACITY = 16;
+	static constexpr uint32_t EMPTY_HASH = 0;
+	static_assert(EMPTY_HASH == 0, "EMPTY_HASH must always be 0 for the memset() optimization.");
+
+private:
+	static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+	static constexpr uint32_t MIN_CHUNK_SIZE = 8;
+
+	struct Metadata {
+		uint32_t hash;
+		uint32_t slot;
+	};
+
+	static_assert(sizeof(Metadata) == 8);
+
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	struct Slot {
+		MapKeyValue *element = nullptr;
+		uint32_t hash = EMPTY_HASH; // EMPTY_HASH while the slot is free.
+		uint32_t link = INVALID_INDEX; // Position in `_order` while used, next free slot otherwise.
+	};
+
+	Metadata *_metadata = nullptr;
+	Slot *_slots = nullptr;
+	MapKeyValue **_chunks = nullptr;
+	// Slot of each element in insertion order, or INVALID_INDEX if it was erased.
+	uint32_t *_order = nullptr;
+
+	// Due to optimization, this is `capacity - 1`. Use + 1 to get normal capacity.
+	uint32_t _capacity_mask = 0;
+	uint32_t _chunk_count = 0;
+	uint32_t _slot_capacity = 0;
+	// Slots handed out at least once; the ones erased since are in the free list.
+	uint32_t _slot_count = 0;
+	uint32_t _free_slot = INVALID_INDEX;
+	uint32_t _order_capacity = 0;
+	// Positions in `_order` in use, including erased ones.
+	uint32_t _used = 0;
+	uint32_t _size = 0;
+
+	uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_resize_count(uint32_t p_capacity_mask) {
+		return p_capacity_mask ^ (p_capacity_mask + 1) >> 2; // = get_capacity() * 0.75 - 1; Works only if p_capacity_mask = 2^n - 1.
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_probe_length(uint32_t p_meta_idx, uint32_t p_hash, uint32_t p_capacity) {
+		const uint32_t original_idx = p_hash & p_capacity;
+		return (p_meta_idx - original_idx + p_capacity + 1) & p_capacity;
+	}
+
+	bool _lookup_idx(const TKey &p_key, uint32_t &r_slot, uint32_t &r_meta_idx) const {
+		if (unlikely(_metadata == nullptr)) {
+			return false; // Failed lookups, no elements.
+		}
+		return _lookup_idx_with_hash(p_key, r_slot, r_meta_idx, _hash(p_key));
+	}
+
+	bool _lookup_idx_with_hash(const TKey &p_key, uint32_t &r_slot, uint32_t &r_meta_idx, uint32_t p_hash) const {
+		if (unlikely(_metadata == nullptr)) {
+			return false; // Failed lookups, no elements.
+		}
+
+		uint32_t meta_idx = p_hash & _capacity_mask;
+		uint32_t distance = 0;
+		while (true) {
+			const Metadata metadata = _metadata[meta_idx];
+			if (metadata.hash == p_hash && Comparator::compare(_slots[metadata.slot].element->key, p_key)) {
+				r_slot = metadata.slot;
+				r_meta_idx = meta_idx;
+				return true;
+			}
+
+			if (metadata.hash == EMPTY_HASH) {
+				return false;
+			}
+
+			if (distance > _get_probe_length(meta_idx, metadata.hash, _capacity_mask)) {
+				return false;
+			}
+
+			meta_idx = (meta_idx + 1) & _capacity_mask;
+			distance++;
+		}
+	}
+
+	void _insert_metadata(uint32_t p_hash, uint32_t p_slot) {
+		uint32_t meta_idx = p_hash & _capacity_mask;
+		uint32_t distance = 0;
+		Metadata metadata = { p_hash, p_slot };
+
+		while (true) {
+			if (_metadata[meta_idx].hash == EMPTY_HASH) {
+#ifdef DEV_ENABLED
+				if (unlikely(distance > 12)) {
+					WARN_PRINT("Excessive collision count, is the right hash function being used?");
+				}
+#endif
+				_metadata[meta_idx] = metadata;
+				return;
+			}
+
+			// Not an empty slot, let's check the probing length of the existing one.
+			uint32_t existing_probe_len = _get_probe_length(meta_idx, _metadata[meta_idx].hash, _capacity_mask);
+			if (existing_probe_len < distance) {
+				SWAP(metadata, _metadata[meta_idx]);
+				distance = existing_probe_len;
+			}
+
+			meta_idx = (meta_idx + 1) & _capacity_mask;
+			distance++;
+		}
+	}
+
+	void _erase_metadata(uint32_t p_meta_idx) {
+		// Shift the following entries back, so no tombstones are needed in the metadata.
+		uint32_t meta_idx = p_meta_idx;
+		uint32_t next_meta_idx = (meta_idx + 1) & _capacity_mask;
+		while (_metadata[next_meta_idx].hash != EMPTY_HASH && _get_probe_length(next_meta_idx, _metadata[next_meta_idx].hash, _capacity_mask) != 0) {
+			SWAP(_metadata[next_meta_idx], _metadata[meta_idx]);
+
+			meta_idx = next_meta_idx;
+			next_meta_idx = (next_meta_idx + 1) & _capacity_mask;
+		}
+
+		_metadata[meta_idx].hash = EMPTY_HASH;
+	}
+
+	// Moves the remaining slot indices over the erased ones, keeping their order.
+	void _compact_order() {
+		if (_used == _size) {
+			return;
+		}
+
+		uint32_t dst = 0;
+		for (uint32_t src = 0; src < _used; src++) {
+			const uint32_t slot = _order[src];
+			if (slot == INVALID_INDEX) {
+				continue;
+			}
+			_order[dst] = slot;
+			_slots[slot].link = dst;
+			dst++;
+		}
+		_used = _size;
+	}
+
+	void _rebuild_metadata() {
+		memset((void *)_metadata, EMPTY_HASH, (_capacity_mask + 1) * sizeof(Metadata));
+		for (uint32_t i = 0; i < _used; i++) {
+			if (_order[i] != INVALID_INDEX) {
+				_insert_metadata(_slots[_order[i]].hash, _order[i]);
+			}
+		}
+	}
+
+	void _allocate() {
+		_metadata = reinterpret_cast<Metadata *>(Memory::alloc_static_zeroed(sizeof(Metadata) * (_capacity_mask + 1)));
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		// Capacity can't be 0 and must be 2^n - 1.
+		_capacity_mask = MAX(4u, p_new_capacity);
+		uint32_t real_capacity = Math::next_power_of_2(_capacity_mask);
+		_capacity_mask = real_capacity - 1;
+
+		Memory::free_static(_metadata);
+		_metadata = reinterpret_cast<Metadata *>(Memory::alloc_static(sizeof(Metadata) * real_capacity));
+
+		_rebuild_metadata();
+	}
+
+	// Adds slots in a new chunk. The existing chunks stay where they are.
+	void _add_chunk(uint32_t p_count) {
+		MapKeyValue *chunk = reinterpret_cast<MapKeyValue *>(Memory::alloc_static(sizeof(MapKeyValue) * p_count));
+		_chunks = reinterpret_cast<MapKeyValue **>(Memory::realloc_static(_chunks, sizeof(MapKeyValue *) * (_chunk_count + 1)));
+		_chunks[_chunk_count++] = chunk;
+
+		_slots = reinterpret_cast<Slot *>(Memory::realloc_static(_slots, sizeof(Slot) * (_slot_capacity + p_count)));
+		for (uint32_t i = 0; i < p_count; i++) {
+			memnew_placement(&_slots[_slot_capacity + i], Slot);
+			_slots[_slot_capacity + i].element = &chunk[i];
+		}
+		_slot_capacity += p_count;
+	}
+
+	uint32_t _acquire_slot() {
+		if (_free_slot != INVALID_INDEX) {
+			const uint32_t slot = _free_slot;
+			_free_slot = _slots[slot].link;
+			return slot;
+		}
+		if (unlikely(_slot_count == _slot_capacity)) {
+			// Double the slot count, or make room for what reserve() asked for.
+			const uint32_t reserved = _get_resize_count(_capacity_mask) + 1;
+			_add_chunk(MAX(MAX(MIN_CHUNK_SIZE, _slot_capacity), reserved > _slot_capacity ? reserved - _slot_capacity : 0u));
+		}
+		return _slot_count++;
+	}
+
+	void _push_order(uint32_t p_slot) {
+		if (unlikely(_used == _order_capacity)) {
+			if (_used - _size >= _used / 2 && _used > 0) {
+				// Enough erased positions to reuse, no need to grow.
+				_compact_order();
+			} else {
+				_order_capacity = MAX(MAX(MIN_CHUNK_SIZE, _order_capacity * 2), _get_resize_count(_capacity_mask) + 1);
+				_order = reinterpret_cast<uint32_t *>(Memory::realloc_static(_order, sizeof(uint32_t) * _order_capacity));
+				_compact_order();
+			}
+		}
+
+		_order[_used] = p_slot;
+		_slots[p_slot].link = _used;
+		_used++;
+	}
+
+	uint32_t _insert_element(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(_metadata == nullptr)) {
+			// Allocate on demand to save memory.
+			_allocate();
+		}
+
+		if (unlikely(_size > _get_resize_count(_capacity_mask))) {
+			_resize_and_rehash(_capacity_mask * 2);
+		}
+
+		const uint32_t slot = _acquire_slot();
+		memnew_placement(_slots[slot].element, MapKeyValue(p_key, p_value));
+		_slots[slot].hash = p_hash;
+		_push_order(slot);
+
+		_insert_metadata(p_hash, slot);
+		_size++;
+		return slot;
+	}
+
+	void _init_from(const OrderedAHashMap &p_other) {
+		_capacity_mask = p_other._capacity_mask;
+
+		if (p_other._size == 0) {
+			return;
+		}
+
+		_allocate();
+		_add_chunk(MAX(MIN_CHUNK_SIZE, p_other._size));
+		_order_capacity = p_other._size;
+		_order = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * _order_capacity));
+
+		for (uint32_t i = 0; i < p_other._used; i++) {
+			const uint32_t other_slot = p_other._order[i];
+			if (other_slot == INVALID_INDEX) {
+				continue;
+			}
+			const uint32_t slot = _slot_count++;
+			memnew_placement(_slots[slot].element, MapKeyValue(*p_other._slots[other_slot].element));
+			_slots[slot].hash = p_other._slots[other_slot].hash;
+			_order[_used] = slot;
+			_slots[slot].link = _used;
+			_used++;
+		}
+		_size = _used;
+
+		_rebuild_metadata();
+	}
+
+	_FORCE_INLINE_ uint32_t _skip_erased(uint32_t p_idx) const {
+		while (p_idx < _used && _order[p_idx] == INVALID_INDEX) {
+			p_idx++;
+		}
+		return p_idx;
+	}
+
+	template <typename C>
+	struct SlotOrder {
+		const Slot *slots = nullptr;
+		C compare;
+
+		_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+			return compare(*slots[p_a].element, *slots[p_b].element);
+		}
+	};
+
+public:
+	/* Standard Godot Container API */
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return _capacity_mask + 1; }
+	_FORCE_INLINE_ uint32_t size() const { return _size; }
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return _size == 0;
+	}
+
+	void clear() {
+		if (_metadata == nullptr || _slot_count == 0) {
+			return;
+		}
+
+		memset((void *)_metadata, EMPTY_HASH, (_capacity_mask + 1) * sizeof(Metadata));
+		for (uint32_t i = 0; i < _used; i++) {
+			const uint32_t slot = _order[i];
+			if (slot != INVALID_INDEX) {
+				_slots[slot].element->key.~TKey();
+				_slots[slot].element->value.~TValue();
+			}
+		}
+		for (uint32_t i = 0; i < _slot_count; i++) {
+			_slots[i].hash = EMPTY_HASH;
+		}
+
+		_slot_count = 0;
+		_free_slot = INVALID_INDEX;
+		_size = 0;
+		_used = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t slot = 0;
+		uint32_t meta_idx = 0;
+		bool exists = _lookup_idx(p_key, slot, meta_idx);
+		CRASH_COND_MSG(!exists, "OrderedAHashMap key not found.");
+		return _slots[slot].element->value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t slot = 0;
+		uint32_t meta_idx = 0;
+		bool exists = _lookup_idx(p_key, slot, meta_idx);
+		CRASH_COND_MSG(!exists, "OrderedAHashMap key not found.");
+		return _slots[slot].element->value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t slot = 0;
+		uint32_t meta_idx = 0;
+		if (_lookup_idx(p_key, slot, meta_idx)) {
+			return &_slots[slot].element->value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t slot = 0;
+		uint32_t meta_idx = 0;
+		if (_lookup_idx(p_key, slot, meta_idx)) {
+			return &_slots[slot].element->value;
+		}
+		return nullptr;
+	}
+
+	bool has(const TKey &p_key) const {
+		uint32_t slot = 0;
+		uint32_t meta_idx = 0;
+		return _lookup_idx(p_key, slot, meta_idx);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t meta_idx = 0;
+		uint32_t slot = 0;
+		if (!_lookup_idx(p_key, slot, meta_idx)) {
+			return false;
+		}
+
+		_erase_metadata(meta_idx);
+
+		_slots[slot].element->key.~TKey();
+		_slots[slot].element->value.~TValue();
+		_order[_slots[slot].link] = INVALID_INDEX;
+		_slots[slot].hash = EMPTY_HASH;
+		_slots[slot].link = _free_slot;
+		_free_slot = slot;
+		_size--;
+
+		// Erased positions at the end can be reused right away.
+		while (_used > 0 && _order[_used - 1] == INVALID_INDEX) {
+			_used--;
+		}
+
+		// Reclaim the holes once they take half of the used positions; amortized over the erases that made them.
+		if (_used > INITIAL_CAPACITY && _size < _used / 2) {
+			_compact_order();
+		}
+
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		if (_metadata == nullptr) {
+			_capacity_mask = MAX(4u, p_new_capacity);
+			_capacity_mask = Math::next_power_of_2(_capacity_mask) - 1;
+			return; // Unallocated yet.
+		}
+		if (p_new_capacity <= get_capacity()) {
+			if (p_new_capacity < size()) {
+				WARN_VERBOSE("reserve() called with a capacity smaller than the current size. This is likely a mistake.");
+			}
+			return;
+		}
+		_resize_and_rehash(p_new_capacity);
+	}
+
+	// Sorts the elements with a stable merge sort, so `C` does not need to be a strict weak ordering.
+	// Only the order changes, the elements stay in their slots.
+	template <typename C>
+	void sort_custom() {
+		if (_size < 2) {
+			return;
+		}
+
+		_compact_order();
+
+		SlotOrder<C> order;
+		order.slots = _slots;
+
+		uint32_t *buffer = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * _size));
+		uint32_t *src = _order;
+		uint32_t *dst = buffer;
+		for (uint32_t width = 1; width < _size; width *= 2) {
+			for (uint32_t begin = 0; begin < _size; begin += width * 2) {
+				const uint32_t mid = MIN(begin + width, _size);
+				const uint32_t end = MIN(begin + width * 2, _size);
+				uint32_t l = begin;
+				uint32_t r = mid;
+				uint32_t out = begin;
+				while (l < mid && r < end) {
+					dst[out++] = order(src[r], src[l]) ? src[r++] : src[l++];
+				}
+				while (l < mid) {
+					dst[out++] = src[l++];
+				}
+				while (r < end) {
+					dst[out++] = src[r++];
+				}
+			}
+			SWAP(src, dst);
+		}
+
+		if (src != _order) {
+			memcpy(_order, src, sizeof(uint32_t) * _size);
+		}
+		Memory::free_static(buffer);
+
+		for (uint32_t i = 0; i < _size; i++) {
+			_slots[_order[i]].link = i;
+		}
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const {
+			return *slots[order[pos]].element;
+		}
+		_FORCE_INLINE_ const MapKeyValue *operator->() const {
+			return slots[order[pos]].element;
+		}
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			do {
+				pos++;
+			} while (pos != end && order[pos] == INVALID_INDEX);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return pos == b.pos; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return pos != b.pos; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return pos != end;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const Slot *p_slots, const uint32_t *p_order, uint32_t p_pos, uint32_t p_end) {
+			slots = p_slots;
+			order = p_order;
+			pos = p_pos;
+			end = p_end;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		const Slot *slots = nullptr;
+		const uint32_t *order = nullptr;
+		uint32_t pos = 0;
+		uint32_t end = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const {
+			return *slots[order[pos]].element;
+		}
+		_FORCE_INLINE_ MapKeyValue *operator->() const {
+			return slots[order[pos]].element;
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			do {
+				pos++;
+			} while (pos != end && order[pos] == INVALID_INDEX);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return pos == b.pos; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return pos != b.pos; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return pos != end;
+		}
+
+		_FORCE_INLINE_ Iterator(const Slot *p_slots, const uint32_t *p_order, uint32_t p_pos, uint32_t p_end) {
+			slots = p_slots;
+			order = p_order;
+			pos = p_pos;
+			end = p_end;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(slots, order, pos, end);
+		}
+
+	private:
+		const Slot *slots = nullptr;
+		const uint32_t *order = nullptr;
+		uint32_t pos = 0;
+		uint32_t end = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(_slots, _order, _skip_erased(0), _used);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(_slots, _order, _used, _used);
+	}
+
+	Iterator find(const TKey &p_key) {
+		uint32_t meta_idx = 0;
+		uint32_t slot = 0;
+		if (!_lookup_idx(p_key, slot, meta_idx)) {
+			return end();
+		}
+		return Iterator(_slots, _order, _slots[slot].link, _used);
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(_slots, _order, _skip_erased(0), _used);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(_slots, _order, _used, _used);
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		uint32_t slot = 0;
+		uint32_t meta_idx = 0;
+		if (!_lookup_idx(p_key, slot, meta_idx)) {
+			return end();
+		}
+		return ConstIterator(_slots, _order, _slots[slot].link, _used);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t slot = 0;
+		uint32_t meta_idx = 0;
+		bool exists = _lookup_idx(p_key, slot, meta_idx);
+		CRASH_COND(!exists);
+		return _slots[slot].element->value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t slot = 0;
+		uint32_t meta_idx = 0;
+		uint32_t hash = _hash(p_key);
+		if (!_lookup_idx_with_hash(p_key, slot, meta_idx, hash)) {
+			slot = _insert_element(p_key, TValue(), hash);
+		}
+		return _slots[slot].element->value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t slot = 0;
+		uint32_t meta_idx = 0;
+		uint32_t hash = _hash(p_key);
+		if (!_lookup_idx_with_hash(p_key, slot, meta_idx, hash)) {
+			slot = _insert_element(p_key, p_value, hash);
+		} else {
+			_slots[slot].element->value = p_value;
+		}
+		return Iterator(_slots, _order, _slots[slot].link, _used);
+	}
+
+	/* Array methods. */
+
+	// Returns the element at position `p_index` in insertion order.
+	// Constant time unless elements were erased since the last compaction.
+	const KeyValue<TKey, TValue> &get_by_index(uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, _size);
+		if (_used == _size) {
+			return *_slots[_order[p_index]].element;
+		}
+		uint32_t idx = _skip_erased(0);
+		for (uint32_t i = 0; i < p_index; i++) {
+			idx = _skip_erased(idx + 1);
+		}
+		return *_slots[_order[idx]].element;
+	}
+
+	/* Constructors */
+
+	OrderedAHashMap(OrderedAHashMap &&p_other) {
+		_metadata = p_other._metadata;
+		_slots = p_other._slots;
+		_chunks = p_other._chunks;
+		_order = p_other._order;
+		_capacity_mask = p_other._capacity_mask;
+		_chunk_count = p_other._chunk_count;
+		_slot_capacity = p_other._slot_capacity;
+		_slot_count = p_other._slot_count;
+		_free_slot = p_other._free_slot;
+		_order_capacity = p_other._order_capacity;
+		_used = p_other._used;
+		_size = p_other._size;
+
+		p_other._metadata = nullptr;
+		p_other._slots = nullptr;
+		p_other._chunks = nullptr;
+		p_other._order = nullptr;
+		p_other._capacity_mask = INITIAL_CAPACITY - 1;
+		p_other._chunk_count = 0;
+		p_other._slot_capacity = 0;
+		p_other._slot_count = 0;
+		p_other._free_slot = INVALID_INDEX;
+		p_other._order_capacity = 0;
+		p_other._used = 0;
+		p_other._size = 0;
+	}
+
+	explicit OrderedAHashMap(const OrderedAHashMap &p_other) {
+		_init_from(p_other);
+	}
+
+	void operator=(const OrderedAHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		reset();
+
+		_init_from(p_other);
+	}
+
+	OrderedAHashMap(uint32_t p_initial_capacity) {
+		// Capacity can't be 0 and must be 2^n - 1.
+		_capacity_mask = MAX(4u, p_initial_capacity);
+		_capacity_mask = Math::next_power_of_2(_capacity_mask) - 1;
+	}
+	OrderedAHashMap() :
+			_capacity_mask(INITIAL_CAPACITY - 1) {
+	}
+
+	void reset() {
+		if (_metadata != nullptr) {
+			clear();
+			for (uint32_t i = 0; i < _chunk_count; i++) {
+				Memory::free_static(_chunks[i]);
+			}
+			if (_chunks != nullptr) {
+				Memory::free_static(_chunks);
+			}
+			if (_slots != nullptr) {
+				Memory::free_static(_slots);
+			}
+			if (_order != nullptr) {
+				Memory::free_static(_order);
+			}
+			Memory::free_static(_metadata);
+			_metadata = nullptr;
+			_slots = nullptr;
+			_chunks = nullptr;
+			_order = nullptr;
+		}
+		_capacity_mask = INITIAL_CAPACITY - 1;
+		_chunk_count = 0;
+		_slot_capacity = 0;
+		_slot_count = 0;
+		_free_slot = INVALID_INDEX;
+		_order_capacity = 0;
+		_size = 0;
+		_used = 0;
+	}
+
+	~OrderedAHashMap() {
+		reset();
+	}
+};
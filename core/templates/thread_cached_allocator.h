@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*  thread_cached_allocator.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/memory.h"
+#include "core/os/spin_lock.h"
+#include "core/templates/paged_allocator.h"
+
+// Pool allocator for objects allocated and freed from many threads.
+// Each thread keeps a few free elements in its own `Cache`, and only takes the shared lock
+// to move a whole batch of them from or to the shared pool. Every thread needs its own
+// cache for every allocator, so caches are meant to be `thread_local`.
+template <typename T>
+class ThreadCachedAllocator {
+	// The shared pool only hands out memory, elements are constructed and destroyed here.
+	struct alignas(T) Storage {
+		uint8_t data[sizeof(T)];
+	};
+
+public:
+	static constexpr uint32_t BATCH_SIZE = 32;
+	static constexpr uint32_t CACHE_SIZE = BATCH_SIZE * 2;
+
+	struct Cache {
+		ThreadCachedAllocator *allocator = nullptr;
+		Storage *available[CACHE_SIZE];
+		uint32_t count = 0;
+		// Elements can still be freed while other thread locals are destroyed.
+		bool alive = true;
+
+		~Cache() {
+			if (allocator && count > 0) {
+				allocator->_release(available, count);
+			}
+			count = 0;
+			alive = false;
+		}
+	};
+
+private:
+	PagedAllocator<Storage> allocator;
+	SpinLock spin_lock;
+
+	void _acquire(Storage **r_elements, uint32_t p_count) {
+		spin_lock.lock();
+		for (uint32_t i = 0; i < p_count; i++) {
+			r_elements[i] = allocator.alloc();
+		}
+		spin_lock.unlock();
+	}
+
+	void _release(Storage *const *p_elements, uint32_t p_count) {
+		spin_lock.lock();
+		for (uint32_t i = 0; i < p_count; i++) {
+			allocator.free(p_elements[i]);
+		}
+		spin_lock.unlock();
+	}
+
+	_FORCE_INLINE_ Storage *_alloc_storage(Cache &p_cache) {
+		if (unlikely(!p_cache.alive)) {
+			Storage *storage;
+			_acquire(&storage, 1);
+			return storage;
+		}
+		if (unlikely(p_cache.count == 0)) {
+			p_cache.allocator = this;
+			_acquire(p_cache.available, BATCH_SIZE);
+			p_cache.count = BATCH_SIZE;
+		}
+		return p_cache.available[--p_cache.count];
+	}
+
+	_FORCE_INLINE_ void _free_storage(Cache &p_cache, Storage *p_storage) {
+		if (unlikely(!p_cache.alive)) {
+			_release(&p_storage, 1);
+			return;
+		}
+		if (unlikely(p_cache.count == CACHE_SIZE)) {
+			p_cache.count -= BATCH_SIZE;
+			_release(p_cache.available + p_cache.count, BATCH_SIZE);
+		}
+		p_cache.allocator = this;
+		p_cache.available[p_cache.count++] = p_storage;
+	}
+
+public:
+	template <typename... Args>
+	_FORCE_INLINE_ T *alloc(Cache &p_cache, Args &&...p_args) {
+		T *element = reinterpret_cast<T *>(_alloc_storage(p_cache));
+		memnew_placement(element, T(p_args...));
+		return element;
+	}
+
+	_FORCE_INLINE_ void free(Cache &p_cache, T *p_element) {
+		p_element->~T();
+		_free_storage(p_cache, reinterpret_cast<Storage *>(p_element));
+	}
+};
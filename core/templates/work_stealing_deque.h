@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*  work_stealing_deque.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/thread.h"
+#include "core/typedefs.h"
+
+#include <atomic>
+
+// Fixed-capacity Chase-Lev work-stealing deque.
+// See "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al., 2013).
+//
+// Design goals for this class:
+// - A single owner thread pushes and pops at the bottom end (LIFO), without locking.
+// - Any number of other threads can steal from the top end (FIFO), without locking.
+// - No allocations. When full, push() fails and the caller must fall back to another queue.
+
+// This is used in very specific areas of the engine where it's critical that these guarantees are held.
+
+template <typename T, uint32_t CAPACITY>
+class WorkStealingDeque {
+	static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "Capacity must be a power of two.");
+	static_assert(std::atomic<T>::is_always_lock_free);
+
+	static constexpr int64_t MASK = CAPACITY - 1;
+
+	// Kept on separate cache lines, since the owner hammers bottom while thieves hammer top.
+	// Like in SpinLock, align attributes aren't used because this may end up in semi-tightly packed arrays.
+	union {
+		std::atomic<int64_t> top = 0;
+		char top_aligner[Thread::CACHE_LINE_BYTES];
+	};
+	union {
+		std::atomic<int64_t> bottom = 0;
+		char bottom_aligner[Thread::CACHE_LINE_BYTES];
+	};
+	std::atomic<T> buffer[CAPACITY];
+
+public:
+	// Owner only.
+	_FORCE_INLINE_ bool push(T p_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed);
+		int64_t t = top.load(std::memory_order_acquire);
+		if (b - t >= (int64_t)CAPACITY) {
+			return false;
+		}
+		buffer[b & MASK].store(p_value, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	// Owner only.
+	_FORCE_INLINE_ bool pop(T &r_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t t = top.load(std::memory_order_relaxed);
+
+		if (t > b) {
+			// Empty.
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		r_value = buffer[b & MASK].load(std::memory_order_relaxed);
+		if (t == b) {
+			// Last element; race against thieves for it.
+			bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return won;
+		}
+		return true;
+	}
+
+	// Any thread. A failure while the deque is not empty means another thread won the race,
+	// so callers wanting to drain it should check is_empty() and retry.
+	_FORCE_INLINE_ bool steal(T &r_value) {
+		int64_t t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t b = bottom.load(std::memory_order_acquire);
+		if (t >= b) {
+			return false;
+		}
+
+		T value = buffer[t & MASK].load(std::memory_order_relaxed);
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			return false;
+		}
+		r_value = value;
+		return true;
+	}
+
+	// Any thread. Only a snapshot, which may be outdated as soon as it's returned.
+	_FORCE_INLINE_ uint32_t size() const {
+		int64_t b = bottom.load(std::memory_order_acquire);
+		int64_t t = top.load(std::memory_order_acquire);
+		return b > t ? uint32_t(b - t) : 0;
+	}
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return size() == 0;
+	}
+
+	_FORCE_INLINE_ constexpr uint32_t get_capacity() const {
+		return CAPACITY;
+	}
+
+	WorkStealingDeque() {
+		for (uint32_t i = 0; i < CAPACITY; i++) {
+			buffer[i].store(T(), std::memory_order_relaxed);
+		}
+	}
+};
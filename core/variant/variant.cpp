@@ -3398,6 +3398,10 @@ bool Variant::identity_compare(const Variant &p_variant) const {
 }
 
 bool StringLikeVariantComparator::compare(const Variant &p_lhs, const Variant &p_rhs) {
+	if (p_lhs.get_type() == Variant::STRING_NAME && p_rhs.get_type() == Variant::STRING_NAME) {
+		// Most common for dictionary keys. StringNames are unique, so comparing pointers is enough.
+		return *VariantInternal::get_string_name(&p_lhs) == *VariantInternal::get_string_name(&p_rhs);
+	}
 	if (p_lhs.hash_compare(p_rhs)) {
 		return true;
 	}
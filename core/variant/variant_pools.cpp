@@ -35,6 +35,7 @@
 #include "core/math/transform_2d.h"
 #include "core/math/transform_3d.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/thread_cached_allocator.h"
 
 namespace VariantPools {
 union BucketSmall {
@@ -64,6 +65,42 @@ static_assert(sizeof(BucketLarge) == VariantPools::BUCKET_LARGE);
 static_assert(alignof(BucketLarge) == alignof(real_t));
 } //namespace VariantPools
 
+#ifdef VARIANT_THREAD_POOLS_ENABLED
+
+// Each thread keeps a few free buckets of every size, see ThreadCachedAllocator.
+static ThreadCachedAllocator<VariantPools::BucketSmall> _bucket_small;
+static ThreadCachedAllocator<VariantPools::BucketMedium> _bucket_medium;
+static ThreadCachedAllocator<VariantPools::BucketLarge> _bucket_large;
+static thread_local ThreadCachedAllocator<VariantPools::BucketSmall>::Cache _bucket_small_cache;
+static thread_local ThreadCachedAllocator<VariantPools::BucketMedium>::Cache _bucket_medium_cache;
+static thread_local ThreadCachedAllocator<VariantPools::BucketLarge>::Cache _bucket_large_cache;
+
+void *VariantPools::alloc_small() {
+	return _bucket_small.alloc(_bucket_small_cache);
+}
+
+void *VariantPools::alloc_medium() {
+	return _bucket_medium.alloc(_bucket_medium_cache);
+}
+
+void *VariantPools::alloc_large() {
+	return _bucket_large.alloc(_bucket_large_cache);
+}
+
+void VariantPools::free_small(void *p_ptr) {
+	_bucket_small.free(_bucket_small_cache, static_cast<VariantPools::BucketSmall *>(p_ptr));
+}
+
+void VariantPools::free_medium(void *p_ptr) {
+	_bucket_medium.free(_bucket_medium_cache, static_cast<VariantPools::BucketMedium *>(p_ptr));
+}
+
+void VariantPools::free_large(void *p_ptr) {
+	_bucket_large.free(_bucket_large_cache, static_cast<VariantPools::BucketLarge *>(p_ptr));
+}
+
+#else
+
 static PagedAllocator<VariantPools::BucketSmall, true> _bucket_small;
 static PagedAllocator<VariantPools::BucketMedium, true> _bucket_medium;
 static PagedAllocator<VariantPools::BucketLarge, true> _bucket_large;
@@ -91,3 +128,5 @@ void VariantPools::free_medium(void *p_ptr) {
 void VariantPools::free_large(void *p_ptr) {
 	_bucket_large.free(static_cast<BucketLarge *>(p_ptr));
 }
+
+#endif // VARIANT_THREAD_POOLS_ENABLED
@@ -35,6 +35,9 @@
 #include "core/string/ustring.h"
 
 #include <fcntl.h>
+#if !defined(WEB_ENABLED)
+#include <sys/mman.h>
+#endif
 #include <sys/stat.h>
 #include <sys/types.h>
 #if !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__NetBSD__) && !defined(WEB_ENABLED)
@@ -198,11 +201,54 @@ Error FileAccessUnix::open_internal(const String &p_path, int p_mode_flags) {
 	return OK;
 }
 
+bool FileAccessUnix::_map() const {
+#if defined(WEB_ENABLED)
+	return false;
+#else
+	if (mapping) {
+		return true;
+	}
+	if (mapping_failed || flags != READ) {
+		return false;
+	}
+	mapping_failed = true;
+
+	const int fd = fileno(f);
+	struct stat st = {};
+	if (fd == -1 || fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+		return false;
+	}
+	if (sizeof(void *) < 8 && st.st_size > (64 << 20)) {
+		// Don't exhaust the address space of 32-bit builds with big files.
+		return false;
+	}
+
+	void *mem = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (mem == MAP_FAILED) {
+		return false;
+	}
+
+	mapping = (uint8_t *)mem;
+	mapping_size = st.st_size;
+	mapping_failed = false;
+	return true;
+#endif
+}
+
 void FileAccessUnix::_close() {
 	if (!f) {
 		return;
 	}
 
+#if !defined(WEB_ENABLED)
+	if (mapping) {
+		munmap(mapping, mapping_size);
+	}
+#endif
+	mapping = nullptr;
+	mapping_size = 0;
+	mapping_failed = false;
+
 	fclose(f);
 	f = nullptr;
 
@@ -308,6 +354,25 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+Span<uint8_t> FileAccessUnix::get_buffer_view(uint64_t p_length) const {
+	ERR_FAIL_NULL_V_MSG(f, Span<uint8_t>(), "File must be opened before use.");
+
+	if (p_length == 0 || !_map()) {
+		return Span<uint8_t>();
+	}
+
+	const int64_t pos = ftello(f);
+	if (pos < 0 || p_length > mapping_size - MIN((uint64_t)pos, mapping_size)) {
+		return Span<uint8_t>();
+	}
+	if (fseeko(f, pos + p_length, SEEK_SET)) {
+		check_errors();
+		return Span<uint8_t>();
+	}
+
+	return Span<uint8_t>(mapping + pos, p_length);
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -50,6 +50,7 @@
 #include "core/object/class_db.h"
 #include "core/object/message_queue.h"
 #include "core/object/script_language.h"
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "core/os/process_id.h"
 #include "core/os/time.h"
@@ -78,6 +79,7 @@
 #include "servers/register_server_types.h"
 #include "servers/rendering/rendering_device.h"
 #include "servers/rendering/rendering_server.h"
+#include "servers/rendering/rendering_server_capture.h"
 #include "servers/rendering/rendering_server_default.h"
 #include "servers/text/text_server.h"
 #include "servers/text/text_server_dummy.h"
@@ -280,6 +282,10 @@ static int audio_output_latency = 0;
 static bool disable_render_loop = false;
 static int fixed_fps = -1;
 static MovieWriter *movie_writer = nullptr;
+static RenderingServerCapture *rendering_capture = nullptr;
+static String rendering_capture_path;
+static int rendering_capture_frames = 0;
+static String rendering_replay_path;
 static bool disable_vsync = false;
 static bool print_fps = false;
 #ifdef TOOLS_ENABLED
@@ -625,6 +631,10 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("", "--fixed-fps is forced when enabled, but it can be used to change movie FPS.\n");
 	print_help_option("", "--disable-vsync can speed up movie writing but makes interaction more difficult.\n");
 	print_help_option("", "--quit-after can be used to specify the number of frames to write.\n");
+	print_help_option("--rendering-capture <file>", "Record the calls made to the RenderingServer to the specified path, for use with --rendering-replay.\n");
+	print_help_option("--rendering-capture-frames <N>", "Stop recording the rendering capture after N frames (0 records until exit).\n");
+	print_help_option("--rendering-replay <file>", "Replay a rendering capture without running the project, then print frame timings and exit.\n");
+	print_help_option("", "Combine with --headless to measure the CPU side of rendering against the dummy rasterizer.\n");
 
 	print_help_title("Display options");
 	print_help_option("-f, --fullscreen", "Request fullscreen mode.\n");
@@ -1917,6 +1927,30 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 				OS::get_singleton()->print("Missing write-movie argument, aborting.\n");
 				goto error;
 			}
+		} else if (arg == "--rendering-capture") {
+			if (N) {
+				rendering_capture_path = N->get();
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing rendering-capture argument, aborting.\n");
+				goto error;
+			}
+		} else if (arg == "--rendering-capture-frames") {
+			if (N) {
+				rendering_capture_frames = N->get().to_int();
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing rendering-capture-frames argument, aborting.\n");
+				goto error;
+			}
+		} else if (arg == "--rendering-replay") {
+			if (N) {
+				rendering_replay_path = N->get();
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing rendering-replay argument, aborting.\n");
+				goto error;
+			}
 		} else if (arg == "--disable-vsync") {
 			disable_vsync = true;
 		} else if (arg == "--print-fps") {
@@ -3519,6 +3553,11 @@ Error Main::setup2(bool p_show_boot_logo) {
 			rendering_server->set_print_gpu_profile(true);
 		}
 
+		if (!rendering_capture_path.is_empty()) {
+			rendering_capture = memnew(RenderingServerCapture);
+			rendering_capture->start(rendering_capture_path, rendering_capture_frames);
+		}
+
 		OS::get_singleton()->benchmark_end_measure("Servers", "Rendering");
 	}
 
@@ -4266,6 +4305,10 @@ int Main::start() {
 
 #endif // TOOLS_ENABLED
 
+	if (!rendering_replay_path.is_empty()) {
+		return RenderingServerCapture::replay(rendering_replay_path) == OK ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
 #if defined(OVERRIDE_PATH_ENABLED)
 	bool disable_override = GLOBAL_GET("application/config/disable_project_settings_override");
 	if (disable_override) {
@@ -4870,6 +4913,8 @@ bool Main::iteration() {
 	GodotProfileZoneGroupedFirst(_profile_zone, "prepare");
 	iterating++;
 
+	FrameArena::begin_frame();
+
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 	Engine::get_singleton()->_frame_ticks = ticks;
 	main_timer_sync.set_cpu_ticks_usec(ticks);
@@ -5183,6 +5228,11 @@ void Main::cleanup(bool p_force) {
 		movie_writer->end();
 	}
 
+	if (rendering_capture) {
+		memdelete(rendering_capture);
+		rendering_capture = nullptr;
+	}
+
 	ResourceLoader::clear_thread_load_tasks();
 
 	ResourceLoader::remove_custom_loaders();
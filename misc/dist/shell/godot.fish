@@ -68,6 +68,9 @@ complete -c godot -l tablet-driver -d "Set the pen tablet input driver" -x
 complete -c godot -l headless -d "Enable headless mode (--display-driver headless --audio-driver Dummy). Useful for servers and with --script"
 complete -c godot -l log-file -d "Write output/error log to the specified path instead of the default location defined by the project" -x
 complete -c godot -l write-movie -d "Write a video to the specified path (usually with .avi or .png extension). --fixed-fps is forced when enabled" -x
+complete -c godot -l rendering-capture -d "Record the calls made to the RenderingServer to the specified path" -x
+complete -c godot -l rendering-capture-frames -d "Stop recording the rendering capture after the given number of frames" -x
+complete -c godot -l rendering-replay -d "Replay a rendering capture, then print frame timings and exit" -x
 
 # Display options:
 complete -c godot -s f -l fullscreen -d "Request fullscreen mode"
@@ -383,6 +383,11 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_methods_count = 0;
 	}
 
+	if (inline_cache_count) {
+		function->_inline_caches_ptr = memnew_arr(GDScriptFunction::InlineCache, inline_cache_count);
+		function->_inline_caches_count = inline_cache_count;
+	}
+
 	if (lambdas_map.size()) {
 		function->lambdas.resize(lambdas_map.size());
 		function->_lambdas_ptr = function->lambdas.ptrw();
@@ -862,6 +867,7 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -880,6 +886,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -1093,6 +1100,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1118,6 +1126,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1352,6 +1361,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1365,6 +1375,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1378,6 +1389,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
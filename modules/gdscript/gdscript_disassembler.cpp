@@ -309,7 +309,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "\"] = ";
 				text += DADDR(2);
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_SET_NAMED_VALIDATED: {
 				text += "set_named validated ";
@@ -330,7 +330,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -709,7 +709,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
@@ -33,6 +33,7 @@
 #include "gdscript.h"
 
 #include "core/object/class_db.h"
+#include "scene/scene_string_names.h"
 
 bool GDScriptDataType::is_type(const Variant &p_variant, bool p_allow_implicit_conversion) const {
 	switch (kind) {
@@ -240,6 +241,27 @@ GDScriptFunction::~GDScriptFunction() {
 		memdelete(lambdas[i]);
 	}
 
+	// Other functions may have cached a pointer to this one.
+	invalidate_inline_caches();
+
+	for (int i = 0; i < _inline_caches_count; i++) {
+		for (int j = 0; j < InlineCache::SLOTS; j++) {
+			InlineCacheEntry *entry = _inline_caches_ptr[i].entries[j].load(std::memory_order_relaxed);
+			if (entry) {
+				memdelete(entry);
+			}
+		}
+	}
+	if (_inline_caches_ptr) {
+		memdelete_arr(_inline_caches_ptr);
+	}
+	InlineCacheEntry *retired = _inline_caches_retired.load(std::memory_order_relaxed);
+	while (retired) {
+		InlineCacheEntry *next = retired->next_retired;
+		memdelete(retired);
+		retired = next;
+	}
+
 	for (int i = 0; i < argument_types.size(); i++) {
 		argument_types.write[i].script_type_ref = Ref<Script>();
 	}
@@ -251,6 +273,328 @@ GDScriptFunction::~GDScriptFunction() {
 #endif
 }
 
+SafeNumeric<uint64_t> GDScriptFunction::inline_cache_generation;
+
+// Mirrors the lookup order of `ClassDB::get_property()` and `ClassDB::set_property()`,
+// returning the accessor only when it can be called directly.
+static MethodBind *_find_native_property_accessor(const Object *p_object, const StringName &p_name, bool p_setter) {
+	const ClassDB::ClassInfo *check = ClassDB::classes.getptr(p_object->get_class_name());
+	if (!check || check->gdextension) {
+		// Extensions get a chance to handle properties first.
+		return nullptr;
+	}
+	while (check) {
+		const ClassDB::PropertySetGet *psg = check->property_setget.getptr(p_name);
+		if (psg) {
+			if (psg->index >= 0) {
+				return nullptr;
+			}
+			return p_setter ? psg->_setptr : psg->_getptr;
+		}
+		if (!p_setter) {
+			if (check->gdtype->get_integer_constant_map(true).getptr(p_name) || check->method_map.has(p_name) || check->gdtype->get_signal_map(true).has(p_name)) {
+				return nullptr;
+			}
+		}
+		check = check->inherits_ptr;
+	}
+	return nullptr;
+}
+
+static MethodBind *_find_native_method(const Object *p_object, const StringName &p_name) {
+	// These dispatch calls themselves before falling back to `Object::callp()`.
+	if (Object::cast_to<Script>(p_object) || Object::cast_to<GDScriptNativeClass>(p_object)) {
+		return nullptr;
+	}
+	return ClassDB::get_method(p_object->get_class_name(), p_name);
+}
+
+const GDScriptFunction::InlineCacheEntry *GDScriptFunction::_inline_cache_lookup(InlineCache &p_cache, Object *p_object, GDScriptInstance *&r_instance, bool &r_resolve) const {
+	r_instance = nullptr;
+	r_resolve = false;
+
+	ScriptInstance *script_instance = p_object->get_script_instance();
+	if (script_instance) {
+		if (script_instance->is_placeholder() || script_instance->get_language() != GDScriptLanguage::get_singleton()) {
+			return nullptr;
+		}
+		r_instance = static_cast<GDScriptInstance *>(script_instance);
+	}
+
+	const GDScript *script = r_instance ? r_instance->script.ptr() : nullptr;
+	const GDType *type = &p_object->get_gdtype();
+	const uint64_t generation = inline_cache_generation.get();
+
+	for (int i = 0; i < InlineCache::SLOTS; i++) {
+		const InlineCacheEntry *entry = p_cache.entries[i].load(std::memory_order_acquire);
+		if (!entry) {
+			// Slots are filled in order.
+			r_resolve = true;
+			break;
+		}
+		if (entry->generation != generation) {
+			r_resolve = true;
+			continue;
+		}
+		if (entry->script == script && entry->type == type) {
+			return entry;
+		}
+	}
+	return nullptr;
+}
+
+GDScriptFunction::InlineCacheEntry *GDScriptFunction::_inline_cache_new_entry(Object *p_object, GDScriptInstance *p_instance) const {
+	InlineCacheEntry *entry = memnew(InlineCacheEntry);
+	entry->generation = inline_cache_generation.get();
+	entry->script = p_instance ? p_instance->script.ptr() : nullptr;
+	entry->type = &p_object->get_gdtype();
+	return entry;
+}
+
+bool GDScriptFunction::_inline_cache_insert(InlineCache &p_cache, InlineCacheEntry *p_entry) {
+	for (int i = 0; i < InlineCache::SLOTS; i++) {
+		InlineCacheEntry *current = p_cache.entries[i].load(std::memory_order_acquire);
+		while (!current || current->generation < p_entry->generation) {
+			if (p_cache.entries[i].compare_exchange_weak(current, p_entry, std::memory_order_acq_rel, std::memory_order_acquire)) {
+				if (current) {
+					// Other threads may still be reading the stale entry, keep it until this function is freed.
+					current->next_retired = _inline_caches_retired.load(std::memory_order_relaxed);
+					while (!_inline_caches_retired.compare_exchange_weak(current->next_retired, current, std::memory_order_release, std::memory_order_relaxed)) {
+					}
+				}
+				return true;
+			}
+		}
+	}
+	// Megamorphic, every slot holds a live entry.
+	return false;
+}
+
+bool GDScriptFunction::_inline_cache_get(InlineCache &p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return false;
+	}
+
+	GDScriptInstance *instance;
+	bool resolve;
+	const InlineCacheEntry *entry = _inline_cache_lookup(p_cache, obj, instance, resolve);
+	if (!entry) {
+		if (!resolve) {
+			return false;
+		}
+
+		// Mirrors `Object::get()` and `GDScriptInstance::get()`.
+		InlineCacheEntry *new_entry = _inline_cache_new_entry(obj, instance);
+		const GDScript *script = instance ? instance->script.ptr() : nullptr;
+		bool native = true;
+		if (script) {
+			native = false;
+			HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(p_name);
+			if (!script->valid) {
+				// Generic.
+			} else if (E) {
+				if (!E->value.getter) {
+					new_entry->kind = InlineCacheEntry::KIND_SCRIPT_MEMBER;
+					new_entry->member_index = E->value.index;
+				}
+			} else {
+				native = true;
+				for (const GDScript *sptr = script; sptr; sptr = sptr->base.ptr()) {
+					if (sptr->constants.has(p_name) || sptr->static_variables_indices.has(p_name) || sptr->_signals.has(p_name) || sptr->subclasses.has(p_name) ||
+							(sptr->valid && (sptr->member_functions.has(p_name) || sptr->member_functions.has(GDScriptLanguage::get_singleton()->strings._get)))) {
+						native = false;
+						break;
+					}
+				}
+			}
+		}
+		if (native) {
+			new_entry->method = _find_native_property_accessor(obj, p_name, false);
+			if (new_entry->method) {
+				new_entry->kind = InlineCacheEntry::KIND_NATIVE_METHOD;
+			}
+		}
+
+		if (!_inline_cache_insert(p_cache, new_entry)) {
+			memdelete(new_entry);
+			return false;
+		}
+		entry = new_entry;
+	}
+
+	switch (entry->kind) {
+		case InlineCacheEntry::KIND_SCRIPT_MEMBER: {
+			if (unlikely(&r_ret == p_base)) {
+				// Assigning in place could release the receiver before the member is copied.
+				r_ret = Variant(instance->members[entry->member_index]);
+			} else {
+				r_ret = instance->members[entry->member_index];
+			}
+			return true;
+		}
+		case InlineCacheEntry::KIND_NATIVE_METHOD: {
+			Callable::CallError ce;
+			r_ret = entry->method->call(obj, nullptr, 0, ce);
+			return true;
+		}
+		default: {
+			return false;
+		}
+	}
+}
+
+bool GDScriptFunction::_inline_cache_set(InlineCache &p_cache, Variant *p_base, const StringName &p_name, const Variant *p_value, bool &r_valid) {
+#ifdef TOOLS_ENABLED
+	// `Object::set()` also flags the object as edited, which can't be done from here.
+	return false;
+#else
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return false;
+	}
+
+	GDScriptInstance *instance;
+	bool resolve;
+	const InlineCacheEntry *entry = _inline_cache_lookup(p_cache, obj, instance, resolve);
+	if (!entry) {
+		if (!resolve) {
+			return false;
+		}
+
+		// Mirrors `Object::set()` and `GDScriptInstance::set()`.
+		InlineCacheEntry *new_entry = _inline_cache_new_entry(obj, instance);
+		const GDScript *script = instance ? instance->script.ptr() : nullptr;
+		bool native = true;
+		if (script) {
+			native = false;
+			HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(p_name);
+			if (!script->valid) {
+				// Generic.
+			} else if (E) {
+				if (!E->value.setter) {
+					new_entry->kind = InlineCacheEntry::KIND_SCRIPT_MEMBER;
+					new_entry->member_index = E->value.index;
+					new_entry->member_type = &E->value.data_type;
+				}
+			} else {
+				native = true;
+				for (const GDScript *sptr = script; sptr; sptr = sptr->base.ptr()) {
+					if (sptr->static_variables_indices.has(p_name) || (sptr->valid && sptr->member_functions.has(GDScriptLanguage::get_singleton()->strings._set))) {
+						native = false;
+						break;
+					}
+				}
+			}
+		}
+		if (native) {
+			new_entry->method = _find_native_property_accessor(obj, p_name, true);
+			if (new_entry->method) {
+				new_entry->kind = InlineCacheEntry::KIND_NATIVE_METHOD;
+			}
+		}
+
+		if (!_inline_cache_insert(p_cache, new_entry)) {
+			memdelete(new_entry);
+			return false;
+		}
+		entry = new_entry;
+	}
+
+	switch (entry->kind) {
+		case InlineCacheEntry::KIND_SCRIPT_MEMBER: {
+			if (!entry->member_type->is_type(*p_value)) {
+				// Needs a conversion.
+				return false;
+			}
+			instance->members.write[entry->member_index] = *p_value;
+			r_valid = true;
+			return true;
+		}
+		case InlineCacheEntry::KIND_NATIVE_METHOD: {
+			Callable::CallError ce;
+			entry->method->call(obj, &p_value, 1, ce);
+			r_valid = ce.error == Callable::CallError::CALL_OK;
+			return true;
+		}
+		default: {
+			return false;
+		}
+	}
+#endif
+}
+
+bool GDScriptFunction::_inline_cache_call(InlineCache &p_cache, Variant *p_base, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return false;
+	}
+
+	GDScriptInstance *instance;
+	bool resolve;
+	const InlineCacheEntry *entry = _inline_cache_lookup(p_cache, obj, instance, resolve);
+	if (!entry) {
+		if (!resolve) {
+			return false;
+		}
+
+		// Mirrors `Object::callp()` and `GDScriptInstance::callp()`.
+		InlineCacheEntry *new_entry = _inline_cache_new_entry(obj, instance);
+		if (p_name != CoreStringName(free_) && p_name != SceneStringName(_ready)) {
+			for (const GDScript *sptr = instance ? instance->script.ptr() : nullptr; sptr; sptr = sptr->base.ptr()) {
+				if (likely(sptr->valid)) {
+					HashMap<StringName, GDScriptFunction *>::ConstIterator E = sptr->member_functions.find(p_name);
+					if (E) {
+						new_entry->kind = InlineCacheEntry::KIND_SCRIPT_FUNCTION;
+						new_entry->function = E->value;
+						break;
+					}
+				}
+			}
+			if (new_entry->kind == InlineCacheEntry::KIND_GENERIC) {
+				new_entry->method = _find_native_method(obj, p_name);
+				if (new_entry->method) {
+					new_entry->kind = InlineCacheEntry::KIND_NATIVE_METHOD;
+				}
+			}
+		}
+
+		if (!_inline_cache_insert(p_cache, new_entry)) {
+			memdelete(new_entry);
+			return false;
+		}
+		entry = new_entry;
+	}
+
+#ifdef DEBUG_ENABLED
+	// Same guard as `Object::callp()`, so a callee can't free its own receiver.
+	_ObjectDebugLock debug_lock(obj);
+#endif
+
+	switch (entry->kind) {
+		case InlineCacheEntry::KIND_SCRIPT_FUNCTION: {
+			r_ret = entry->function->call(instance, p_args, p_argcount, r_err);
+			return true;
+		}
+		case InlineCacheEntry::KIND_NATIVE_METHOD: {
+			r_ret = entry->method->call(obj, p_args, p_argcount, r_err);
+			return true;
+		}
+		default: {
+			return false;
+		}
+	}
+}
+
 /////////////////////
 
 Variant GDScriptFunctionState::_signal_callback(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
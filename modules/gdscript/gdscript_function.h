@@ -40,6 +40,8 @@
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
 
+#include <atomic>
+
 class GDScriptInstance;
 class GDScript;
 
@@ -337,6 +339,34 @@ public:
 		StringName identifier;
 	};
 
+	// Caches what an untyped `OPCODE_GET_NAMED`, `OPCODE_SET_NAMED` or `OPCODE_CALL*`
+	// resolved to for a given script and native class, so repeated executions on the
+	// same kind of object skip the name lookups. Entries are immutable once published
+	// and only valid for the generation they were resolved in.
+	struct InlineCacheEntry {
+		enum Kind {
+			KIND_GENERIC, // Resolved, but must go through the generic path.
+			KIND_SCRIPT_MEMBER,
+			KIND_SCRIPT_FUNCTION,
+			KIND_NATIVE_METHOD,
+		};
+
+		uint64_t generation = 0;
+		const GDScript *script = nullptr;
+		const GDType *type = nullptr;
+		Kind kind = KIND_GENERIC;
+		int member_index = -1;
+		const GDScriptDataType *member_type = nullptr;
+		GDScriptFunction *function = nullptr;
+		MethodBind *method = nullptr;
+		InlineCacheEntry *next_retired = nullptr;
+	};
+
+	struct InlineCache {
+		static constexpr int SLOTS = 4;
+		std::atomic<InlineCacheEntry *> entries[SLOTS] = {};
+	};
+
 private:
 	friend class GDScript;
 	friend class GDScriptCompiler;
@@ -417,6 +447,11 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	InlineCache *_inline_caches_ptr = nullptr;
+	int _inline_caches_count = 0;
+	std::atomic<InlineCacheEntry *> _inline_caches_retired = nullptr;
+
+	static SafeNumeric<uint64_t> inline_cache_generation;
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
@@ -455,6 +490,13 @@ private:
 	String _get_callable_call_error(const String &p_where, const Callable &p_callable, const Variant **p_argptrs, int p_argcount, const Variant &p_ret, const Callable::CallError &p_err) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
+	const InlineCacheEntry *_inline_cache_lookup(InlineCache &p_cache, Object *p_object, GDScriptInstance *&r_instance, bool &r_resolve) const;
+	bool _inline_cache_insert(InlineCache &p_cache, InlineCacheEntry *p_entry);
+	InlineCacheEntry *_inline_cache_new_entry(Object *p_object, GDScriptInstance *p_instance) const;
+	bool _inline_cache_get(InlineCache &p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret);
+	bool _inline_cache_set(InlineCache &p_cache, Variant *p_base, const StringName &p_name, const Variant *p_value, bool &r_valid);
+	bool _inline_cache_call(InlineCache &p_cache, Variant *p_base, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
 
@@ -487,6 +529,9 @@ public:
 	Variant get_constant(int p_idx) const;
 	StringName get_global_name(int p_idx) const;
 
+	// Invalidates every inline cache, must be called whenever script layouts or functions change.
+	static void invalidate_inline_caches() { inline_cache_generation.increment(); }
+
 	Variant call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state = nullptr);
 	void debug_get_stack_member_state(int p_line, List<Pair<StringName, int>> *r_stackvars) const;
 
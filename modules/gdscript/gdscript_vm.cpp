@@ -1202,7 +1202,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1212,8 +1212,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
+
 				bool valid;
-				dst->set_named(*index, *value, valid);
+				if (!_inline_cache_set(_inline_caches_ptr[cache_idx], dst, *index, value, valid)) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1234,7 +1239,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1254,7 +1259,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1264,13 +1269,20 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
+
+				bool valid = true;
 #ifdef DEBUG_ENABLED
 				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
-
+				Variant ret;
+				if (!_inline_cache_get(_inline_caches_ptr[cache_idx], src, *index, ret)) {
+					ret = src->get_named(*index, valid);
+				}
 #else
-				*dst = src->get_named(*index, valid);
+				if (!_inline_cache_get(_inline_caches_ptr[cache_idx], src, *index, *dst)) {
+					*dst = src->get_named(*index, valid);
+				}
 #endif
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1279,7 +1291,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 				*dst = ret;
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1902,7 +1914,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1913,6 +1925,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int cache_idx = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
+				InlineCache &cache = _inline_caches_ptr[cache_idx];
+
 				GodotProfileZoneScriptSystemCall(methodname, source, name, *methodname, line);
 
 				GET_INSTRUCTION_ARG(base, argc);
@@ -1933,7 +1949,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					if (!_inline_cache_call(cache, base, *methodname, (const Variant **)argptrs, argc, temp_ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					}
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
@@ -1962,7 +1980,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						}
 					}
 #endif
-				} else {
+				} else if (!_inline_cache_call(cache, base, *methodname, (const Variant **)argptrs, argc, temp_ret, err)) {
 					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
 				}
 #ifdef DEBUG_ENABLED
@@ -2018,7 +2036,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif // DEBUG_ENABLED
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -0,0 +1,59 @@
+# Untyped property access and calls resolve per object, whatever the same site saw before.
+
+class A:
+	var value = 1
+	func describe():
+		return "A %s" % value
+
+class B extends A:
+	var extra: float = 0.5
+	func describe():
+		return "B %s" % value
+
+class C:
+	var value = "c"
+	var guarded := 0:
+		set(v):
+			guarded = v * 2
+	func describe():
+		return "C %s %s" % [value, guarded]
+
+class D:
+	var value = [4]
+	func describe():
+		return "D %s" % [value]
+
+class E:
+	var value = null
+	func describe():
+		return "E %s" % value
+
+func describe_all(objects):
+	for object in objects:
+		print(object.describe())
+
+func test():
+	var objects = [A.new(), B.new(), C.new(), D.new(), E.new()]
+	describe_all(objects)
+
+	for object in objects:
+		object.value = object.value
+		print(object.value)
+
+	var resource = Resource.new()
+	for object in [resource, objects[0], resource]:
+		print(object.get_class())
+
+	# Goes through the setter every time.
+	var c = objects[2]
+	for i in 3:
+		c.guarded = i
+		print(c.guarded)
+
+	# Needs a conversion from int.
+	var b = objects[1]
+	for i in 2:
+		b.extra = i
+		print(typeof(b.extra) == TYPE_FLOAT, b.extra == float(i))
+
+	describe_all(objects)
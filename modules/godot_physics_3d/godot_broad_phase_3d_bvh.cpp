@@ -32,6 +32,9 @@
 
 #include "godot_collision_object_3d.h"
 
+// Below this many moved objects per step, threading the pair queries costs more than it saves.
+#define PARALLEL_PAIRING_THRESHOLD 128
+
 GodotBroadPhase3DBVH::ID GodotBroadPhase3DBVH::create(GodotCollisionObject3D *p_object, int p_subindex, const AABB &p_aabb, bool p_static) {
 	uint32_t tree_id = p_static ? TREE_STATIC : TREE_DYNAMIC;
 	uint32_t tree_collision_mask = p_static ? TREE_FLAG_DYNAMIC : (TREE_FLAG_STATIC | TREE_FLAG_DYNAMIC);
@@ -125,4 +128,5 @@ GodotBroadPhase3D *GodotBroadPhase3DBVH::_create() {
 GodotBroadPhase3DBVH::GodotBroadPhase3DBVH() {
 	bvh.set_pair_callback(_pair_callback, this);
 	bvh.set_unpair_callback(_unpair_callback, this);
+	bvh.params_set_parallel_pairing_threshold(PARALLEL_PAIRING_THRESHOLD);
 }
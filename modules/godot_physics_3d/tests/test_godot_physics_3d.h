@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  test_godot_physics_3d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_physics_server_3d.h"
+
+#include "core/os/os.h"
+#include "tests/test_macros.h"
+
+namespace TestGodotPhysics3D {
+
+struct PileScene {
+	GodotPhysicsServer3D *server = nullptr;
+	RID space;
+	RID floor_shape;
+	RID sphere_shape;
+	RID floor;
+	LocalVector<RID> bodies;
+
+	// Spheres dropped in a loose grid, so they collide with the floor and their neighbors.
+	PileScene(int p_side, int p_layers) {
+		server = memnew(GodotPhysicsServer3D(false));
+		server->init();
+
+		space = server->space_create();
+		server->space_set_active(space, true);
+
+		floor_shape = server->box_shape_create();
+		server->shape_set_data(floor_shape, Vector3(p_side, 1, p_side));
+		floor = server->body_create();
+		server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+		server->body_add_shape(floor, floor_shape);
+		server->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, -1, 0)));
+		server->body_set_space(floor, space);
+
+		sphere_shape = server->sphere_shape_create();
+		server->shape_set_data(sphere_shape, 0.5);
+		for (int y = 0; y < p_layers; y++) {
+			for (int z = 0; z < p_side; z++) {
+				for (int x = 0; x < p_side; x++) {
+					RID body = server->body_create();
+					server->body_add_shape(body, sphere_shape);
+					// Odd layers are offset, so the pile doesn't stay perfectly stacked.
+					Vector3 offset = (y % 2) ? Vector3(0.45, 0, 0.45) : Vector3();
+					Vector3 origin = Vector3(x - p_side * 0.5, 0.5 + y * 1.05, z - p_side * 0.5) + offset;
+					server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), origin));
+					server->body_set_space(body, space);
+					bodies.push_back(body);
+				}
+			}
+		}
+
+		server->set_active(true);
+	}
+
+	void step(int p_steps) {
+		for (int i = 0; i < p_steps; i++) {
+			server->step(1.0 / 60.0);
+			server->flush_queries();
+		}
+	}
+
+	~PileScene() {
+		for (const RID &body : bodies) {
+			server->free_rid(body);
+		}
+		server->free_rid(floor);
+		server->free_rid(sphere_shape);
+		server->free_rid(floor_shape);
+		server->free_rid(space);
+		server->finish();
+		memdelete(server);
+	}
+};
+
+TEST_CASE("[GodotPhysics3D] Pile of spheres settles on the floor") {
+	// Enough moving bodies for the broadphase to query pairs on the WorkerThreadPool.
+	PileScene scene(16, 2);
+	scene.step(60);
+
+	CHECK_MESSAGE(scene.server->get_process_info(PhysicsServer3D::INFO_COLLISION_PAIRS) > 0, "Spheres should be colliding.");
+
+	bool all_above_floor = true;
+	for (const RID &body : scene.bodies) {
+		Transform3D xform = scene.server->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+		all_above_floor &= xform.origin.y > 0.0;
+	}
+	CHECK_MESSAGE(all_above_floor, "No sphere should have fallen through the floor.");
+}
+
+TEST_CASE_BENCHMARK("[GodotPhysics3D][Benchmark] Step a pile of 5000 rigid bodies") {
+	PileScene scene(25, 8);
+
+	// Let the pile collapse first, so most bodies are touching.
+	scene.step(30);
+
+	const int steps = 120;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	scene.step(steps);
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	String result = vformat("%d bodies, %d pairs, %d islands: %.3f ms/step.",
+			scene.bodies.size(), scene.server->get_process_info(PhysicsServer3D::INFO_COLLISION_PAIRS), scene.server->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT), elapsed / 1000.0 / steps);
+	MESSAGE(result.utf8().get_data());
+	CHECK(scene.server->get_process_info(PhysicsServer3D::INFO_COLLISION_PAIRS) > 0);
+}
+
+} // namespace TestGodotPhysics3D
@@ -966,6 +966,18 @@ void AudioStreamPlaybackInteractive::_mix_internal_state(int p_state_idx, int p_
 	}
 }
 
+bool AudioStreamPlaybackInteractive::can_mix_on_helper_thread() const {
+	if (!AudioStreamPlayback::can_mix_on_helper_thread()) {
+		return false;
+	}
+	for (int i = 0; i < stream->clip_count; i++) {
+		if (states[i].playback.is_valid() && !states[i].playback->can_mix_on_helper_thread()) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void AudioStreamPlaybackInteractive::tag_used_streams() {
 	for (int i = 0; i < stream->clip_count; i++) {
 		if (states[i].active && !states[i].first_mix && states[i].playback->is_playing()) {
@@ -369,6 +369,18 @@ int AudioStreamPlaybackPlaylist::mix(AudioFrame *p_buffer, float p_rate_scale, i
 	return p_frames;
 }
 
+bool AudioStreamPlaybackPlaylist::can_mix_on_helper_thread() const {
+	if (!AudioStreamPlayback::can_mix_on_helper_thread()) {
+		return false;
+	}
+	for (int i = 0; i < playlist->stream_count; i++) {
+		if (playback[i].is_valid() && !playback[i]->can_mix_on_helper_thread()) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void AudioStreamPlaybackPlaylist::tag_used_streams() {
 	if (active) {
 		playlist->audio_streams[play_order[play_index]]->tag_used(playback[play_order[play_index]]->get_playback_position());
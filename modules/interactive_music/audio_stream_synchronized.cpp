@@ -263,6 +263,18 @@ int AudioStreamPlaybackSynchronized::mix(AudioFrame *p_buffer, float p_rate_scal
 	return p_frames;
 }
 
+bool AudioStreamPlaybackSynchronized::can_mix_on_helper_thread() const {
+	if (!AudioStreamPlayback::can_mix_on_helper_thread()) {
+		return false;
+	}
+	for (int i = 0; i < stream->stream_count; i++) {
+		if (playback[i].is_valid() && !playback[i]->can_mix_on_helper_thread()) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void AudioStreamPlaybackSynchronized::tag_used_streams() {
 	if (active) {
 		for (int i = 0; i < stream->stream_count; i++) {
@@ -111,6 +111,7 @@ public:
 	virtual double get_playback_position() const override;
 	virtual void seek(double p_time) override;
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override;
+	virtual bool can_mix_on_helper_thread() const override;
 
 	virtual void tag_used_streams() override;
 
@@ -160,10 +160,8 @@ private:
 	HashMap<RID, Scenario> scenarios;
 	HashMap<RID, RaycastHZBuffer> buffers;
 	RSE::ViewportOcclusionCullingBuildQuality build_quality;
-	bool _jitter_enabled = false;
 
 	void _init_embree();
-	Vector2 _get_jitter(const Rect2 &p_viewport_rect, const Size2i &p_buffer_size);
 
 public:
 	virtual bool is_occluder(RID p_rid) override;
@@ -114,6 +114,10 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	if (p_origin == this) {
+		get_tree()->get_transform_store().node_3d_notify_changed(*this);
+	}
+
 	for (uint32_t n = 0; n < data.node3d_children.size(); n++) {
 		Node3D *s = data.node3d_children[n];
 
@@ -177,6 +181,7 @@ void Node3D::_notification(int p_what) {
 			}
 
 			_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM); // Global is always dirty upon entering a scene.
+			get_tree()->get_transform_store().node_3d_add(this);
 			_notify_dirty();
 
 			notification(NOTIFICATION_ENTER_WORLD);
@@ -208,6 +213,7 @@ void Node3D::_notification(int p_what) {
 
 			if (is_inside_tree()) {
 				get_tree()->get_scene_tree_fti().node_3d_notify_delete(this);
+				get_tree()->get_transform_store().node_3d_remove(this);
 			}
 
 			notification(NOTIFICATION_EXIT_WORLD, true);
@@ -1040,7 +1046,11 @@ void Node3D::reparent(RequiredParam<Node> p_parent, bool p_keep_global_transform
 
 void Node3D::set_disable_scale(bool p_enabled) {
 	ERR_THREAD_GUARD;
+	if (data.disable_scale == p_enabled) {
+		return;
+	}
 	data.disable_scale = p_enabled;
+	_propagate_transform_changed(this);
 }
 
 bool Node3D::is_scale_disabled() const {
@@ -52,6 +52,7 @@ class Node3D : public Node {
 
 	friend class SceneTreeFTI;
 	friend class SceneTreeFTITests;
+	friend class SceneTreeTransformStore;
 
 public:
 	static constexpr AncestralClass static_ancestral_class = AncestralClass::NODE_3D;
@@ -159,6 +160,9 @@ private:
 		LocalVector<Node3D *> node3d_children;
 		uint32_t index_in_parent = UINT32_MAX;
 
+		// Index in the SceneTreeTransformStore, when it is enabled.
+		uint32_t transform_store_index = UINT32_MAX;
+
 		ClientPhysicsInterpolationData *client_physics_interpolation_data = nullptr;
 
 #ifdef TOOLS_ENABLED
@@ -98,7 +98,14 @@ void CollisionObject3D::_notification(int p_what) {
 				return;
 			}
 
-			if (area) {
+			SceneTreeTransformStore &store = get_tree()->get_transform_store();
+			if (store.is_batching_server_updates()) {
+				if (area) {
+					store.queue_area_transform(rid, get_global_transform());
+				} else {
+					store.queue_body_transform(rid, get_global_transform());
+				}
+			} else if (area) {
 				PhysicsServer3D::get_singleton()->area_set_transform(rid, get_global_transform());
 			} else {
 				PhysicsServer3D::get_singleton()->body_set_state(rid, PhysicsServer3D::BODY_STATE_TRANSFORM, get_global_transform());
@@ -98,7 +98,12 @@ void VisualInstance3D::_notification(int p_what) {
 			// ToDo : Can we turn off notify transform for physics interpolated cases?
 			if (_is_vi_visible() && !(is_inside_tree() && get_tree()->is_physics_interpolation_enabled()) && !_is_using_identity_transform()) {
 				// Physics interpolation global off, always send.
-				RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+				SceneTreeTransformStore &store = get_tree()->get_transform_store();
+				if (store.is_batching_server_updates()) {
+					store.queue_instance_transform(instance, get_global_transform());
+				} else {
+					RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+				}
 			}
 		} break;
 
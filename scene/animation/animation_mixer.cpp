@@ -35,6 +35,7 @@
 #include "core/config/project_settings.h"
 #include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/string_name.h"
 #include "scene/2d/audio_stream_player_2d.h"
 #include "scene/animation/animation_player.h"
@@ -501,6 +502,14 @@ bool AnimationMixer::is_deterministic() const {
 	return deterministic;
 }
 
+void AnimationMixer::set_parallel_blending_enabled(bool p_enabled) {
+	parallel_blending = p_enabled;
+}
+
+bool AnimationMixer::is_parallel_blending_enabled() const {
+	return parallel_blending;
+}
+
 void AnimationMixer::set_callback_mode_process(AnimationCallbackModeProcess p_mode) {
 	if (callback_mode_process == p_mode) {
 		return;
@@ -594,6 +603,11 @@ void AnimationMixer::_clear_caches() {
 	animation_track_num_to_track_cache.clear();
 	cache_valid = false;
 	capture_cache.clear();
+	if (parallel_blend_state != PARALLEL_BLEND_NONE) {
+		// The queued blend refers to the caches that were just freed, drop it.
+		parallel_blend_state = PARALLEL_BLEND_NONE;
+		clear_animation_instances();
+	}
 
 	emit_signal(SNAME("caches_cleared"));
 }
@@ -1010,20 +1024,109 @@ bool AnimationMixer::_update_caches() {
 /* -------------------------------------------- */
 
 void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
+	if (parallel_blend_state != PARALLEL_BLEND_NONE) {
+		// Seeking or advancing by hand needs the previous result applied first.
+		_finish_queued_blend();
+	}
+
 	_blend_init();
 	if (cache_valid && _blend_pre_process(p_delta, track_count, track_map)) {
 		_blend_capture(p_delta);
 		_blend_calc_total_weight();
 		_blend_process(p_delta, p_update_only);
-		clear_animation_instances();
-		_blend_apply();
-		_blend_post_process();
-		emit_signal(SNAME("mixer_applied"));
+		_blend_finish();
 	} else {
 		clear_animation_instances();
 	}
 }
 
+void AnimationMixer::_blend_finish() {
+	clear_animation_instances();
+	_blend_apply();
+	_blend_post_process();
+	emit_signal(SNAME("mixer_applied"));
+}
+
+/* -------------------------------------------- */
+/* -- Parallel blending ----------------------- */
+/* -------------------------------------------- */
+
+LocalVector<ObjectID> AnimationMixer::parallel_blend_queue;
+
+bool AnimationMixer::_can_blend_in_parallel() const {
+	// Scripted key post-processing would run on worker threads, and nodes processed in thread groups are already off the main thread.
+	return parallel_blending && Thread::is_main_thread() && !GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
+}
+
+void AnimationMixer::_queue_process_animation(double p_delta) {
+	if (!_can_blend_in_parallel()) {
+		_process_animation(p_delta);
+		return;
+	}
+	if (parallel_blend_state != PARALLEL_BLEND_NONE) {
+		_finish_queued_blend();
+	}
+
+	// Pre-processing advances playback and emits signals, so it stays here. Blending is deferred until every mixer of this frame is queued.
+	_blend_init();
+	if (!cache_valid || !_blend_pre_process(p_delta, track_count, track_map)) {
+		clear_animation_instances();
+		return;
+	}
+	_blend_capture(p_delta);
+
+	if (parallel_blend_queue.is_empty()) {
+		callable_mp_static(&AnimationMixer::_flush_parallel_blend_queue).call_deferred();
+	}
+	parallel_blend_queue.push_back(get_instance_id());
+	parallel_blend_state = PARALLEL_BLEND_QUEUED;
+	parallel_blend_delta = p_delta;
+}
+
+void AnimationMixer::_finish_queued_blend() {
+	if (parallel_blend_state == PARALLEL_BLEND_QUEUED) {
+		_blend_calc_total_weight();
+		_blend_process(parallel_blend_delta, false, BLEND_PROCESS_PASS_BLEND);
+	}
+	parallel_blend_state = PARALLEL_BLEND_NONE;
+	_blend_process(parallel_blend_delta, false, BLEND_PROCESS_PASS_MAIN_THREAD);
+	_blend_finish();
+}
+
+void AnimationMixer::_parallel_blend_task(void *p_userdata, uint32_t p_index) {
+	AnimationMixer *mixer = static_cast<AnimationMixer **>(p_userdata)[p_index];
+	// Only the mixer's own track caches are written here.
+	mixer->_blend_calc_total_weight();
+	mixer->_blend_process(mixer->parallel_blend_delta, false, BLEND_PROCESS_PASS_BLEND);
+	mixer->parallel_blend_state = PARALLEL_BLEND_BLENDED;
+}
+
+void AnimationMixer::_flush_parallel_blend_queue() {
+	LocalVector<ObjectID> ids;
+	LocalVector<AnimationMixer *> mixers;
+	for (const ObjectID &id : parallel_blend_queue) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer && mixer->parallel_blend_state == PARALLEL_BLEND_QUEUED) {
+			ids.push_back(id);
+			mixers.push_back(mixer);
+		}
+	}
+	parallel_blend_queue.clear();
+
+	if (mixers.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_parallel_blend_task, mixers.ptr(), mixers.size(), -1, true, SNAME("AnimationMixerParallelBlend"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Applying can run method tracks and emit signals, which may free or reprocess other mixers of the batch.
+	for (const ObjectID &id : ids) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer && mixer->parallel_blend_state != PARALLEL_BLEND_NONE) {
+			mixer->_finish_queued_blend();
+		}
+	}
+}
+
 Variant AnimationMixer::_post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant &p_value, ObjectID p_object_id, int p_object_sub_idx) {
 #ifndef _3D_DISABLED
 	switch (p_anim->track_get_type(p_track)) {
@@ -1217,7 +1320,7 @@ void AnimationMixer::_blend_calc_total_weight() {
 	}
 }
 
-void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
+void AnimationMixer::_blend_process(double p_delta, bool p_update_only, BlendProcessPass p_pass) {
 	// Apply value/transform/blend/bezier blends to track caches and execute method/audio/animation tracks.
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
@@ -1273,6 +1376,13 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				blend = blend / track->total_weight;
 			}
 			Animation::TrackType ttype = animation_track->type;
+			if (p_pass != BLEND_PROCESS_PASS_ALL) {
+				bool is_main_thread_track = ttype == Animation::TYPE_METHOD || ttype == Animation::TYPE_AUDIO || ttype == Animation::TYPE_ANIMATION ||
+						(ttype == Animation::TYPE_VALUE && a->value_track_get_update_mode(i) == Animation::UPDATE_DISCRETE && callback_mode_discrete != ANIMATION_CALLBACK_MODE_DISCRETE_FORCE_CONTINUOUS);
+				if (is_main_thread_track != (p_pass == BLEND_PROCESS_PASS_MAIN_THREAD)) {
+					continue;
+				}
+			}
 			track->root_motion = root_motion_track == animation_track->path;
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
@@ -2403,13 +2513,13 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				_queue_process_animation(get_process_delta_time());
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				_queue_process_animation(get_physics_process_delta_time());
 			}
 		} break;
 
@@ -2459,6 +2569,9 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_deterministic", "deterministic"), &AnimationMixer::set_deterministic);
 	ClassDB::bind_method(D_METHOD("is_deterministic"), &AnimationMixer::is_deterministic);
 
+	ClassDB::bind_method(D_METHOD("set_parallel_blending_enabled", "enabled"), &AnimationMixer::set_parallel_blending_enabled);
+	ClassDB::bind_method(D_METHOD("is_parallel_blending_enabled"), &AnimationMixer::is_parallel_blending_enabled);
+
 	ClassDB::bind_method(D_METHOD("set_root_node", "path"), &AnimationMixer::set_root_node);
 	ClassDB::bind_method(D_METHOD("get_root_node"), &AnimationMixer::get_root_node);
 
@@ -2502,6 +2615,7 @@ void AnimationMixer::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "deterministic"), "set_deterministic", "is_deterministic");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "parallel_blending"), "set_parallel_blending_enabled", "is_parallel_blending_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "reset_on_save", PROPERTY_HINT_NONE, ""), "set_reset_on_save_enabled", "is_reset_on_save_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_node"), "set_root_node", "get_root_node");
 
@@ -328,6 +328,23 @@ protected:
 	int track_count = 0;
 	bool deterministic = false;
 
+	/* ---- Parallel blending ---- */
+	enum ParallelBlendState {
+		PARALLEL_BLEND_NONE,
+		PARALLEL_BLEND_QUEUED, // Pre-processed, waiting for the next flush.
+		PARALLEL_BLEND_BLENDED, // Blended on a worker thread, main thread tracks and apply are left.
+	};
+	bool parallel_blending = false;
+	ParallelBlendState parallel_blend_state = PARALLEL_BLEND_NONE;
+	double parallel_blend_delta = 0.0;
+	static LocalVector<ObjectID> parallel_blend_queue;
+
+	bool _can_blend_in_parallel() const;
+	void _queue_process_animation(double p_delta);
+	void _finish_queued_blend();
+	static void _parallel_blend_task(void *p_userdata, uint32_t p_index);
+	static void _flush_parallel_blend_queue();
+
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	NodePath root_motion_track;
 	bool root_motion_local = false;
@@ -369,8 +386,15 @@ protected:
 	virtual bool _blend_pre_process(double p_delta, int p_track_count, const AHashMap<NodePath, int> &p_track_map);
 	virtual void _blend_capture(double p_delta);
 	void _blend_calc_total_weight(); // For indeterministic blending.
-	void _blend_process(double p_delta, bool p_update_only = false);
+
+	enum BlendProcessPass {
+		BLEND_PROCESS_PASS_BLEND = 1, // Tracks blended into the mixer's own caches only, safe on worker threads.
+		BLEND_PROCESS_PASS_MAIN_THREAD = 2, // Discrete value, method, audio and animation tracks, which act on other objects right away.
+		BLEND_PROCESS_PASS_ALL = BLEND_PROCESS_PASS_BLEND | BLEND_PROCESS_PASS_MAIN_THREAD,
+	};
+	void _blend_process(double p_delta, bool p_update_only = false, BlendProcessPass p_pass = BLEND_PROCESS_PASS_ALL);
 	void _blend_apply();
+	void _blend_finish();
 	virtual void _blend_post_process();
 	void _call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
 
@@ -423,6 +447,9 @@ public:
 	void set_deterministic(bool p_deterministic);
 	bool is_deterministic() const;
 
+	void set_parallel_blending_enabled(bool p_enabled);
+	bool is_parallel_blending_enabled() const;
+
 	void set_root_node(const NodePath &p_path);
 	NodePath get_root_node() const;
 
@@ -180,8 +180,8 @@ SceneTreeGroup *SceneTree::add_to_group(const StringName &p_group, Node *p_node)
 	}
 
 	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
+	// Appended past the sorted range, merged into place by `_update_group_order()`.
 	E->value.nodes.push_back(p_node);
-	E->value.changed = true;
 	return &E->value;
 }
 
@@ -191,7 +191,13 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->value.nodes.erase(p_node);
+	// Removing keeps the relative order of the remaining nodes.
+	int idx = E->value.nodes.find(p_node);
+	ERR_FAIL_COND(idx < 0);
+	E->value.nodes.remove_at(idx);
+	if (idx < E->value.sorted_count) {
+		E->value.sorted_count--;
+	}
 	if (E->value.nodes.is_empty()) {
 		group_map.remove(E);
 	}
@@ -200,6 +206,10 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	// Resolve pending global transforms in one pass, so notified nodes read them from cache.
+	transform_store.update();
+	transform_store.begin_server_batch();
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -208,6 +218,8 @@ void SceneTree::flush_transform_notifications() {
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+
+	transform_store.end_server_batch();
 }
 
 bool SceneTree::is_accessibility_enabled() const {
@@ -338,22 +350,75 @@ void SceneTree::_flush_ugc() {
 }
 
 void SceneTree::_update_group_order(SceneTreeGroup &g) {
-	if (!g.changed) {
+	int gr_node_count = g.nodes.size();
+	if (!g.changed && g.sorted_count == gr_node_count) {
 		return;
 	}
-	if (g.nodes.is_empty()) {
+	if (gr_node_count == 0) {
+		g.sorted_count = 0;
+		g.changed = false;
 		return;
 	}
 
 	Node **gr_nodes = g.nodes.ptrw();
-	int gr_node_count = g.nodes.size();
-
 	SortArray<Node *, Node::Comparator> node_sort;
-	node_sort.sort(gr_nodes, gr_node_count);
+	Node::Comparator compare;
+
+	if (g.changed) {
+		node_sort.sort(gr_nodes, gr_node_count);
+	} else {
+		// Only nodes appended since the last update are out of place: sort them and merge them
+		// into the sorted range from the back, so nodes that already come first are never touched.
+		int sorted = g.sorted_count;
+		int appended = gr_node_count - sorted;
+		node_sort.sort(gr_nodes + sorted, appended);
+
+		if (sorted > 0 && compare(gr_nodes[sorted], gr_nodes[sorted - 1])) {
+			group_merge_buffer.resize(appended);
+			memcpy(group_merge_buffer.ptr(), gr_nodes + sorted, appended * sizeof(Node *));
+
+			int from_sorted = sorted - 1;
+			int from_appended = appended - 1;
+			int to = gr_node_count - 1;
+			while (from_appended >= 0) {
+				if (from_sorted >= 0 && compare(group_merge_buffer[from_appended], gr_nodes[from_sorted])) {
+					gr_nodes[to--] = gr_nodes[from_sorted--];
+				} else {
+					gr_nodes[to--] = group_merge_buffer[from_appended--];
+				}
+			}
+			group_merge_buffer.clear();
+		}
+	}
 
+	g.sorted_count = gr_node_count;
 	g.changed = false;
 }
 
+bool SceneTree::_lock_group_nodes(const StringName &p_group, Vector<Node *> &r_nodes) {
+	_THREAD_SAFE_METHOD_
+
+	HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
+	if (!E || E->value.nodes.is_empty()) {
+		return false;
+	}
+
+	_update_group_order(E->value);
+	// Shares the buffer; it is only copied if the group is modified while the caller iterates it.
+	r_nodes = E->value.nodes;
+	nodes_removed_on_group_call_lock++;
+	return true;
+}
+
+void SceneTree::_unlock_group_nodes() {
+	_THREAD_SAFE_METHOD_
+
+	nodes_removed_on_group_call_lock--;
+	if (nodes_removed_on_group_call_lock == 0) {
+		nodes_removed_on_group_call.clear();
+	}
+}
+
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
 	Vector<Node *> nodes_copy;
 
@@ -448,127 +513,26 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 }
 
 void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification) {
-	Vector<Node *> nodes_copy;
-	{
-		_THREAD_SAFE_METHOD_
-		HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
-		if (!E) {
-			return;
-		}
-		SceneTreeGroup &g = E->value;
-		if (g.nodes.is_empty()) {
-			return;
-		}
-
-		_update_group_order(g);
-
-		nodes_copy = g.nodes;
-	}
-
-	Node **gr_nodes = nodes_copy.ptrw();
-	int gr_node_count = nodes_copy.size();
-
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock++;
-	}
-
-	if (p_call_flags & GROUP_CALL_REVERSE) {
-		for (int i = gr_node_count - 1; i >= 0; i--) {
-			if (nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
-
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				gr_nodes[i]->notification(p_notification, true);
-			} else {
-				MessageQueue::get_singleton()->push_notification(gr_nodes[i], p_notification);
-			}
-		}
-
-	} else {
-		for (int i = 0; i < gr_node_count; i++) {
-			if (nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
-
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				gr_nodes[i]->notification(p_notification);
-			} else {
-				MessageQueue::get_singleton()->push_notification(gr_nodes[i], p_notification);
-			}
-		}
-	}
-
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock--;
-		if (nodes_removed_on_group_call_lock == 0) {
-			nodes_removed_on_group_call.clear();
+	bool reverse = p_call_flags & GROUP_CALL_REVERSE;
+	auto notify = [&](Node *p_node) {
+		if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
+			p_node->notification(p_notification, reverse);
+		} else {
+			MessageQueue::get_singleton()->push_notification(p_node, p_notification);
 		}
-	}
+	};
+	for_each_node_in_group(p_group, notify, reverse);
 }
 
 void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group, const String &p_name, const Variant &p_value) {
-	Vector<Node *> nodes_copy;
-	{
-		_THREAD_SAFE_METHOD_
-
-		HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
-		if (!E) {
-			return;
-		}
-		SceneTreeGroup &g = E->value;
-		if (g.nodes.is_empty()) {
-			return;
-		}
-
-		_update_group_order(g);
-
-		nodes_copy = g.nodes;
-	}
-	Node **gr_nodes = nodes_copy.ptrw();
-	int gr_node_count = nodes_copy.size();
-
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock++;
-	}
-
-	if (p_call_flags & GROUP_CALL_REVERSE) {
-		for (int i = gr_node_count - 1; i >= 0; i--) {
-			if (nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
-
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				gr_nodes[i]->set(p_name, p_value);
-			} else {
-				MessageQueue::get_singleton()->push_set(gr_nodes[i], p_name, p_value);
-			}
-		}
-
-	} else {
-		for (int i = 0; i < gr_node_count; i++) {
-			if (nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
-
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				gr_nodes[i]->set(p_name, p_value);
-			} else {
-				MessageQueue::get_singleton()->push_set(gr_nodes[i], p_name, p_value);
-			}
-		}
-	}
-
-	{
-		_THREAD_SAFE_METHOD_
-		nodes_removed_on_group_call_lock--;
-		if (nodes_removed_on_group_call_lock == 0) {
-			nodes_removed_on_group_call.clear();
+	auto set = [&](Node *p_node) {
+		if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
+			p_node->set(p_name, p_value);
+		} else {
+			MessageQueue::get_singleton()->push_set(p_node, p_name, p_value);
 		}
-	}
+	};
+	for_each_node_in_group(p_group, set, p_call_flags & GROUP_CALL_REVERSE);
 }
 
 void SceneTree::notify_group(const StringName &p_group, int p_notification) {
@@ -2083,6 +2047,7 @@ SceneTree::SceneTree() {
 #endif // _3D_DISABLED
 
 	set_physics_interpolation_enabled(GLOBAL_DEF("physics/common/physics_interpolation", false));
+	transform_store.set_enabled(root, GLOBAL_DEF("application/run/use_node_3d_transform_store", false));
 
 	// Always disable jitter fix if physics interpolation is enabled -
 	// Jitter fix will interfere with interpolation, and is not necessary
@@ -37,6 +37,7 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/self_list.h"
 #include "scene/main/scene_tree_fti.h"
+#include "scene/main/scene_tree_transform_store.h"
 
 #include <cstdlib>
 
@@ -83,7 +84,9 @@ public:
 
 struct SceneTreeGroup {
 	Vector<Node *> nodes;
-	bool changed = false;
+	// Nodes before this index are known to be in tree order. Nodes appended after it are merged in on the next update.
+	int sorted_count = 0;
+	bool changed = false; // Set when tree order changes under existing members, requiring a full sort.
 };
 
 class SceneTree : public MainLoop {
@@ -157,6 +160,7 @@ private:
 	static bool _physics_interpolation_enabled_in_project;
 
 	SceneTreeFTI scene_tree_fti;
+	SceneTreeTransformStore transform_store;
 
 	StringName tree_changed_name = "tree_changed";
 	StringName node_added_name = "node_added";
@@ -196,7 +200,10 @@ private:
 	bool ugc_locked = false;
 	void _flush_ugc();
 
+	LocalVector<Node *> group_merge_buffer;
 	_FORCE_INLINE_ void _update_group_order(SceneTreeGroup &g);
+	bool _lock_group_nodes(const StringName &p_group, Vector<Node *> &r_nodes);
+	void _unlock_group_nodes();
 
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
@@ -412,6 +419,25 @@ public:
 	void queue_delete(RequiredParam<Object> rp_object);
 
 	Vector<Node *> get_nodes_in_group(const StringName &p_group);
+	// Calls `p_callback(Node *)` for each node of the group in tree order. The group is not copied unless it is
+	// modified by the callback; nodes removed from the group while iterating are skipped.
+	template <typename F>
+	void for_each_node_in_group(const StringName &p_group, F &&p_callback, bool p_reverse = false) {
+		Vector<Node *> nodes;
+		if (!_lock_group_nodes(p_group, nodes)) {
+			return;
+		}
+		Node *const *gr_nodes = nodes.ptr();
+		int gr_node_count = nodes.size();
+		for (int i = 0; i < gr_node_count; i++) {
+			Node *node = gr_nodes[p_reverse ? gr_node_count - 1 - i : i];
+			if (nodes_removed_on_group_call.has(node)) {
+				continue;
+			}
+			p_callback(node);
+		}
+		_unlock_group_nodes();
+	}
 	Node *get_first_node_in_group(const StringName &p_group);
 	bool has_group(const StringName &p_identifier) const;
 	int get_node_count_in_group(const StringName &p_group) const;
@@ -469,6 +495,7 @@ public:
 #endif
 
 	SceneTreeFTI &get_scene_tree_fti() { return scene_tree_fti; }
+	SceneTreeTransformStore &get_transform_store() { return transform_store; }
 
 	SceneTree();
 	~SceneTree();
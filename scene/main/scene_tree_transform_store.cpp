@@ -0,0 +1,384 @@
+/**************************************************************************/
+/*  scene_tree_transform_store.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef _3D_DISABLED
+
+#include "scene_tree_transform_store.h"
+
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/sort_array.h"
+#include "scene/3d/node_3d.h"
+#include "servers/rendering/rendering_server.h"
+
+#ifndef PHYSICS_3D_DISABLED
+#include "servers/physics_3d/physics_server_3d.h"
+#endif // PHYSICS_3D_DISABLED
+
+void SceneTreeTransformStore::node_3d_add(Node3D *p_node) {
+	if (!data.enabled) {
+		return;
+	}
+	ERR_FAIL_COND(p_node->data.transform_store_index != UINT32_MAX);
+
+	MutexLock lock(data.mutex);
+
+	uint32_t index = data.nodes.size();
+	p_node->data.transform_store_index = index;
+
+	data.nodes.push_back(p_node);
+	data.local_xforms.push_back(Transform3D());
+	data.global_xforms.push_back(Transform3D());
+	data.parents.push_back(UINT32_MAX);
+	data.flags.push_back(0);
+	data.dirty.push_back(1);
+	data.queued.push_back(0);
+	data.dirty_list.push_back(index);
+
+	data.hierarchy_dirty = true;
+}
+
+void SceneTreeTransformStore::node_3d_remove(Node3D *p_node) {
+	uint32_t index = p_node->data.transform_store_index;
+	if (index == UINT32_MAX) {
+		return;
+	}
+
+	MutexLock lock(data.mutex);
+	ERR_FAIL_COND(index >= data.nodes.size() || data.nodes[index] != p_node);
+
+	if (data.dirty[index]) {
+		data.dirty_list.erase(index);
+	}
+
+	uint32_t last = data.nodes.size() - 1;
+	if (index != last) {
+		Node3D *moved = data.nodes[last];
+		moved->data.transform_store_index = index;
+
+		data.nodes[index] = moved;
+		data.local_xforms[index] = data.local_xforms[last];
+		data.global_xforms[index] = data.global_xforms[last];
+		data.parents[index] = data.parents[last];
+		data.flags[index] = data.flags[last];
+		data.dirty[index] = data.dirty[last];
+
+		if (data.dirty[index]) {
+			int64_t pos = data.dirty_list.find(last);
+			if (pos >= 0) {
+				data.dirty_list[pos] = index;
+			}
+		}
+	}
+
+	data.nodes.resize(last);
+	data.local_xforms.resize(last);
+	data.global_xforms.resize(last);
+	data.parents.resize(last);
+	data.flags.resize(last);
+	data.dirty.resize(last);
+	data.queued.resize(last);
+
+	p_node->data.transform_store_index = UINT32_MAX;
+	data.hierarchy_dirty = true;
+}
+
+void SceneTreeTransformStore::node_3d_notify_changed(Node3D &r_node) {
+	uint32_t index = r_node.data.transform_store_index;
+	if (index == UINT32_MAX) {
+		return;
+	}
+
+	MutexLock lock(data.mutex);
+	if (!data.dirty[index]) {
+		data.dirty[index] = 1;
+		data.dirty_list.push_back(index);
+	}
+}
+
+void SceneTreeTransformStore::_rebuild_hierarchy() {
+	uint32_t count = data.nodes.size();
+
+	// Parent indices change whenever entries move, so they are resolved again here.
+	for (uint32_t i = 0; i < count; i++) {
+		const Node3D *parent = data.nodes[i]->data.parent;
+		data.parents[i] = parent ? parent->data.transform_store_index : UINT32_MAX;
+	}
+
+	// Depths, walking up only until an ancestor with a known depth is found.
+	data.depths.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		data.depths[i] = UINT32_MAX;
+	}
+
+	LocalVector<uint32_t> chain;
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t n = i;
+		while (n != UINT32_MAX && data.depths[n] == UINT32_MAX) {
+			chain.push_back(n);
+			n = data.parents[n];
+		}
+		uint32_t depth = n == UINT32_MAX ? 0 : data.depths[n] + 1;
+		for (int64_t c = int64_t(chain.size()) - 1; c >= 0; c--) {
+			data.depths[chain[c]] = depth++;
+		}
+		chain.clear();
+	}
+
+	// Children of each entry, stored contiguously: entry `i` owns `children[child_offsets[i]]` up to `children[child_offsets[i + 1]]`.
+	data.child_offsets.resize(count + 1);
+	for (uint32_t &offset : data.child_offsets) {
+		offset = 0;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		if (data.parents[i] != UINT32_MAX) {
+			data.child_offsets[data.parents[i] + 1]++;
+		}
+	}
+	for (uint32_t i = 1; i <= count; i++) {
+		data.child_offsets[i] += data.child_offsets[i - 1];
+	}
+
+	data.children.resize(data.child_offsets[count]);
+	LocalVector<uint32_t> fill;
+	fill.resize(count);
+	memcpy(fill.ptr(), data.child_offsets.ptr(), count * sizeof(uint32_t));
+	for (uint32_t i = 0; i < count; i++) {
+		if (data.parents[i] != UINT32_MAX) {
+			data.children[fill[data.parents[i]]++] = i;
+		}
+	}
+
+	data.hierarchy_dirty = false;
+}
+
+void SceneTreeTransformStore::_update_entry(uint32_t p_index, const uint32_t *p_level) {
+	uint32_t i = p_level[p_index];
+	uint8_t flags = data.flags[i];
+	uint32_t parent = data.parents[i];
+
+	Transform3D global;
+	if (parent != UINT32_MAX && !(flags & FLAG_TOP_LEVEL)) {
+		global = data.global_xforms[parent] * data.local_xforms[i];
+	} else {
+		global = data.local_xforms[i];
+	}
+	if (flags & FLAG_DISABLE_SCALE) {
+		global.basis.orthonormalize();
+	}
+	data.global_xforms[i] = global;
+
+	Node3D *node = data.nodes[i];
+	node->data.global_transform = global;
+	node->_clear_dirty_bits(Node3D::DIRTY_GLOBAL_TRANSFORM);
+}
+
+void SceneTreeTransformStore::_update_level(const uint32_t *p_level, uint32_t p_count) {
+	if (p_count >= data.parallel_level_threshold) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTreeTransformStore::_update_entry, p_level, p_count, -1, true, SNAME("SceneTreeTransformStoreLevel"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t n = 0; n < p_count; n++) {
+			_update_entry(n, p_level);
+		}
+	}
+}
+
+void SceneTreeTransformStore::update() {
+	if (!data.enabled || data.dirty_list.is_empty()) {
+		return;
+	}
+
+	MutexLock lock(data.mutex);
+
+	if (data.hierarchy_dirty) {
+		_rebuild_hierarchy();
+	}
+
+	// Copy in what changed. Reading the local transform also resolves pending Euler rotation and scale.
+	for (uint32_t i : data.dirty_list) {
+		const Node3D *node = data.nodes[i];
+		data.local_xforms[i] = node->get_transform();
+		data.flags[i] = (node->data.top_level ? FLAG_TOP_LEVEL : 0) | (node->data.disable_scale ? FLAG_DISABLE_SCALE : 0);
+	}
+
+	// Walk the dirty subtrees one depth at a time. Each level holds the dirty entries at that depth
+	// plus the children of the level before, and only reads global transforms from earlier levels.
+	SortArray<uint32_t, DepthComparator> sorter;
+	sorter.compare.depths = data.depths.ptr();
+	sorter.sort(data.dirty_list.ptr(), data.dirty_list.size());
+
+	data.visit.clear();
+	uint32_t next_dirty = 0;
+	uint32_t level_start = 0;
+	uint32_t depth = data.depths[data.dirty_list[0]];
+	while (true) {
+		while (next_dirty < data.dirty_list.size() && data.depths[data.dirty_list[next_dirty]] == depth) {
+			uint32_t i = data.dirty_list[next_dirty++];
+			if (!data.queued[i]) {
+				data.queued[i] = 1;
+				data.visit.push_back(i);
+			}
+		}
+
+		uint32_t level_end = data.visit.size();
+		if (level_start == level_end) {
+			if (next_dirty == data.dirty_list.size()) {
+				break;
+			}
+			// Nothing pending between here and the next dirty entry.
+			depth = data.depths[data.dirty_list[next_dirty]];
+			continue;
+		}
+
+		_update_level(data.visit.ptr() + level_start, level_end - level_start);
+
+		for (uint32_t v = level_start; v < level_end; v++) {
+			uint32_t i = data.visit[v];
+			for (uint32_t c = data.child_offsets[i]; c < data.child_offsets[i + 1]; c++) {
+				uint32_t child = data.children[c];
+				if (!(data.flags[child] & FLAG_TOP_LEVEL) && !data.queued[child]) {
+					data.queued[child] = 1;
+					data.visit.push_back(child);
+				}
+			}
+		}
+
+		level_start = level_end;
+		depth++;
+	}
+
+	for (uint32_t i : data.visit) {
+		data.queued[i] = 0;
+	}
+
+	for (uint32_t i : data.dirty_list) {
+		data.dirty[i] = 0;
+	}
+	data.dirty_list.clear();
+}
+
+void SceneTreeTransformStore::begin_server_batch() {
+	if (data.enabled) {
+		data.server_batch_depth++;
+	}
+}
+
+void SceneTreeTransformStore::end_server_batch() {
+	if (data.server_batch_depth == 0 || --data.server_batch_depth > 0) {
+		return;
+	}
+
+	if (!data.instances.is_empty()) {
+		RenderingServer::get_singleton()->instance_set_transforms(data.instances, data.instance_xforms);
+		data.instances.clear();
+		data.instance_xforms.clear();
+	}
+
+#ifndef PHYSICS_3D_DISABLED
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	for (uint32_t i = 0; i < data.bodies.size(); i++) {
+		ps->body_set_state(data.bodies[i], PhysicsServer3D::BODY_STATE_TRANSFORM, data.body_xforms[i]);
+	}
+	for (uint32_t i = 0; i < data.areas.size(); i++) {
+		ps->area_set_transform(data.areas[i], data.area_xforms[i]);
+	}
+#endif // PHYSICS_3D_DISABLED
+	data.bodies.clear();
+	data.body_xforms.clear();
+	data.areas.clear();
+	data.area_xforms.clear();
+}
+
+void SceneTreeTransformStore::queue_instance_transform(RID p_instance, const Transform3D &p_xform) {
+	data.instances.push_back(p_instance);
+	data.instance_xforms.push_back(p_xform);
+}
+
+void SceneTreeTransformStore::queue_body_transform(RID p_body, const Transform3D &p_xform) {
+	data.bodies.push_back(p_body);
+	data.body_xforms.push_back(p_xform);
+}
+
+void SceneTreeTransformStore::queue_area_transform(RID p_area, const Transform3D &p_xform) {
+	data.areas.push_back(p_area);
+	data.area_xforms.push_back(p_xform);
+}
+
+void SceneTreeTransformStore::_add_subtree(Node *p_node) {
+	Node3D *node_3d = Object::cast_to<Node3D>(p_node);
+	if (node_3d) {
+		node_3d_add(node_3d);
+	}
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_add_subtree(p_node->get_child(i));
+	}
+}
+
+void SceneTreeTransformStore::_clear_indices() {
+	for (Node3D *node : data.nodes) {
+		node->data.transform_store_index = UINT32_MAX;
+	}
+	data.nodes.clear();
+	data.local_xforms.clear();
+	data.global_xforms.clear();
+	data.parents.clear();
+	data.flags.clear();
+	data.dirty.clear();
+	data.queued.clear();
+	data.child_offsets.clear();
+	data.children.clear();
+	data.visit.clear();
+	data.depths.clear();
+	data.dirty_list.clear();
+	data.hierarchy_dirty = false;
+}
+
+void SceneTreeTransformStore::set_enabled(Node *p_root, bool p_enabled) {
+	if (data.enabled == p_enabled) {
+		return;
+	}
+
+	{
+		MutexLock lock(data.mutex);
+		_clear_indices();
+		data.enabled = p_enabled;
+	}
+
+	if (p_enabled && p_root) {
+		_add_subtree(p_root);
+	}
+}
+
+bool SceneTreeTransformStore::is_global_transform_cached(const Node3D *p_node) const {
+	ERR_FAIL_NULL_V(p_node, false);
+	return !p_node->_test_dirty_bits(Node3D::DIRTY_GLOBAL_TRANSFORM);
+}
+
+#endif // _3D_DISABLED
@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*  scene_tree_transform_store.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/transform_3d.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/rid.h"
+#include "core/templates/vector.h"
+
+class Node;
+class Node3D;
+
+#ifdef _3D_DISABLED
+// Stubs
+class SceneTreeTransformStore {
+public:
+	void node_3d_add(Node3D *p_node) {}
+	void node_3d_remove(Node3D *p_node) {}
+	void node_3d_notify_changed(Node3D &r_node) {}
+	void update() {}
+	void set_enabled(Node *p_root, bool p_enabled) {}
+	bool is_enabled() const { return false; }
+	bool is_global_transform_cached(const Node3D *p_node) const { return false; }
+
+	void begin_server_batch() {}
+	void end_server_batch() {}
+	bool is_batching_server_updates() const { return false; }
+};
+#else
+
+// Keeps the transforms of every Node3D in the tree in contiguous arrays, so dirty global
+// transforms can be recomputed by walking the changed subtrees one depth at a time,
+// instead of by each node walking up its parents.
+//
+// Node3D still owns its transforms. Changed local transforms are copied in when the store
+// updates, and recomputed global transforms are written back to the nodes, which makes
+// `Node3D::get_global_transform()` a cache hit afterwards.
+
+// Like SceneTreeFTI, this class uses raw pointers; nodes must be removed before they are deleted.
+
+class SceneTreeTransformStore {
+	enum EntryFlags : uint8_t {
+		FLAG_TOP_LEVEL = 1,
+		FLAG_DISABLE_SCALE = 2,
+	};
+
+	struct DepthComparator {
+		const uint32_t *depths = nullptr;
+		bool operator()(uint32_t p_a, uint32_t p_b) const { return depths[p_a] < depths[p_b]; }
+	};
+
+	struct Data {
+		// Dense arrays, indexed by `Node3D::data.transform_store_index`.
+		// Removal moves the last entry into the hole.
+		LocalVector<Node3D *> nodes;
+		LocalVector<Transform3D> local_xforms;
+		LocalVector<Transform3D> global_xforms;
+		LocalVector<uint32_t> parents; // UINT32_MAX for nodes without a Node3D parent.
+		LocalVector<uint8_t> flags;
+		LocalVector<uint8_t> dirty; // Local transform or flags changed since the last update.
+		LocalVector<uint8_t> queued; // Already added to `visit` by the current update.
+		LocalVector<uint32_t> depths;
+
+		// Children of each entry, rebuilt whenever the hierarchy changes.
+		LocalVector<uint32_t> child_offsets;
+		LocalVector<uint32_t> children;
+
+		LocalVector<uint32_t> dirty_list;
+		// Entries recomputed by the current update, grouped by depth.
+		LocalVector<uint32_t> visit;
+
+		// Server updates queued while transform notifications are flushed.
+		Vector<RID> instances;
+		Vector<Transform3D> instance_xforms;
+		LocalVector<RID> bodies;
+		LocalVector<Transform3D> body_xforms;
+		LocalVector<RID> areas;
+		LocalVector<Transform3D> area_xforms;
+		uint32_t server_batch_depth = 0;
+
+		// Levels with fewer nodes than this are updated on the calling thread.
+		uint32_t parallel_level_threshold = 1024;
+
+		bool hierarchy_dirty = false;
+		bool enabled = false;
+
+		Mutex mutex;
+	} data;
+
+	void _rebuild_hierarchy();
+	void _update_entry(uint32_t p_index, const uint32_t *p_level);
+	void _update_level(const uint32_t *p_level, uint32_t p_count);
+	void _add_subtree(Node *p_node);
+	void _clear_indices();
+
+public:
+	void node_3d_add(Node3D *p_node);
+	void node_3d_remove(Node3D *p_node);
+
+	// Called when the local transform of a node changed. Safe to call from processing threads.
+	void node_3d_notify_changed(Node3D &r_node);
+
+	// Recomputes the global transforms of changed nodes and their descendants.
+	void update();
+
+	void set_enabled(Node *p_root, bool p_enabled);
+	bool is_enabled() const { return data.enabled; }
+
+	uint32_t get_node_count() const { return data.nodes.size(); }
+	// Whether the node holds an up to date global transform, without resolving it.
+	bool is_global_transform_cached(const Node3D *p_node) const;
+
+	// While a batch is open, nodes reacting to NOTIFICATION_TRANSFORM_CHANGED queue their
+	// server transforms here, and they are sent together when the batch ends.
+	void begin_server_batch();
+	void end_server_batch();
+	bool is_batching_server_updates() const { return data.server_batch_depth > 0 && Thread::is_main_thread(); }
+
+	void queue_instance_transform(RID p_instance, const Transform3D &p_xform);
+	void queue_body_transform(RID p_body, const Transform3D &p_xform);
+	void queue_area_transform(RID p_area, const Transform3D &p_xform);
+};
+
+#endif // _3D_DISABLED
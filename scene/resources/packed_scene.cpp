@@ -152,6 +152,516 @@ static Node *_find_node_by_id(Node *p_owner, Node *p_node, int32_t p_id) {
 	return nullptr;
 }
 
+// Arrays and dictionaries are typed after the property they are assigned to, and never
+// shared between instances.
+static Array _get_array_for_property(Node *p_node, const StringName &p_property, const Array &p_value) {
+	Array set_array = p_value;
+	bool is_get_valid = false;
+	Variant get_value = p_node->get(p_property, &is_get_valid);
+
+	if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+		Array get_array = get_value;
+		if (set_array.is_same_typed(get_array)) {
+			set_array = set_array.duplicate();
+		} else {
+			set_array = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+		}
+	}
+	return set_array;
+}
+
+static Dictionary _get_dictionary_for_property(Node *p_node, const StringName &p_property, const Dictionary &p_value) {
+	Dictionary set_dict = p_value;
+	bool is_get_valid = false;
+	Variant get_value = p_node->get(p_property, &is_get_valid);
+
+	if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+		Dictionary get_dict = get_value;
+		if (set_dict.is_same_typed(get_dict)) {
+			set_dict = set_dict.duplicate();
+		} else {
+			set_dict = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(), get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
+		}
+	}
+	return set_dict;
+}
+
+void SceneState::_apply_deferred_node_paths(const LocalVector<DeferredNodePathProperties> &p_deferred_node_paths) {
+	for (const DeferredNodePathProperties &dnp : p_deferred_node_paths) {
+		// Replace properties stored as NodePaths with actual Nodes.
+		Node *base = ObjectDB::get_instance<Node>(dnp.base);
+		ERR_CONTINUE_EDMSG(!base, vformat("Failed to set deferred property '%s' as the base node disappeared.", dnp.property));
+		if (dnp.value.get_type() == Variant::ARRAY) {
+			Array paths = dnp.value;
+
+			bool valid;
+			Array array = base->get(dnp.property, &valid);
+			ERR_CONTINUE_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", dnp.property, base->get_name()));
+			array = array.duplicate();
+
+			array.resize(paths.size());
+			for (int i = 0; i < array.size(); i++) {
+				array.set(i, base->get_node_or_null(paths[i]));
+			}
+			base->set(dnp.property, array);
+		} else if (dnp.value.get_type() == Variant::DICTIONARY) {
+			Dictionary paths = dnp.value;
+
+			bool valid;
+			Dictionary dict = base->get(dnp.property, &valid);
+			ERR_CONTINUE_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", dnp.property, base->get_name()));
+			dict = dict.duplicate();
+			bool convert_key = dict.get_typed_key_builtin() == Variant::OBJECT &&
+					ClassDB::is_parent_class(dict.get_typed_key_class_name(), "Node");
+			bool convert_value = dict.get_typed_value_builtin() == Variant::OBJECT &&
+					ClassDB::is_parent_class(dict.get_typed_value_class_name(), "Node");
+
+			for (const KeyValue<Variant, Variant> &kv : paths) {
+				Variant key = kv.key;
+				if (convert_key) {
+					key = base->get_node_or_null(key);
+				}
+				Variant value = kv.value;
+				if (convert_value) {
+					value = base->get_node_or_null(value);
+				}
+				dict[key] = value;
+			}
+			base->set(dnp.property, dict);
+		} else {
+			base->set(dnp.property, base->get_node_or_null(dnp.value));
+		}
+	}
+}
+
+struct SceneState::InstantiationPlan {
+	enum PropertyOp {
+		PROPERTY_OP_SETTER, // Bound setter, MethodBind::call() converts the argument.
+		PROPERTY_OP_SETTER_VALIDATED, // Bound setter, argument types already match.
+		PROPERTY_OP_SET, // Object::set(), for scripted, instanced or extension nodes.
+		PROPERTY_OP_SCRIPT,
+		PROPERTY_OP_CONTAINER, // Array or Dictionary, typed and duplicated per instance.
+		PROPERTY_OP_NODE_PATH, // Resolved once all nodes exist.
+	};
+
+	struct PlanProperty {
+		PropertyOp op = PROPERTY_OP_SET;
+		StringName name;
+		Variant value;
+		Variant index;
+		bool indexed = false;
+		MethodBind *setter = nullptr;
+	};
+
+	struct PlanNode {
+		ClassDB::CreationFunc create = nullptr;
+		StringName type;
+		Ref<PackedScene> instance;
+		StringName name;
+		int parent = -1;
+		int owner = -1;
+		int index = -1;
+		int32_t unique_id = Node::UNIQUE_SCENE_ID_UNASSIGNED;
+		bool has_unique_id = false;
+		bool remove_pinned_properties = false;
+		LocalVector<PlanProperty> properties;
+		LocalVector<StringName> groups;
+	};
+
+	struct PlanConnection {
+		int from = 0;
+		int to = 0;
+		StringName signal;
+		StringName method;
+		Array binds;
+		int unbinds = 0;
+		uint32_t flags = 0;
+	};
+
+	LocalVector<PlanNode> nodes;
+	LocalVector<PlanConnection> connections;
+};
+
+static bool _dictionary_has_local_resource(const SceneState *p_state, const Dictionary &p_dictionary) {
+	return p_state->has_local_resource(p_dictionary.keys()) || p_state->has_local_resource(p_dictionary.values());
+}
+
+bool SceneState::_compile_instantiation_plan(InstantiationPlan &r_plan) const {
+	// Only scenes whose nodes can all be addressed by index are compiled. Inherited
+	// scenes, placeholders, editable children, local-to-scene resources and anything
+	// needing path recovery keep going through the interpreter in instantiate().
+	const int nc = nodes.size();
+	if (nc == 0 || base_scene_idx >= 0 || !editable_instances.is_empty()) {
+		return false;
+	}
+
+	const int sname_count = names.size();
+	const int prop_count = variants.size();
+
+	r_plan.nodes.resize(nc);
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		InstantiationPlan::PlanNode &pn = r_plan.nodes[i];
+
+		if (n.name < 0 || n.name >= sname_count) {
+			return false;
+		}
+		pn.name = names[n.name];
+
+		if (i == 0) {
+			if (n.parent != -1) {
+				return false;
+			}
+		} else if ((n.parent & FLAG_ID_IS_PATH) || n.parent < 0 || n.parent >= i) {
+			return false;
+		}
+		pn.parent = n.parent;
+
+		if (n.owner >= 0) {
+			if ((n.owner & FLAG_ID_IS_PATH) || n.owner >= i) {
+				return false;
+			}
+			pn.owner = n.owner;
+		}
+		pn.index = n.index;
+
+		if (n.instance >= 0) {
+			if (n.instance & FLAG_INSTANCE_IS_PLACEHOLDER || (n.instance & FLAG_MASK) >= prop_count) {
+				return false;
+			}
+			pn.instance = variants[n.instance & FLAG_MASK];
+			if (pn.instance.is_null()) {
+				return false;
+			}
+		} else if (n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= sname_count) {
+			return false;
+		} else {
+			pn.type = names[n.type];
+			if (!ClassDB::class_exists(pn.type) || !ClassDB::is_parent_class(pn.type, SNAME("Node"))) {
+				return false;
+			}
+			pn.create = ClassDB::get_native_creation_func(pn.type);
+		}
+
+		if (i < ids.size()) {
+			pn.unique_id = ids[i];
+			pn.has_unique_id = true;
+		}
+
+		// Setters can only be resolved up front while Object::set() would reach
+		// ClassDB directly, i.e. on native nodes that have no script yet.
+		bool needs_set = pn.create == nullptr;
+
+		for (const NodeData::Property &prop : n.properties) {
+			if (prop.value < 0 || prop.value >= prop_count) {
+				return false;
+			}
+			const uint32_t name_idx = prop.name & FLAG_PROP_NAME_MASK;
+			if (name_idx >= (uint32_t)sname_count) {
+				return false;
+			}
+
+			InstantiationPlan::PlanProperty pp;
+			pp.name = names[name_idx];
+			pp.value = variants[prop.value];
+
+			if (pp.name == SNAME("metadata/_edit_pinned_properties_")) {
+				pn.remove_pinned_properties = true;
+			}
+
+			if (prop.name & FLAG_PATH_PROPERTY_IS_NODE) {
+				pp.op = InstantiationPlan::PROPERTY_OP_NODE_PATH;
+				pn.properties.push_back(pp);
+				continue;
+			}
+
+			if (pp.name == CoreStringName(script)) {
+#ifdef TOOLS_ENABLED
+				const Ref<Script> value_as_script = pp.value;
+				if (value_as_script.is_valid() && value_as_script->is_abstract()) {
+					return false; // Let the interpreter report it.
+				}
+#endif // TOOLS_ENABLED
+				pp.op = InstantiationPlan::PROPERTY_OP_SCRIPT;
+				pn.properties.push_back(pp);
+				pn.remove_pinned_properties = true;
+				needs_set = true;
+				continue;
+			}
+
+			switch (pp.value.get_type()) {
+				case Variant::OBJECT: {
+					const Ref<Resource> res = pp.value;
+					if (res.is_valid() && res->is_local_to_scene()) {
+						return false;
+					}
+				} break;
+				case Variant::ARRAY: {
+					if (has_local_resource(pp.value)) {
+						return false;
+					}
+					pp.op = InstantiationPlan::PROPERTY_OP_CONTAINER;
+					pn.properties.push_back(pp);
+					continue;
+				}
+				case Variant::DICTIONARY: {
+					if (_dictionary_has_local_resource(this, pp.value)) {
+						return false;
+					}
+					pp.op = InstantiationPlan::PROPERTY_OP_CONTAINER;
+					pn.properties.push_back(pp);
+					continue;
+				}
+				default:
+					break;
+			}
+
+			if (needs_set) {
+				pp.op = InstantiationPlan::PROPERTY_OP_SET;
+				pn.properties.push_back(pp);
+				continue;
+			}
+
+			bool is_bound = false;
+			const int index = ClassDB::get_property_index(pn.type, pp.name, &is_bound);
+			if (!is_bound) {
+				// Metadata, _set() and friends.
+				pp.op = InstantiationPlan::PROPERTY_OP_SET;
+				pn.properties.push_back(pp);
+				continue;
+			}
+
+			const StringName setter = ClassDB::get_property_setter(pn.type, pp.name);
+			if (setter == StringName()) {
+				continue; // Read-only, Object::set() would ignore it too.
+			}
+
+			pp.setter = ClassDB::get_method(pn.type, setter);
+			if (!pp.setter) {
+				pp.op = InstantiationPlan::PROPERTY_OP_SET;
+				pn.properties.push_back(pp);
+				continue;
+			}
+
+			pp.indexed = index >= 0;
+			if (pp.indexed) {
+				pp.index = index;
+			}
+			pp.op = InstantiationPlan::PROPERTY_OP_SETTER;
+
+			const int argc = pp.indexed ? 2 : 1;
+			const Variant::Type value_type = pp.value.get_type();
+			if (!pp.setter->is_vararg() && pp.setter->get_argument_count() == argc && (!pp.indexed || pp.setter->get_argument_type(0) == Variant::INT) && value_type != Variant::NIL && value_type != Variant::OBJECT) {
+				const Variant::Type arg_type = pp.setter->get_argument_type(argc - 1);
+				if (arg_type == value_type || arg_type == Variant::NIL) {
+					pp.op = InstantiationPlan::PROPERTY_OP_SETTER_VALIDATED;
+				}
+			}
+			pn.properties.push_back(pp);
+		}
+
+		for (int group : n.groups) {
+			if (group < 0 || group >= sname_count) {
+				return false;
+			}
+			pn.groups.push_back(names[group]);
+		}
+	}
+
+	const int cc = connections.size();
+	r_plan.connections.resize(cc);
+	for (int i = 0; i < cc; i++) {
+		const ConnectionData &c = connections[i];
+		InstantiationPlan::PlanConnection &pc = r_plan.connections[i];
+
+		if ((c.from & FLAG_ID_IS_PATH) || (c.to & FLAG_ID_IS_PATH) || c.from < 0 || c.from >= nc || c.to < 0 || c.to >= nc) {
+			return false;
+		}
+		if (c.signal < 0 || c.signal >= sname_count || c.method < 0 || c.method >= sname_count) {
+			return false;
+		}
+
+		pc.from = c.from;
+		pc.to = c.to;
+		pc.signal = names[c.signal];
+		pc.method = names[c.method];
+		for (int bind : c.binds) {
+			if (bind < 0 || bind >= prop_count) {
+				return false;
+			}
+			pc.binds.push_back(variants[bind]);
+		}
+		pc.unbinds = c.unbinds;
+		pc.flags = CONNECT_PERSIST | c.flags | CONNECT_INHERITED;
+	}
+
+	return true;
+}
+
+const SceneState::InstantiationPlan *SceneState::_get_instantiation_plan() const {
+	MutexLock lock(instantiation_plan_mutex);
+	if (!instantiation_plan_compiled) {
+		instantiation_plan_compiled = true;
+		InstantiationPlan *plan = memnew(InstantiationPlan);
+		if (_compile_instantiation_plan(*plan)) {
+			instantiation_plan = plan;
+		} else {
+			memdelete(plan);
+		}
+	}
+	return instantiation_plan;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan) {
+		memdelete(instantiation_plan);
+		instantiation_plan = nullptr;
+	}
+	instantiation_plan_compiled = false;
+}
+
+static _FORCE_INLINE_ bool _can_use_instantiation_plan(SceneState::GenEditState p_edit_state) {
+	return p_edit_state == SceneState::GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint() && !ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled();
+}
+
+Node *SceneState::_instantiate_from_plan(const InstantiationPlan &p_plan, LocalVector<Node *> &r_nodes, LocalVector<DeferredNodePathProperties> &r_deferred_node_paths) const {
+	const uint32_t nc = p_plan.nodes.size();
+	r_nodes.resize(nc);
+	r_deferred_node_paths.clear();
+
+	for (uint32_t i = 0; i < nc; i++) {
+		const InstantiationPlan::PlanNode &pn = p_plan.nodes[i];
+
+		Node *node = nullptr;
+		if (pn.instance.is_valid()) {
+			node = pn.instance->instantiate(PackedScene::GEN_EDIT_STATE_DISABLED);
+		} else if (pn.create) {
+			node = static_cast<Node *>(pn.create(true));
+		} else {
+			node = Object::cast_to<Node>(ClassDB::instantiate(pn.type));
+		}
+
+		if (unlikely(!node)) {
+			if (i > 0) {
+				memdelete(r_nodes[0]);
+			}
+			ERR_FAIL_V_MSG(nullptr, vformat("Failed to create node \"%s\" while instantiating \"%s\".", pn.name, path));
+		}
+
+		if (pn.has_unique_id) {
+			node->set_unique_scene_id(pn.unique_id);
+		}
+
+		for (const InstantiationPlan::PlanProperty &pp : pn.properties) {
+			switch (pp.op) {
+				case InstantiationPlan::PROPERTY_OP_SETTER_VALIDATED: {
+					const Variant *args[2] = { &pp.index, &pp.value };
+					Variant ret;
+					pp.setter->validated_call(node, pp.indexed ? args : args + 1, &ret);
+				} break;
+				case InstantiationPlan::PROPERTY_OP_SETTER: {
+					const Variant *args[2] = { &pp.index, &pp.value };
+					Callable::CallError ce;
+					pp.setter->call(node, pp.indexed ? args : args + 1, pp.indexed ? 2 : 1, ce);
+				} break;
+				case InstantiationPlan::PROPERTY_OP_SET: {
+					node->set(pp.name, pp.value);
+				} break;
+				case InstantiationPlan::PROPERTY_OP_SCRIPT: {
+					List<Pair<StringName, Variant>> old_state;
+					if (node->get_script_instance()) {
+						node->get_script_instance()->get_property_state(old_state);
+					}
+					node->set_script(pp.value);
+					for (const Pair<StringName, Variant> &E : old_state) {
+						node->set(E.first, E.second);
+					}
+				} break;
+				case InstantiationPlan::PROPERTY_OP_CONTAINER: {
+					if (pp.value.get_type() == Variant::ARRAY) {
+						node->set(pp.name, _get_array_for_property(node, pp.name, pp.value));
+					} else {
+						node->set(pp.name, _get_dictionary_for_property(node, pp.name, pp.value));
+					}
+				} break;
+				case InstantiationPlan::PROPERTY_OP_NODE_PATH: {
+					DeferredNodePathProperties dnp;
+					dnp.value = pp.value;
+					dnp.base = node->get_instance_id();
+					dnp.property = pp.name;
+					r_deferred_node_paths.push_back(dnp);
+				} break;
+			}
+		}
+
+		for (const StringName &group : pn.groups) {
+			node->add_to_group(group, true);
+		}
+
+		if (i > 0) {
+			Node *parent = r_nodes[pn.parent];
+			parent->_add_child_nocheck(node, pn.name);
+			if (pn.index >= 0 && pn.index < parent->get_child_count() - 1) {
+				parent->move_child(node, pn.index);
+			}
+		} else {
+			node->_set_name_nocheck(pn.name);
+		}
+
+		if (pn.owner >= 0) {
+			node->_set_owner_nocheck(r_nodes[pn.owner]);
+			if (node->data.unique_name_in_owner) {
+				node->_acquire_unique_name_in_owner();
+			}
+		}
+
+		if (pn.remove_pinned_properties) {
+			node->remove_meta("_edit_pinned_properties_");
+		}
+
+		r_nodes[i] = node;
+	}
+
+	_apply_deferred_node_paths(r_deferred_node_paths);
+
+	for (const InstantiationPlan::PlanConnection &pc : p_plan.connections) {
+		Callable callable(r_nodes[pc.to], pc.method);
+		if (!pc.binds.is_empty()) {
+			callable = callable.bindv(pc.binds);
+		}
+		if (pc.unbinds > 0) {
+			callable = callable.unbind(pc.unbinds);
+		}
+		r_nodes[pc.from]->connect(pc.signal, callable, pc.flags);
+	}
+
+	return r_nodes[0];
+}
+
+Vector<Node *> SceneState::instantiate_many(int p_count, GenEditState p_edit_state) const {
+	Vector<Node *> ret;
+	ERR_FAIL_COND_V(p_count < 0, ret);
+
+	const InstantiationPlan *plan = _can_use_instantiation_plan(p_edit_state) ? _get_instantiation_plan() : nullptr;
+	LocalVector<Node *> plan_nodes;
+	LocalVector<DeferredNodePathProperties> deferred_node_paths;
+
+	ret.resize(p_count);
+	Node **w = ret.ptrw();
+	for (int i = 0; i < p_count; i++) {
+		Node *node = plan ? _instantiate_from_plan(*plan, plan_nodes, deferred_node_paths) : instantiate(p_edit_state);
+		if (!node) {
+			ret.resize(i);
+			break;
+		}
+		w[i] = node;
+	}
+
+	return ret;
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -172,6 +682,15 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	int nc = nodes.size();
 	ERR_FAIL_COND_V_MSG(nc == 0, nullptr, vformat("Failed to instantiate scene state of \"%s\", node count is 0. Make sure the PackedScene resource is valid.", path));
 
+	if (_can_use_instantiation_plan(p_edit_state)) {
+		const InstantiationPlan *plan = _get_instantiation_plan();
+		if (plan) {
+			LocalVector<Node *> plan_nodes;
+			LocalVector<DeferredNodePathProperties> deferred_node_paths;
+			return _instantiate_from_plan(*plan, plan_nodes, deferred_node_paths);
+		}
+	}
+
 	const StringName *snames = nullptr;
 	int sname_count = names.size();
 	if (sname_count) {
@@ -448,36 +967,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (value.get_type() == Variant::ARRAY) {
-							Array set_array = value;
-							bool is_get_valid = false;
-							Variant get_value = node->get(snames[nprops[j].name], &is_get_valid);
-
-							if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-								Array get_array = get_value;
-								if (set_array.is_same_typed(get_array)) {
-									set_array = set_array.duplicate();
-								} else {
-									set_array = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-								}
-							}
-
+							Array set_array = _get_array_for_property(node, snames[nprops[j].name], value);
 							value = setup_resources_in_array(set_array, n, resources_local_to_scenes, node, snames[nprops[j].name], i, ret_nodes, p_edit_state);
 						}
 
 						if (value.get_type() == Variant::DICTIONARY) {
-							Dictionary set_dict = value;
-							bool is_get_valid = false;
-							Variant get_value = node->get(snames[nprops[j].name], &is_get_valid);
-
-							if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-								Dictionary get_dict = get_value;
-								if (set_dict.is_same_typed(get_dict)) {
-									set_dict = set_dict.duplicate();
-								} else {
-									set_dict = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(), get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-								}
-							}
-
+							Dictionary set_dict = _get_dictionary_for_property(node, snames[nprops[j].name], value);
 							value = setup_resources_in_dictionary(set_dict, n, resources_local_to_scenes, node, snames[nprops[j].name], i, ret_nodes, p_edit_state);
 						}
 
@@ -594,51 +1089,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		}
 	}
 
-	for (const DeferredNodePathProperties &dnp : deferred_node_paths) {
-		// Replace properties stored as NodePaths with actual Nodes.
-		Node *base = ObjectDB::get_instance<Node>(dnp.base);
-		ERR_CONTINUE_EDMSG(!base, vformat("Failed to set deferred property '%s' as the base node disappeared.", dnp.property));
-		if (dnp.value.get_type() == Variant::ARRAY) {
-			Array paths = dnp.value;
-
-			bool valid;
-			Array array = base->get(dnp.property, &valid);
-			ERR_CONTINUE_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", dnp.property, base->get_name()));
-			array = array.duplicate();
-
-			array.resize(paths.size());
-			for (int i = 0; i < array.size(); i++) {
-				array.set(i, base->get_node_or_null(paths[i]));
-			}
-			base->set(dnp.property, array);
-		} else if (dnp.value.get_type() == Variant::DICTIONARY) {
-			Dictionary paths = dnp.value;
-
-			bool valid;
-			Dictionary dict = base->get(dnp.property, &valid);
-			ERR_CONTINUE_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", dnp.property, base->get_name()));
-			dict = dict.duplicate();
-			bool convert_key = dict.get_typed_key_builtin() == Variant::OBJECT &&
-					ClassDB::is_parent_class(dict.get_typed_key_class_name(), "Node");
-			bool convert_value = dict.get_typed_value_builtin() == Variant::OBJECT &&
-					ClassDB::is_parent_class(dict.get_typed_value_class_name(), "Node");
-
-			for (const KeyValue<Variant, Variant> &kv : paths) {
-				Variant key = kv.key;
-				if (convert_key) {
-					key = base->get_node_or_null(key);
-				}
-				Variant value = kv.value;
-				if (convert_value) {
-					value = base->get_node_or_null(value);
-				}
-				dict[key] = value;
-			}
-			base->set(dnp.property, dict);
-		} else {
-			base->set(dnp.property, base->get_node_or_null(dnp.value));
-		}
-	}
+	_apply_deferred_node_paths(deferred_node_paths);
 
 	for (KeyValue<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &E : resources_local_to_scenes) {
 		for (KeyValue<Ref<Resource>, Ref<Resource>> &R : E.value) {
@@ -1435,6 +1886,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1669,6 +2121,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_clear_instantiation_plan();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -2297,22 +2751,27 @@ Vector<Ref<Resource>> SceneState::get_sub_resources() {
 //add
 
 int SceneState::add_name(const StringName &p_name) {
+	_clear_instantiation_plan();
 	names.push_back(p_name);
 	return names.size() - 1;
 }
 
 int SceneState::add_value(const Variant &p_value) {
+	_clear_instantiation_plan();
 	variants.push_back(p_value);
 	return variants.size() - 1;
 }
 
 int SceneState::add_node_path(const NodePath &p_path, const PackedInt32Array &p_uid_path) {
+	_clear_instantiation_plan();
 	node_paths.push_back(p_path);
 	id_paths.push_back(p_uid_path);
 	return (node_paths.size() - 1) | FLAG_ID_IS_PATH;
 }
 
 int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int p_instance, int p_index, int32_t p_unique_id) {
+	_clear_instantiation_plan();
+
 	NodeData nd;
 	nd.parent = p_parent;
 	nd.owner = p_owner;
@@ -2333,6 +2792,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	ERR_FAIL_INDEX(p_name, names.size());
 	ERR_FAIL_INDEX(p_value, variants.size());
 
+	_clear_instantiation_plan();
 	NodeData::Property prop;
 	prop.name = p_name;
 	if (p_deferred_node_path) {
@@ -2345,11 +2805,13 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 void SceneState::add_node_group(int p_node, int p_group) {
 	ERR_FAIL_INDEX(p_node, nodes.size());
 	ERR_FAIL_INDEX(p_group, names.size());
+	_clear_instantiation_plan();
 	nodes.write[p_node].groups.push_back(p_group);
 }
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_clear_instantiation_plan();
 	base_scene_idx = p_idx;
 }
 
@@ -2360,6 +2822,8 @@ void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method
 	for (int i = 0; i < p_binds.size(); i++) {
 		ERR_FAIL_INDEX(p_binds[i], variants.size());
 	}
+	_clear_instantiation_plan();
+
 	ConnectionData c;
 	c.from = p_from;
 	c.to = p_to;
@@ -2372,10 +2836,12 @@ void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method
 }
 
 void SceneState::add_editable_instance(const NodePath &p_path) {
+	_clear_instantiation_plan();
 	editable_instances.push_back(p_path);
 }
 
 bool SceneState::remove_group_references(const StringName &p_name) {
+	_clear_instantiation_plan();
 	bool edited = false;
 	for (NodeData &node : nodes) {
 		for (const int &group : node.groups) {
@@ -2390,6 +2856,7 @@ bool SceneState::remove_group_references(const StringName &p_name) {
 }
 
 bool SceneState::rename_group_references(const StringName &p_old_name, const StringName &p_new_name) {
+	_clear_instantiation_plan();
 	bool edited = false;
 	for (const NodeData &node : nodes) {
 		for (const int &group : node.groups) {
@@ -2460,6 +2927,10 @@ void SceneState::_bind_methods() {
 SceneState::SceneState() {
 }
 
+SceneState::~SceneState() {
+	_clear_instantiation_plan();
+}
+
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
@@ -2527,6 +2998,33 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+TypedArray<Node> PackedScene::instantiate_many(int p_count, GenEditState p_edit_state) const {
+#ifndef TOOLS_ENABLED
+	ERR_FAIL_COND_V_MSG(p_edit_state != GEN_EDIT_STATE_DISABLED, TypedArray<Node>(), "Edit state is only for editors, does not work without tools compiled.");
+#endif
+	ERR_FAIL_COND_V(p_count < 0, TypedArray<Node>());
+
+	const Vector<Node *> nodes = state->instantiate_many(p_count, (SceneState::GenEditState)p_edit_state);
+	const bool set_scene_file_path = !is_built_in();
+	const String scene_file_path = set_scene_file_path ? get_path() : String();
+
+	TypedArray<Node> ret;
+	ret.resize(nodes.size());
+	for (int i = 0; i < nodes.size(); i++) {
+		Node *s = nodes[i];
+		if (p_edit_state != GEN_EDIT_STATE_DISABLED) {
+			s->set_scene_instance_state(state);
+		}
+		if (set_scene_file_path) {
+			s->set_scene_file_path(scene_file_path);
+		}
+		s->notification(Node::NOTIFICATION_SCENE_INSTANTIATED);
+		ret[i] = s;
+	}
+
+	return ret;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
 	state = p_by;
 	state->set_path(get_path());
@@ -2613,6 +3111,7 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_many", "count", "edit_state"), &PackedScene::instantiate_many, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
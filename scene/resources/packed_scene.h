@@ -92,6 +92,20 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Node and connection tables with names, setters and targets resolved once,
+	// used instead of the interpreter for runtime instantiation when possible.
+	struct InstantiationPlan;
+
+	mutable BinaryMutex instantiation_plan_mutex;
+	mutable InstantiationPlan *instantiation_plan = nullptr;
+	mutable bool instantiation_plan_compiled = false;
+
+	bool _compile_instantiation_plan(InstantiationPlan &r_plan) const;
+	const InstantiationPlan *_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+	Node *_instantiate_from_plan(const InstantiationPlan &p_plan, LocalVector<Node *> &r_nodes, LocalVector<DeferredNodePathProperties> &r_deferred_node_paths) const;
+	static void _apply_deferred_node_paths(const LocalVector<DeferredNodePathProperties> &p_deferred_node_paths);
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map, HashSet<int32_t> &ids_saved);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -161,6 +175,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state) const;
+	Vector<Node *> instantiate_many(int p_count, GenEditState p_edit_state) const;
 
 	Array setup_resources_in_array(Array &array_to_scan, const SceneState::NodeData &n, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *node, const StringName sname, int i, Node **ret_nodes, SceneState::GenEditState p_edit_state) const;
 	Dictionary setup_resources_in_dictionary(Dictionary &p_dictionary_to_scan, const SceneState::NodeData &p_n, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *p_node, const StringName p_sname, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const;
@@ -239,6 +254,7 @@ public:
 #endif
 
 	SceneState();
+	~SceneState();
 };
 
 VARIANT_ENUM_CAST(SceneState::GenEditState)
@@ -271,6 +287,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	TypedArray<Node> instantiate_many(int p_count, GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
@@ -63,8 +63,14 @@ public:
 		float hb2 = 0.0f;
 		Coeffs incr_coeffs;
 
+		// Vectorized stereo processing in AudioMixKernels.
+		friend struct AudioStereoBiquadSSE2;
+		friend struct AudioStereoBiquadNEON;
+
 	public:
 		void set_filter(AudioFilterSW *p_filter, bool p_clear_history = true);
+		// Each sample depends on the previous outputs, so a single channel can't be vectorized.
+		// Stereo frames can run both channels side by side with AudioMixKernels::filter_stereo().
 		void process(float *p_samples, int p_amount, int p_stride = 1, bool p_interpolate = false);
 		void update_coeffs(int p_interp_buffer_len = 0);
 		_ALWAYS_INLINE_ void process_one(float &p_sample);
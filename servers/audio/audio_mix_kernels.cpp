@@ -0,0 +1,551 @@
+/**************************************************************************/
+/*  audio_mix_kernels.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_mix_kernels.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_MIX_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+// AVX2 is compiled per function and only used when the CPU reports it.
+#define AUDIO_MIX_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define AUDIO_MIX_NEON
+#include <arm_neon.h>
+#endif
+
+// The vectorized kernels do the same operations in the same order as the scalar ones,
+// but they are not guaranteed to be bit-identical to them: the compiler may contract the
+// scalar multiply-adds (e.g. on ARM64, or when FMA is enabled), so results can differ by rounding.
+
+/* Scalar */
+
+static void _mix_ramp_scalar(AudioFrame *p_out, const AudioFrame *p_source, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames) {
+	for (uint32_t frame_idx = 0; frame_idx < p_frames; frame_idx++) {
+		float lerp_param = (float)frame_idx / p_frames;
+		p_out[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source[frame_idx];
+	}
+}
+
+static void _mix_ramp_filtered_scalar(AudioFrame *p_out, const AudioFrame *p_source, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+	for (uint32_t frame_idx = 0; frame_idx < p_frames; frame_idx++) {
+		float lerp_param = (float)frame_idx / p_frames;
+		AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
+		AudioFrame mixed = vol * p_source[frame_idx];
+		p_processor_l->process_one_interp(mixed.left);
+		p_processor_r->process_one_interp(mixed.right);
+		p_out[frame_idx] += mixed;
+	}
+}
+
+static void _accumulate_scalar(AudioFrame *p_out, const AudioFrame *p_source, uint32_t p_frames) {
+	for (uint32_t frame_idx = 0; frame_idx < p_frames; frame_idx++) {
+		p_out[frame_idx] += p_source[frame_idx];
+	}
+}
+
+static void _filter_stereo_scalar(AudioFrame *p_frames, uint32_t p_count, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r, bool p_interpolate) {
+	if (p_interpolate) {
+		for (uint32_t i = 0; i < p_count; i++) {
+			p_processor_l->process_one_interp(p_frames[i].left);
+			p_processor_r->process_one_interp(p_frames[i].right);
+		}
+	} else {
+		for (uint32_t i = 0; i < p_count; i++) {
+			p_processor_l->process_one(p_frames[i].left);
+			p_processor_r->process_one(p_frames[i].right);
+		}
+	}
+}
+
+/* SSE2 */
+
+#ifdef AUDIO_MIX_SSE2
+
+// Runs the left and right biquads in the two lanes of a double vector, the scalar filter also works in double precision.
+struct AudioStereoBiquadSSE2 {
+	__m128d b0, b1, b2, a1, a2;
+	__m128d incr_b0, incr_b1, incr_b2, incr_a1, incr_a2;
+	__m128d ha1, ha2, hb1, hb2;
+
+	_FORCE_INLINE_ static __m128d _pair(double p_left, double p_right) {
+		return _mm_set_pd(p_right, p_left);
+	}
+
+	_FORCE_INLINE_ static void _unpair(__m128d p_value, double &r_left, double &r_right) {
+		_mm_storel_pd(&r_left, p_value);
+		_mm_storeh_pd(&r_right, p_value);
+	}
+
+	_FORCE_INLINE_ static void _unpair(__m128d p_value, float &r_left, float &r_right) {
+		double left, right;
+		_unpair(p_value, left, right);
+		r_left = left;
+		r_right = right;
+	}
+
+	_FORCE_INLINE_ AudioStereoBiquadSSE2(const AudioFilterSW::Processor *p_l, const AudioFilterSW::Processor *p_r) {
+		b0 = _pair(p_l->coeffs.b0, p_r->coeffs.b0);
+		b1 = _pair(p_l->coeffs.b1, p_r->coeffs.b1);
+		b2 = _pair(p_l->coeffs.b2, p_r->coeffs.b2);
+		a1 = _pair(p_l->coeffs.a1, p_r->coeffs.a1);
+		a2 = _pair(p_l->coeffs.a2, p_r->coeffs.a2);
+		incr_b0 = _pair(p_l->incr_coeffs.b0, p_r->incr_coeffs.b0);
+		incr_b1 = _pair(p_l->incr_coeffs.b1, p_r->incr_coeffs.b1);
+		incr_b2 = _pair(p_l->incr_coeffs.b2, p_r->incr_coeffs.b2);
+		incr_a1 = _pair(p_l->incr_coeffs.a1, p_r->incr_coeffs.a1);
+		incr_a2 = _pair(p_l->incr_coeffs.a2, p_r->incr_coeffs.a2);
+		ha1 = _pair(p_l->ha1, p_r->ha1);
+		ha2 = _pair(p_l->ha2, p_r->ha2);
+		hb1 = _pair(p_l->hb1, p_r->hb1);
+		hb2 = _pair(p_l->hb2, p_r->hb2);
+	}
+
+	_FORCE_INLINE_ void store(AudioFilterSW::Processor *p_l, AudioFilterSW::Processor *p_r) const {
+		_unpair(b0, p_l->coeffs.b0, p_r->coeffs.b0);
+		_unpair(b1, p_l->coeffs.b1, p_r->coeffs.b1);
+		_unpair(b2, p_l->coeffs.b2, p_r->coeffs.b2);
+		_unpair(a1, p_l->coeffs.a1, p_r->coeffs.a1);
+		_unpair(a2, p_l->coeffs.a2, p_r->coeffs.a2);
+		_unpair(ha1, p_l->ha1, p_r->ha1);
+		_unpair(ha2, p_l->ha2, p_r->ha2);
+		_unpair(hb1, p_l->hb1, p_r->hb1);
+		_unpair(hb2, p_l->hb2, p_r->hb2);
+	}
+
+	// Filters the frame in the low half of `p_frame`.
+	template <bool INTERPOLATE>
+	_FORCE_INLINE_ __m128 process(__m128 p_frame) {
+		__m128d in = _mm_cvtps_pd(p_frame);
+		__m128d out = _mm_mul_pd(in, b0);
+		out = _mm_add_pd(out, _mm_mul_pd(hb1, b1));
+		out = _mm_add_pd(out, _mm_mul_pd(hb2, b2));
+		out = _mm_add_pd(out, _mm_mul_pd(ha1, a1));
+		out = _mm_add_pd(out, _mm_mul_pd(ha2, a2));
+		__m128 result = _mm_cvtpd_ps(out);
+
+		ha2 = ha1;
+		hb2 = hb1;
+		hb1 = in;
+		ha1 = _mm_cvtps_pd(result);
+
+		if constexpr (INTERPOLATE) {
+			b0 = _mm_add_pd(b0, incr_b0);
+			b1 = _mm_add_pd(b1, incr_b1);
+			b2 = _mm_add_pd(b2, incr_b2);
+			a1 = _mm_add_pd(a1, incr_a1);
+			a2 = _mm_add_pd(a2, incr_a2);
+		}
+		return result;
+	}
+};
+
+_FORCE_INLINE_ static __m128 _load_frame_sse2(const AudioFrame *p_frame) {
+	return _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p_frame)));
+}
+
+_FORCE_INLINE_ static void _store_frame_sse2(AudioFrame *p_frame, __m128 p_value) {
+	_mm_storel_epi64(reinterpret_cast<__m128i *>(p_frame), _mm_castps_si128(p_value));
+}
+
+static void _mix_ramp_sse2(AudioFrame *p_out, const AudioFrame *p_source, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames) {
+	const __m128 vol_start = _mm_setr_ps(p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right);
+	const __m128 vol_final = _mm_setr_ps(p_vol_final.left, p_vol_final.right, p_vol_final.left, p_vol_final.right);
+	const __m128 frames = _mm_set1_ps((float)p_frames);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 step = _mm_set1_ps(2.0f);
+	__m128 index = _mm_setr_ps(0.0f, 0.0f, 1.0f, 1.0f);
+
+	float *out = reinterpret_cast<float *>(p_out);
+	const float *source = reinterpret_cast<const float *>(p_source);
+	uint32_t frame_idx = 0;
+	for (; frame_idx + 2 <= p_frames; frame_idx += 2) {
+		__m128 lerp_param = _mm_div_ps(index, frames);
+		__m128 vol = _mm_add_ps(_mm_mul_ps(vol_final, lerp_param), _mm_mul_ps(_mm_sub_ps(one, lerp_param), vol_start));
+		__m128 mixed = _mm_mul_ps(vol, _mm_loadu_ps(source + frame_idx * 2));
+		_mm_storeu_ps(out + frame_idx * 2, _mm_add_ps(_mm_loadu_ps(out + frame_idx * 2), mixed));
+		index = _mm_add_ps(index, step);
+	}
+	for (; frame_idx < p_frames; frame_idx++) {
+		float lerp_param = (float)frame_idx / p_frames;
+		p_out[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source[frame_idx];
+	}
+}
+
+static void _mix_ramp_filtered_sse2(AudioFrame *p_out, const AudioFrame *p_source, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+	AudioStereoBiquadSSE2 biquad(p_processor_l, p_processor_r);
+	const __m128 vol_start = _mm_setr_ps(p_vol_start.left, p_vol_start.right, 0.0f, 0.0f);
+	const __m128 vol_final = _mm_setr_ps(p_vol_final.left, p_vol_final.right, 0.0f, 0.0f);
+	const __m128 frames = _mm_set1_ps((float)p_frames);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 step = _mm_set1_ps(1.0f);
+	__m128 index = _mm_setzero_ps();
+
+	for (uint32_t frame_idx = 0; frame_idx < p_frames; frame_idx++) {
+		__m128 lerp_param = _mm_div_ps(index, frames);
+		__m128 vol = _mm_add_ps(_mm_mul_ps(vol_final, lerp_param), _mm_mul_ps(_mm_sub_ps(one, lerp_param), vol_start));
+		__m128 mixed = biquad.process<true>(_mm_mul_ps(vol, _load_frame_sse2(&p_source[frame_idx])));
+		_store_frame_sse2(&p_out[frame_idx], _mm_add_ps(_load_frame_sse2(&p_out[frame_idx]), mixed));
+		index = _mm_add_ps(index, step);
+	}
+	biquad.store(p_processor_l, p_processor_r);
+}
+
+static void _accumulate_sse2(AudioFrame *p_out, const AudioFrame *p_source, uint32_t p_frames) {
+	float *out = reinterpret_cast<float *>(p_out);
+	const float *source = reinterpret_cast<const float *>(p_source);
+	uint32_t frame_idx = 0;
+	for (; frame_idx + 2 <= p_frames; frame_idx += 2) {
+		_mm_storeu_ps(out + frame_idx * 2, _mm_add_ps(_mm_loadu_ps(out + frame_idx * 2), _mm_loadu_ps(source + frame_idx * 2)));
+	}
+	for (; frame_idx < p_frames; frame_idx++) {
+		p_out[frame_idx] += p_source[frame_idx];
+	}
+}
+
+template <bool INTERPOLATE>
+static void _filter_stereo_sse2_impl(AudioFrame *p_frames, uint32_t p_count, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+	AudioStereoBiquadSSE2 biquad(p_processor_l, p_processor_r);
+	for (uint32_t i = 0; i < p_count; i++) {
+		_store_frame_sse2(&p_frames[i], biquad.process<INTERPOLATE>(_load_frame_sse2(&p_frames[i])));
+	}
+	biquad.store(p_processor_l, p_processor_r);
+}
+
+static void _filter_stereo_sse2(AudioFrame *p_frames, uint32_t p_count, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r, bool p_interpolate) {
+	if (p_interpolate) {
+		_filter_stereo_sse2_impl<true>(p_frames, p_count, p_processor_l, p_processor_r);
+	} else {
+		_filter_stereo_sse2_impl<false>(p_frames, p_count, p_processor_l, p_processor_r);
+	}
+}
+
+#endif // AUDIO_MIX_SSE2
+
+/* AVX2 */
+
+#ifdef AUDIO_MIX_AVX2
+
+// The biquads are sequential over time, so only the ramps gain from the wider registers.
+
+__attribute__((target("avx2"))) static void _mix_ramp_avx2(AudioFrame *p_out, const AudioFrame *p_source, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames) {
+	const __m256 vol_start = _mm256_setr_ps(p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right);
+	const __m256 vol_final = _mm256_setr_ps(p_vol_final.left, p_vol_final.right, p_vol_final.left, p_vol_final.right, p_vol_final.left, p_vol_final.right, p_vol_final.left, p_vol_final.right);
+	const __m256 frames = _mm256_set1_ps((float)p_frames);
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 step = _mm256_set1_ps(4.0f);
+	__m256 index = _mm256_setr_ps(0.0f, 0.0f, 1.0f, 1.0f, 2.0f, 2.0f, 3.0f, 3.0f);
+
+	float *out = reinterpret_cast<float *>(p_out);
+	const float *source = reinterpret_cast<const float *>(p_source);
+	uint32_t frame_idx = 0;
+	for (; frame_idx + 4 <= p_frames; frame_idx += 4) {
+		__m256 lerp_param = _mm256_div_ps(index, frames);
+		__m256 vol = _mm256_add_ps(_mm256_mul_ps(vol_final, lerp_param), _mm256_mul_ps(_mm256_sub_ps(one, lerp_param), vol_start));
+		__m256 mixed = _mm256_mul_ps(vol, _mm256_loadu_ps(source + frame_idx * 2));
+		_mm256_storeu_ps(out + frame_idx * 2, _mm256_add_ps(_mm256_loadu_ps(out + frame_idx * 2), mixed));
+		index = _mm256_add_ps(index, step);
+	}
+	for (; frame_idx < p_frames; frame_idx++) {
+		float lerp_param = (float)frame_idx / p_frames;
+		p_out[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source[frame_idx];
+	}
+}
+
+__attribute__((target("avx2"))) static void _accumulate_avx2(AudioFrame *p_out, const AudioFrame *p_source, uint32_t p_frames) {
+	float *out = reinterpret_cast<float *>(p_out);
+	const float *source = reinterpret_cast<const float *>(p_source);
+	uint32_t frame_idx = 0;
+	for (; frame_idx + 4 <= p_frames; frame_idx += 4) {
+		_mm256_storeu_ps(out + frame_idx * 2, _mm256_add_ps(_mm256_loadu_ps(out + frame_idx * 2), _mm256_loadu_ps(source + frame_idx * 2)));
+	}
+	for (; frame_idx < p_frames; frame_idx++) {
+		p_out[frame_idx] += p_source[frame_idx];
+	}
+}
+
+#endif // AUDIO_MIX_AVX2
+
+/* NEON */
+
+#ifdef AUDIO_MIX_NEON
+
+struct AudioStereoBiquadNEON {
+	float64x2_t b0, b1, b2, a1, a2;
+	float64x2_t incr_b0, incr_b1, incr_b2, incr_a1, incr_a2;
+	float64x2_t ha1, ha2, hb1, hb2;
+
+	_FORCE_INLINE_ static float64x2_t _pair(double p_left, double p_right) {
+		float64x2_t value = vdupq_n_f64(p_left);
+		return vsetq_lane_f64(p_right, value, 1);
+	}
+
+	_FORCE_INLINE_ static void _unpair(float64x2_t p_value, double &r_left, double &r_right) {
+		r_left = vgetq_lane_f64(p_value, 0);
+		r_right = vgetq_lane_f64(p_value, 1);
+	}
+
+	_FORCE_INLINE_ static void _unpair(float64x2_t p_value, float &r_left, float &r_right) {
+		r_left = vgetq_lane_f64(p_value, 0);
+		r_right = vgetq_lane_f64(p_value, 1);
+	}
+
+	_FORCE_INLINE_ AudioStereoBiquadNEON(const AudioFilterSW::Processor *p_l, const AudioFilterSW::Processor *p_r) {
+		b0 = _pair(p_l->coeffs.b0, p_r->coeffs.b0);
+		b1 = _pair(p_l->coeffs.b1, p_r->coeffs.b1);
+		b2 = _pair(p_l->coeffs.b2, p_r->coeffs.b2);
+		a1 = _pair(p_l->coeffs.a1, p_r->coeffs.a1);
+		a2 = _pair(p_l->coeffs.a2, p_r->coeffs.a2);
+		incr_b0 = _pair(p_l->incr_coeffs.b0, p_r->incr_coeffs.b0);
+		incr_b1 = _pair(p_l->incr_coeffs.b1, p_r->incr_coeffs.b1);
+		incr_b2 = _pair(p_l->incr_coeffs.b2, p_r->incr_coeffs.b2);
+		incr_a1 = _pair(p_l->incr_coeffs.a1, p_r->incr_coeffs.a1);
+		incr_a2 = _pair(p_l->incr_coeffs.a2, p_r->incr_coeffs.a2);
+		ha1 = _pair(p_l->ha1, p_r->ha1);
+		ha2 = _pair(p_l->ha2, p_r->ha2);
+		hb1 = _pair(p_l->hb1, p_r->hb1);
+		hb2 = _pair(p_l->hb2, p_r->hb2);
+	}
+
+	_FORCE_INLINE_ void store(AudioFilterSW::Processor *p_l, AudioFilterSW::Processor *p_r) const {
+		_unpair(b0, p_l->coeffs.b0, p_r->coeffs.b0);
+		_unpair(b1, p_l->coeffs.b1, p_r->coeffs.b1);
+		_unpair(b2, p_l->coeffs.b2, p_r->coeffs.b2);
+		_unpair(a1, p_l->coeffs.a1, p_r->coeffs.a1);
+		_unpair(a2, p_l->coeffs.a2, p_r->coeffs.a2);
+		_unpair(ha1, p_l->ha1, p_r->ha1);
+		_unpair(ha2, p_l->ha2, p_r->ha2);
+		_unpair(hb1, p_l->hb1, p_r->hb1);
+		_unpair(hb2, p_l->hb2, p_r->hb2);
+	}
+
+	template <bool INTERPOLATE>
+	_FORCE_INLINE_ float32x2_t process(float32x2_t p_frame) {
+		float64x2_t in = vcvt_f64_f32(p_frame);
+		float64x2_t out = vmulq_f64(in, b0);
+		out = vaddq_f64(out, vmulq_f64(hb1, b1));
+		out = vaddq_f64(out, vmulq_f64(hb2, b2));
+		out = vaddq_f64(out, vmulq_f64(ha1, a1));
+		out = vaddq_f64(out, vmulq_f64(ha2, a2));
+		float32x2_t result = vcvt_f32_f64(out);
+
+		ha2 = ha1;
+		hb2 = hb1;
+		hb1 = in;
+		ha1 = vcvt_f64_f32(result);
+
+		if constexpr (INTERPOLATE) {
+			b0 = vaddq_f64(b0, incr_b0);
+			b1 = vaddq_f64(b1, incr_b1);
+			b2 = vaddq_f64(b2, incr_b2);
+			a1 = vaddq_f64(a1, incr_a1);
+			a2 = vaddq_f64(a2, incr_a2);
+		}
+		return result;
+	}
+};
+
+static void _mix_ramp_neon(AudioFrame *p_out, const AudioFrame *p_source, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames) {
+	const float start_values[4] = { p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right };
+	const float final_values[4] = { p_vol_final.left, p_vol_final.right, p_vol_final.left, p_vol_final.right };
+	const float index_values[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+	const float32x4_t vol_start = vld1q_f32(start_values);
+	const float32x4_t vol_final = vld1q_f32(final_values);
+	const float32x4_t frames = vdupq_n_f32((float)p_frames);
+	const float32x4_t one = vdupq_n_f32(1.0f);
+	const float32x4_t step = vdupq_n_f32(2.0f);
+	float32x4_t index = vld1q_f32(index_values);
+
+	float *out = reinterpret_cast<float *>(p_out);
+	const float *source = reinterpret_cast<const float *>(p_source);
+	uint32_t frame_idx = 0;
+	for (; frame_idx + 2 <= p_frames; frame_idx += 2) {
+		float32x4_t lerp_param = vdivq_f32(index, frames);
+		float32x4_t vol = vaddq_f32(vmulq_f32(vol_final, lerp_param), vmulq_f32(vsubq_f32(one, lerp_param), vol_start));
+		float32x4_t mixed = vmulq_f32(vol, vld1q_f32(source + frame_idx * 2));
+		vst1q_f32(out + frame_idx * 2, vaddq_f32(vld1q_f32(out + frame_idx * 2), mixed));
+		index = vaddq_f32(index, step);
+	}
+	for (; frame_idx < p_frames; frame_idx++) {
+		float lerp_param = (float)frame_idx / p_frames;
+		p_out[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source[frame_idx];
+	}
+}
+
+static void _mix_ramp_filtered_neon(AudioFrame *p_out, const AudioFrame *p_source, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+	AudioStereoBiquadNEON biquad(p_processor_l, p_processor_r);
+	const float32x2_t vol_start = vld1_f32(p_vol_start.levels);
+	const float32x2_t vol_final = vld1_f32(p_vol_final.levels);
+	const float32x2_t frames = vdup_n_f32((float)p_frames);
+	const float32x2_t one = vdup_n_f32(1.0f);
+	float32x2_t index = vdup_n_f32(0.0f);
+
+	for (uint32_t frame_idx = 0; frame_idx < p_frames; frame_idx++) {
+		float32x2_t lerp_param = vdiv_f32(index, frames);
+		float32x2_t vol = vadd_f32(vmul_f32(vol_final, lerp_param), vmul_f32(vsub_f32(one, lerp_param), vol_start));
+		float32x2_t mixed = biquad.process<true>(vmul_f32(vol, vld1_f32(p_source[frame_idx].levels)));
+		vst1_f32(p_out[frame_idx].levels, vadd_f32(vld1_f32(p_out[frame_idx].levels), mixed));
+		index = vadd_f32(index, one);
+	}
+	biquad.store(p_processor_l, p_processor_r);
+}
+
+static void _accumulate_neon(AudioFrame *p_out, const AudioFrame *p_source, uint32_t p_frames) {
+	float *out = reinterpret_cast<float *>(p_out);
+	const float *source = reinterpret_cast<const float *>(p_source);
+	uint32_t frame_idx = 0;
+	for (; frame_idx + 2 <= p_frames; frame_idx += 2) {
+		vst1q_f32(out + frame_idx * 2, vaddq_f32(vld1q_f32(out + frame_idx * 2), vld1q_f32(source + frame_idx * 2)));
+	}
+	for (; frame_idx < p_frames; frame_idx++) {
+		p_out[frame_idx] += p_source[frame_idx];
+	}
+}
+
+template <bool INTERPOLATE>
+static void _filter_stereo_neon_impl(AudioFrame *p_frames, uint32_t p_count, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+	AudioStereoBiquadNEON biquad(p_processor_l, p_processor_r);
+	for (uint32_t i = 0; i < p_count; i++) {
+		vst1_f32(p_frames[i].levels, biquad.process<INTERPOLATE>(vld1_f32(p_frames[i].levels)));
+	}
+	biquad.store(p_processor_l, p_processor_r);
+}
+
+static void _filter_stereo_neon(AudioFrame *p_frames, uint32_t p_count, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r, bool p_interpolate) {
+	if (p_interpolate) {
+		_filter_stereo_neon_impl<true>(p_frames, p_count, p_processor_l, p_processor_r);
+	} else {
+		_filter_stereo_neon_impl<false>(p_frames, p_count, p_processor_l, p_processor_r);
+	}
+}
+
+#endif // AUDIO_MIX_NEON
+
+/* Selection */
+
+AudioMixKernels::Functions AudioMixKernels::functions = {
+	_mix_ramp_scalar,
+	_mix_ramp_filtered_scalar,
+	_accumulate_scalar,
+	_filter_stereo_scalar,
+};
+AudioMixKernels::Backend AudioMixKernels::backend = AudioMixKernels::BACKEND_SCALAR;
+
+bool AudioMixKernels::_get_functions(Backend p_backend, Functions &r_functions) {
+	if (!is_backend_supported(p_backend)) {
+		return false;
+	}
+
+	switch (p_backend) {
+		case BACKEND_SCALAR: {
+			r_functions.mix_ramp = _mix_ramp_scalar;
+			r_functions.mix_ramp_filtered = _mix_ramp_filtered_scalar;
+			r_functions.accumulate = _accumulate_scalar;
+			r_functions.filter_stereo = _filter_stereo_scalar;
+		} break;
+#ifdef AUDIO_MIX_SSE2
+		case BACKEND_SSE2: {
+			r_functions.mix_ramp = _mix_ramp_sse2;
+			r_functions.mix_ramp_filtered = _mix_ramp_filtered_sse2;
+			r_functions.accumulate = _accumulate_sse2;
+			r_functions.filter_stereo = _filter_stereo_sse2;
+		} break;
+#endif
+#ifdef AUDIO_MIX_AVX2
+		case BACKEND_AVX2: {
+			r_functions.mix_ramp = _mix_ramp_avx2;
+			r_functions.mix_ramp_filtered = _mix_ramp_filtered_sse2;
+			r_functions.accumulate = _accumulate_avx2;
+			r_functions.filter_stereo = _filter_stereo_sse2;
+		} break;
+#endif
+#ifdef AUDIO_MIX_NEON
+		case BACKEND_NEON: {
+			r_functions.mix_ramp = _mix_ramp_neon;
+			r_functions.mix_ramp_filtered = _mix_ramp_filtered_neon;
+			r_functions.accumulate = _accumulate_neon;
+			r_functions.filter_stereo = _filter_stereo_neon;
+		} break;
+#endif
+		default: {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool AudioMixKernels::is_backend_supported(Backend p_backend) {
+	switch (p_backend) {
+		case BACKEND_SCALAR:
+			return true;
+		case BACKEND_SSE2:
+#ifdef AUDIO_MIX_SSE2
+			return true;
+#else
+			return false;
+#endif
+		case BACKEND_AVX2:
+#ifdef AUDIO_MIX_AVX2
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2");
+#else
+			return false;
+#endif
+		case BACKEND_NEON:
+#ifdef AUDIO_MIX_NEON
+			return true;
+#else
+			return false;
+#endif
+		default:
+			return false;
+	}
+}
+
+AudioMixKernels::Backend AudioMixKernels::get_best_backend() {
+	for (int i = BACKEND_MAX - 1; i > BACKEND_SCALAR; i--) {
+		if (is_backend_supported(Backend(i))) {
+			return Backend(i);
+		}
+	}
+	return BACKEND_SCALAR;
+}
+
+void AudioMixKernels::set_backend(Backend p_backend) {
+	ERR_FAIL_INDEX(p_backend, BACKEND_MAX);
+	Functions new_functions;
+	ERR_FAIL_COND_MSG(!_get_functions(p_backend, new_functions), "Audio mix backend is not supported on this CPU.");
+	functions = new_functions;
+	backend = p_backend;
+}
@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*  audio_mix_kernels.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/audio_frame.h"
+#include "servers/audio/audio_filter_sw.h"
+
+// Inner loops of the audio mixer, with vectorized versions picked for the running CPU.
+class AudioMixKernels {
+public:
+	enum Backend {
+		BACKEND_SCALAR,
+		BACKEND_SSE2,
+		BACKEND_AVX2,
+		BACKEND_NEON,
+		BACKEND_MAX
+	};
+
+	struct Functions {
+		void (*mix_ramp)(AudioFrame *p_out, const AudioFrame *p_source, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames) = nullptr;
+		void (*mix_ramp_filtered)(AudioFrame *p_out, const AudioFrame *p_source, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) = nullptr;
+		void (*accumulate)(AudioFrame *p_out, const AudioFrame *p_source, uint32_t p_frames) = nullptr;
+		void (*filter_stereo)(AudioFrame *p_frames, uint32_t p_count, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r, bool p_interpolate) = nullptr;
+	};
+
+private:
+	static Functions functions;
+	static Backend backend;
+
+	static bool _get_functions(Backend p_backend, Functions &r_functions);
+
+public:
+	// Adds `p_source` to `p_out`, with the volume going linearly from `p_vol_start` towards `p_vol_final` over `p_frames`.
+	_FORCE_INLINE_ static void mix_ramp(AudioFrame *p_out, const AudioFrame *p_source, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames) {
+		functions.mix_ramp(p_out, p_source, p_vol_start, p_vol_final, p_frames);
+	}
+	// Same as mix_ramp(), but runs each channel through its filter (interpolating the coefficients) before adding it.
+	_FORCE_INLINE_ static void mix_ramp_filtered(AudioFrame *p_out, const AudioFrame *p_source, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+		functions.mix_ramp_filtered(p_out, p_source, p_vol_start, p_vol_final, p_frames, p_processor_l, p_processor_r);
+	}
+	_FORCE_INLINE_ static void accumulate(AudioFrame *p_out, const AudioFrame *p_source, uint32_t p_frames) {
+		functions.accumulate(p_out, p_source, p_frames);
+	}
+	// Filters both channels in place, the left and right processors run side by side.
+	_FORCE_INLINE_ static void filter_stereo(AudioFrame *p_frames, uint32_t p_count, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r, bool p_interpolate = false) {
+		functions.filter_stereo(p_frames, p_count, p_processor_l, p_processor_r, p_interpolate);
+	}
+
+	static bool is_backend_supported(Backend p_backend);
+	static Backend get_best_backend();
+	static Backend get_backend() { return backend; }
+	// Not thread-safe, meant for tests and benchmarks. Mixing must not be running.
+	static void set_backend(Backend p_backend);
+};
@@ -41,6 +41,7 @@
 #include "core/templates/pair.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_mix_kernels.h"
 #include "servers/audio/audio_stream.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
@@ -349,6 +350,64 @@ void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
 #endif
 }
 
+void AudioServer::_mix_thread_func(void *p_userdata) {
+	AudioServer *audio_server = static_cast<AudioServer *>(p_userdata);
+	while (true) {
+		audio_server->mix_work_semaphore.wait();
+		if (audio_server->mix_threads_exit.is_set()) {
+			break;
+		}
+		audio_server->_mix_job_drain();
+		audio_server->mix_done_semaphore.post();
+	}
+}
+
+void AudioServer::_mix_job_drain() {
+	while (true) {
+		uint32_t index = mix_job_next.postincrement();
+		if (index >= mix_job_end) {
+			break;
+		}
+		(this->*mix_job)(index);
+	}
+}
+
+// Scripted and GDExtension effects aren't written to run concurrently, so they stay on the audio thread.
+// This looks the class up in ClassDB, so call it when the effect is instantiated, not while mixing.
+static bool _can_mix_on_helper_thread(const Object *p_object) {
+	if (p_object->get_script_instance()) {
+		return false;
+	}
+	const ClassDB::APIType api = ClassDB::get_api_type(p_object->get_class_name());
+	return api != ClassDB::API_EXTENSION && api != ClassDB::API_EDITOR_EXTENSION;
+}
+
+static bool _uses_sidechain(const Ref<AudioEffect> &p_effect) {
+	const AudioEffectCompressor *compressor = Object::cast_to<AudioEffectCompressor>(p_effect.ptr());
+	return compressor && compressor->get_sidechain() != StringName();
+}
+
+void AudioServer::_run_mix_job(void (AudioServer::*p_job)(uint32_t), uint32_t p_begin, uint32_t p_end) {
+	int helpers = MIN(mix_thread_count, int(p_end - p_begin) - 1);
+	if (helpers <= 0) {
+		for (uint32_t i = p_begin; i < p_end; i++) {
+			(this->*p_job)(i);
+		}
+		return;
+	}
+
+	mix_job = p_job;
+	mix_job_end = p_end;
+	mix_job_next.set(p_begin);
+
+	// The audio thread takes its share of the work too, and then waits for every helper it woke up.
+	mix_work_semaphore.post(helpers);
+	_mix_job_drain();
+	for (int i = 0; i < helpers; i++) {
+		mix_done_semaphore.wait();
+	}
+}
+
 void AudioServer::_mix_step() {
 	bool solo_mode = false;
 
@@ -386,6 +445,8 @@ void AudioServer::_mix_step() {
 			bus->soloed = false;
 		}
 	}
+	mix_solo_mode = solo_mode;
+
 	// This is legacy code from 3.x that allows video players and other audio sources that do not implement AudioStreamPlayback to output audio.
 	for (CallbackItem *ci : mix_callback_list) {
 		ci->callback(ci->userdata);
@@ -394,6 +455,8 @@ void AudioServer::_mix_step() {
 	// Main mixing loop for audio streams.
 	// The basic idea here is to copy the samples returned by the AudioStreamPlayback's mix function into the audio buffers,
 	//  while always maintaining a lookahead buffer of size LOOKAHEAD_BUFFER_SIZE to allow fade-outs for sudden stoppages.
+	// Streams are rendered in parallel first, then mixed into the buses in order on the audio thread.
+	mix_items.clear();
 	for (AudioStreamPlaybackListNode *playback : playback_list) {
 		// Paused streams are no-ops. Don't even mix audio from the stream playback.
 		if (playback->state.load() == AudioStreamPlaybackListNode::PAUSED) {
@@ -404,275 +467,404 @@ void AudioServer::_mix_step() {
 			continue;
 		}
 
+		MixItem item;
+		item.playback = playback;
 		// If `fading_out` is true, we're in the process of fading out the stream playback.
 		// TODO: Currently this sets the volume of the stream to 0 which creates a linear interpolation between its previous volume and silence.
 		//  A more punchy option for fading out could be to just use the lookahead buffer.
-		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
-
-		AudioFrame *buf = mix_buffer.ptrw();
-
-		// Copy the old contents of the lookahead buffer into the beginning of the mix buffer.
-		for (int i = 0; i < LOOKAHEAD_BUFFER_SIZE; i++) {
-			buf[i] = playback->lookahead[i];
-		}
+		item.fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
+		item.threaded = playback->stream_playback->can_mix_on_helper_thread();
+		mix_items.push_back(item);
+	}
 
-		// Mix the audio stream.
-		unsigned int mixed_frames = playback->stream_playback->mix(&buf[LOOKAHEAD_BUFFER_SIZE], playback->pitch_scale.get(), buffer_size);
+	const uint32_t mix_stride = buffer_size + LOOKAHEAD_BUFFER_SIZE;
+	if (mix_buffer.size() < mix_items.size() * mix_stride) {
+		mix_buffer.resize(mix_items.size() * mix_stride);
+	}
 
-		if (tag_used_audio_streams && playback->stream_playback->is_playing()) {
-			playback->stream_playback->tag_used_streams();
+	_run_mix_job(&AudioServer::_mix_playback_job, 0, mix_items.size());
+	for (uint32_t i = 0; i < mix_items.size(); i++) {
+		if (!mix_items[i].threaded) {
+			_mix_playback(i);
 		}
+	}
 
-		// Check to see if the stream has run out of samples.
-		if (mixed_frames != buffer_size) {
-			// We know we have at least the size of our lookahead buffer for fade-out purposes.
+	for (uint32_t i = 0; i < mix_items.size(); i++) {
+		_mix_playback_to_buses(i);
+	}
 
-			float fadeout_base = 0.94;
-			float fadeout_coefficient = 1;
-			static_assert(LOOKAHEAD_BUFFER_SIZE == 64, "Update fadeout_base and comment here if you change LOOKAHEAD_BUFFER_SIZE.");
-			// 0.94 ^ 64 = 0.01906. There might still be a pop but it'll be way better than if we didn't do this.
-			for (unsigned int idx = mixed_frames; idx < buffer_size; idx++) {
-				fadeout_coefficient *= fadeout_base;
-				buf[idx] *= fadeout_coefficient;
-			}
-			AudioStreamPlaybackListNode::PlaybackState new_state;
-			new_state = AudioStreamPlaybackListNode::AWAITING_DELETION;
-			playback->state.store(new_state);
-		} else {
-			// Move the last little bit of what we just mixed into our lookahead buffer for the next call to _mix_step.
-			for (int i = 0; i < LOOKAHEAD_BUFFER_SIZE; i++) {
-				playback->lookahead[i] = buf[buffer_size + i];
+	// Now that all of the buses have their audio sources mixed into them, we can process the effects and bus sends.
+	const uint32_t bus_count = buses.size();
+	bus_send_index.resize(bus_count);
+	bus_depth.resize(bus_count);
+	for (uint32_t i = 0; i < bus_count; i++) {
+		bus_depth[i] = 0;
+	}
+	bus_send_index[0] = -1;
+	uint32_t max_depth = 0;
+	for (int i = bus_count - 1; i > 0; i--) {
+		Bus *bus = buses[i];
+		// Everything has a send except for the master bus.
+		int send = 0;
+		if (bus_map.has(bus->send)) {
+			send = bus_map[bus->send]->index_cache;
+			if (send >= i) { // Invalid, send to master.
+				send = 0;
 			}
 		}
+		bus_send_index[i] = send;
+		bus_depth[send] = MAX(bus_depth[send], bus_depth[i] + 1);
+		max_depth = MAX(max_depth, bus_depth[send]);
+	}
 
-		// Get the bus details for this playback. This contains information about which buses the playback is assigned to and the volume of the playback on each bus.
-		AudioStreamPlaybackBusDetails *bus_details_ptr = playback->bus_details.load();
-		ERR_FAIL_NULL(bus_details_ptr);
-		// Make a copy of the bus details so we can modify it without worrying about other threads.
-		AudioStreamPlaybackBusDetails bus_details = *bus_details_ptr;
-
-		// Mix to any active buses.
-		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
-			if (!bus_details.bus_active[idx]) {
-				continue;
+	// Within a level, keep the order of the serial mixer (last bus first).
+	bus_order.clear();
+	bus_level_end.clear();
+	for (uint32_t depth = 0; depth <= max_depth; depth++) {
+		for (int i = bus_count - 1; i >= 0; i--) {
+			if (bus_depth[i] == depth) {
+				bus_order.push_back(i);
 			}
-			// This is the AudioServer-internal index of the bus we're mixing to in this step of the loop. Not to be confused with `idx` which is an index into `AudioStreamPlaybackBusDetails` member var arrays.
-			int bus_idx = thread_find_bus_index(bus_details.bus[idx]);
+		}
+		bus_level_end.push_back(bus_order.size());
+	}
 
-			// It's important to know whether or not this bus was active in the previous mix step of this stream. If it was, we need to perform volume interpolation to avoid pops.
-			int prev_bus_idx = -1;
-			for (int search_idx = 0; search_idx < MAX_BUSES_PER_PLAYBACK; search_idx++) {
-				if (!playback->prev_bus_details->bus_active[search_idx]) {
+	bus_mix_serial = false;
+	bus_threaded.resize(bus_count);
+	for (uint32_t i = 0; i < bus_count; i++) {
+		const Bus *bus = buses[i];
+		bool threaded = true;
+		if (!bus->bypass) {
+			for (int j = 0; j < bus->effects.size(); j++) {
+				if (!bus->effects[j].enabled) {
 					continue;
 				}
-				// If the StringNames of the buses match, we've found the previous bus index. This indicates that this playback mixed to `prev_bus_details->bus[prev_bus_index]` in the previous mix step, which gives us a way to look up the playback's previous volume.
-				if (playback->prev_bus_details->bus[search_idx].hash() == bus_details.bus[idx].hash()) {
-					prev_bus_idx = search_idx;
-					break;
+				if (!bus->effects[j].mix_on_helper_thread) {
+					threaded = false;
+				}
+				if (_uses_sidechain(bus->effects[j].effect)) {
+					bus_mix_serial = true;
 				}
 			}
+		}
+		bus_threaded[i] = threaded;
+	}
 
-			// It's now time to mix to the bus. We do this by going through each channel of the bus and mixing to it.
-			//  The channels correspond to output channels of the audio device, e.g. stereo or 5.1. To reduce needless nesting, this is done with a helper method named `_mix_step_for_channel`.
-			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
-				AudioFrame *channel_buf = thread_get_channel_mix_buffer(bus_idx, channel_idx);
-				// TODO: This `fading_out` check could be replaced with with an exponential fadeout of the samples from the lookahead buffer for more punchy results.
-				if (fading_out) {
-					bus_details.volume[idx][channel_idx] = AudioFrame(0, 0);
-				}
-				AudioFrame channel_vol = bus_details.volume[idx][channel_idx];
+	if (bus_mix_serial) {
+		bus_order.clear();
+		for (int i = bus_count - 1; i >= 0; i--) {
+			bus_order.push_back(i);
+		}
+		for (uint32_t i = 0; i < bus_count; i++) {
+			_mix_bus(i);
+		}
 
-				// If this bus was not active in the previous mix step, we want to start playback at the full volume to avoid crushing transients.
-				AudioFrame prev_channel_vol = channel_vol;
-				// If this bus was active in the previous mix step, we need to interpolate between the previous volume and the current volume to avoid pops. Set `prev_channel_volume` accordingly.
-				if (prev_bus_idx != -1) {
-					prev_channel_vol = playback->prev_bus_details->volume[prev_bus_idx][channel_idx];
-				}
-				_mix_step_for_channel(channel_buf, buf, prev_channel_vol, channel_vol, playback->attenuation_filter_cutoff_hz.get(), playback->highshelf_gain.get(), &playback->filter_process[channel_idx * 2], &playback->filter_process[channel_idx * 2 + 1]);
+		mix_frames += buffer_size;
+		to_mix = buffer_size;
+		return;
+	}
+
+	// Buses in the same level don't depend on each other, so the ones kept on the audio thread can run last.
+	uint32_t level_begin = 0;
+	for (uint32_t level_end : bus_level_end) {
+		_run_mix_job(&AudioServer::_mix_bus_job, level_begin, level_end);
+		for (uint32_t i = level_begin; i < level_end; i++) {
+			if (!bus_threaded[bus_order[i]]) {
+				_mix_bus(i);
 			}
 		}
+		level_begin = level_end;
+	}
+
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
+
+void AudioServer::_mix_playback_job(uint32_t p_item) {
+	if (mix_items[p_item].threaded) {
+		_mix_playback(p_item);
+	}
+}
+
+void AudioServer::_mix_bus_job(uint32_t p_order) {
+	if (bus_threaded[bus_order[p_order]]) {
+		_mix_bus(p_order);
+	}
+}
+
+void AudioServer::_mix_playback(uint32_t p_item) {
+	AudioStreamPlaybackListNode *playback = mix_items[p_item].playback;
+	AudioFrame *buf = mix_buffer.ptr() + p_item * (buffer_size + LOOKAHEAD_BUFFER_SIZE);
+
+	// Copy the old contents of the lookahead buffer into the beginning of the mix buffer.
+	for (int i = 0; i < LOOKAHEAD_BUFFER_SIZE; i++) {
+		buf[i] = playback->lookahead[i];
+	}
+
+	// Mix the audio stream.
+	unsigned int mixed_frames = playback->stream_playback->mix(&buf[LOOKAHEAD_BUFFER_SIZE], playback->pitch_scale.get(), buffer_size);
+
+	// Check to see if the stream has run out of samples.
+	if (mixed_frames != buffer_size) {
+		// We know we have at least the size of our lookahead buffer for fade-out purposes.
+
+		float fadeout_base = 0.94;
+		float fadeout_coefficient = 1;
+		static_assert(LOOKAHEAD_BUFFER_SIZE == 64, "Update fadeout_base and comment here if you change LOOKAHEAD_BUFFER_SIZE.");
+		// 0.94 ^ 64 = 0.01906. There might still be a pop but it'll be way better than if we didn't do this.
+		for (unsigned int idx = mixed_frames; idx < buffer_size; idx++) {
+			fadeout_coefficient *= fadeout_base;
+			buf[idx] *= fadeout_coefficient;
+		}
+		AudioStreamPlaybackListNode::PlaybackState new_state;
+		new_state = AudioStreamPlaybackListNode::AWAITING_DELETION;
+		playback->state.store(new_state);
+	} else {
+		// Move the last little bit of what we just mixed into our lookahead buffer for the next call to _mix_step.
+		for (int i = 0; i < LOOKAHEAD_BUFFER_SIZE; i++) {
+			playback->lookahead[i] = buf[buffer_size + i];
+		}
+	}
+}
+
+void AudioServer::_mix_playback_to_buses(uint32_t p_item) {
+	AudioStreamPlaybackListNode *playback = mix_items[p_item].playback;
+	bool fading_out = mix_items[p_item].fading_out;
+	AudioFrame *buf = mix_buffer.ptr() + p_item * (buffer_size + LOOKAHEAD_BUFFER_SIZE);
 
-		// Now go through and fade-out any buses that were being played to previously that we missed by going through current data.
-		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
-			if (!playback->prev_bus_details->bus_active[idx]) {
+	// Streams may be shared between playbacks, so tagging is done here rather than while rendering.
+	if (tag_used_audio_streams && playback->stream_playback->is_playing()) {
+		playback->stream_playback->tag_used_streams();
+	}
+
+	// Get the bus details for this playback. This contains information about which buses the playback is assigned to and the volume of the playback on each bus.
+	AudioStreamPlaybackBusDetails *bus_details_ptr = playback->bus_details.load();
+	ERR_FAIL_NULL(bus_details_ptr);
+	// Make a copy of the bus details so we can modify it without worrying about other threads.
+	AudioStreamPlaybackBusDetails bus_details = *bus_details_ptr;
+
+	// Mix to any active buses.
+	for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+		if (!bus_details.bus_active[idx]) {
+			continue;
+		}
+		// This is the AudioServer-internal index of the bus we're mixing to in this step of the loop. Not to be confused with `idx` which is an index into `AudioStreamPlaybackBusDetails` member var arrays.
+		int bus_idx = thread_find_bus_index(bus_details.bus[idx]);
+
+		// It's important to know whether or not this bus was active in the previous mix step of this stream. If it was, we need to perform volume interpolation to avoid pops.
+		int prev_bus_idx = -1;
+		for (int search_idx = 0; search_idx < MAX_BUSES_PER_PLAYBACK; search_idx++) {
+			if (!playback->prev_bus_details->bus_active[search_idx]) {
 				continue;
 			}
-			int bus_idx = thread_find_bus_index(playback->prev_bus_details->bus[idx]);
-
-			int current_bus_idx = -1;
-			for (int search_idx = 0; search_idx < MAX_BUSES_PER_PLAYBACK; search_idx++) {
-				if (bus_details.bus[search_idx] == playback->prev_bus_details->bus[idx]) {
-					current_bus_idx = search_idx;
-				}
+			// If the StringNames of the buses match, we've found the previous bus index. This indicates that this playback mixed to `prev_bus_details->bus[prev_bus_index]` in the previous mix step, which gives us a way to look up the playback's previous volume.
+			if (playback->prev_bus_details->bus[search_idx].hash() == bus_details.bus[idx].hash()) {
+				prev_bus_idx = search_idx;
+				break;
 			}
-			if (current_bus_idx != -1) {
-				// If we found a corresponding bus in the current bus assignments, we've already mixed to this bus.
-				continue;
+		}
+
+		// It's now time to mix to the bus. We do this by going through each channel of the bus and mixing to it.
+		//  The channels correspond to output channels of the audio device, e.g. stereo or 5.1. To reduce needless nesting, this is done with a helper method named `_mix_step_for_channel`.
+		for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+			AudioFrame *channel_buf = thread_get_channel_mix_buffer(bus_idx, channel_idx);
+			// TODO: This `fading_out` check could be replaced with with an exponential fadeout of the samples from the lookahead buffer for more punchy results.
+			if (fading_out) {
+				bus_details.volume[idx][channel_idx] = AudioFrame(0, 0);
 			}
+			AudioFrame channel_vol = bus_details.volume[idx][channel_idx];
 
-			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
-				AudioFrame *channel_buf = thread_get_channel_mix_buffer(bus_idx, channel_idx);
-				AudioFrame prev_channel_vol = playback->prev_bus_details->volume[idx][channel_idx];
-				// Fade out to silence. This could be replaced with an exponential fadeout of the samples from the lookahead buffer for more punchy results.
-				_mix_step_for_channel(channel_buf, buf, prev_channel_vol, AudioFrame(0, 0), playback->attenuation_filter_cutoff_hz.get(), playback->highshelf_gain.get(), &playback->filter_process[channel_idx * 2], &playback->filter_process[channel_idx * 2 + 1]);
+			// If this bus was not active in the previous mix step, we want to start playback at the full volume to avoid crushing transients.
+			AudioFrame prev_channel_vol = channel_vol;
+			// If this bus was active in the previous mix step, we need to interpolate between the previous volume and the current volume to avoid pops. Set `prev_channel_volume` accordingly.
+			if (prev_bus_idx != -1) {
+				prev_channel_vol = playback->prev_bus_details->volume[prev_bus_idx][channel_idx];
 			}
+			_mix_step_for_channel(channel_buf, buf, prev_channel_vol, channel_vol, playback->attenuation_filter_cutoff_hz.get(), playback->highshelf_gain.get(), &playback->filter_process[channel_idx * 2], &playback->filter_process[channel_idx * 2 + 1]);
 		}
+	}
 
-		// Copy the bus details we mixed with to the previous bus details to maintain volume ramps.
-		for (int i = 0; i < MAX_BUSES_PER_PLAYBACK; i++) {
-			playback->prev_bus_details->bus_active[i] = bus_details.bus_active[i];
-		}
-		for (int i = 0; i < MAX_BUSES_PER_PLAYBACK; i++) {
-			playback->prev_bus_details->bus[i] = bus_details.bus[i];
+	// Now go through and fade-out any buses that were being played to previously that we missed by going through current data.
+	for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+		if (!playback->prev_bus_details->bus_active[idx]) {
+			continue;
 		}
-		for (int i = 0; i < MAX_BUSES_PER_PLAYBACK; i++) {
-			for (int j = 0; j < MAX_CHANNELS_PER_BUS; j++) {
-				playback->prev_bus_details->volume[i][j] = bus_details.volume[i][j];
+		int bus_idx = thread_find_bus_index(playback->prev_bus_details->bus[idx]);
+
+		int current_bus_idx = -1;
+		for (int search_idx = 0; search_idx < MAX_BUSES_PER_PLAYBACK; search_idx++) {
+			if (bus_details.bus[search_idx] == playback->prev_bus_details->bus[idx]) {
+				current_bus_idx = search_idx;
 			}
 		}
+		if (current_bus_idx != -1) {
+			// If we found a corresponding bus in the current bus assignments, we've already mixed to this bus.
+			continue;
+		}
 
-		switch (playback->state.load()) {
-			case AudioStreamPlaybackListNode::AWAITING_DELETION:
-			case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
-				// Remove the playback from the list.
-				_delete_stream_playback_list_node(playback);
-				break;
-			case AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE: {
-				// Pause the stream.
-				playback->state.store(AudioStreamPlaybackListNode::PAUSED);
-			} break;
-			case AudioStreamPlaybackListNode::PLAYING:
-			case AudioStreamPlaybackListNode::PAUSED:
-				// No-op!
-				break;
+		for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+			AudioFrame *channel_buf = thread_get_channel_mix_buffer(bus_idx, channel_idx);
+			AudioFrame prev_channel_vol = playback->prev_bus_details->volume[idx][channel_idx];
+			// Fade out to silence. This could be replaced with an exponential fadeout of the samples from the lookahead buffer for more punchy results.
+			_mix_step_for_channel(channel_buf, buf, prev_channel_vol, AudioFrame(0, 0), playback->attenuation_filter_cutoff_hz.get(), playback->highshelf_gain.get(), &playback->filter_process[channel_idx * 2], &playback->filter_process[channel_idx * 2 + 1]);
 		}
 	}
 
-	// Now that all of the buses have their audio sources mixed into them, we can process the effects and bus sends.
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		Bus *bus = buses[i];
+	// Copy the bus details we mixed with to the previous bus details to maintain volume ramps.
+	for (int i = 0; i < MAX_BUSES_PER_PLAYBACK; i++) {
+		playback->prev_bus_details->bus_active[i] = bus_details.bus_active[i];
+	}
+	for (int i = 0; i < MAX_BUSES_PER_PLAYBACK; i++) {
+		playback->prev_bus_details->bus[i] = bus_details.bus[i];
+	}
+	for (int i = 0; i < MAX_BUSES_PER_PLAYBACK; i++) {
+		for (int j = 0; j < MAX_CHANNELS_PER_BUS; j++) {
+			playback->prev_bus_details->volume[i][j] = bus_details.volume[i][j];
+		}
+	}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				// Buffer was not used, but it's still active, so it must be cleaned.
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+	switch (playback->state.load()) {
+		case AudioStreamPlaybackListNode::AWAITING_DELETION:
+		case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
+			// Remove the playback from the list.
+			_delete_stream_playback_list_node(playback);
+			break;
+		case AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE: {
+			// Pause the stream.
+			playback->state.store(AudioStreamPlaybackListNode::PAUSED);
+		} break;
+		case AudioStreamPlaybackListNode::PLAYING:
+		case AudioStreamPlaybackListNode::PAUSED:
+			// No-op!
+			break;
+	}
+}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
-				}
+void AudioServer::_mix_bus(uint32_t p_order) {
+	const int i = bus_order[p_order];
+	Bus *bus = buses[i];
+
+	// Pull the sends of the buses in previous levels, in the order the serial mixer used to push them.
+	for (int sender_idx = buses.size() - 1; !bus_mix_serial && sender_idx > i; sender_idx--) {
+		if (bus_send_index[sender_idx] != i) {
+			continue;
+		}
+		const Bus *sender = buses[sender_idx];
+		for (int k = 0; k < sender->channels.size(); k++) {
+			if (!sender->channels[k].send_pending) {
+				continue;
 			}
+			AudioMixKernels::accumulate(thread_get_channel_mix_buffer(i, k), sender->channels[k].buffer.ptr(), buffer_size);
 		}
+	}
 
-		// Process effects.
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
-				}
+	for (int k = 0; k < bus->channels.size(); k++) {
+		bus->channels.write[k].send_pending = false;
+		if (bus->channels[k].active && !bus->channels[k].used) {
+			// Buffer was not used, but it's still active, so it must be cleaned.
+			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+
+			for (uint32_t j = 0; j < buffer_size; j++) {
+				buf[j] = AudioFrame(0, 0);
+			}
+		}
+	}
+
+	// Process effects.
+	if (!bus->bypass) {
+		for (int j = 0; j < bus->effects.size(); j++) {
+			if (!bus->effects[j].enabled) {
+				continue;
+			}
 
 #ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 #endif
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), bus->channels.write[k].effect_buffer.ptrw(), buffer_size);
+			}
 
-				// Swap buffers, so internal buffer always has the right data.
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+			// Swap buffers, so internal buffer always has the right data.
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				Bus::Channel &channel = bus->channels.write[k];
+				SWAP(channel.buffer, channel.effect_buffer);
+			}
 
 #ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+			bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
 #endif
-			}
 		}
+	}
 
-		// Process send.
-
-		Bus *send = nullptr;
+	// Process send.
 
-		if (i > 0) {
-			// Everything has a send except for the master bus.
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { // Invalid, send to master.
-					send = buses[0];
-				}
-			}
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
 		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
-				continue;
-			}
-
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+		AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
-			AudioFrame peak = AudioFrame(0, 0);
+		AudioFrame peak = AudioFrame(0, 0);
 
-			float volume = Math::db_to_linear(bus->volume_db);
+		float volume = Math::db_to_linear(bus->volume_db);
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
+		if (mix_solo_mode) {
+			if (!bus->soloed) {
+				volume = 0.0;
 			}
+		} else {
+			if (bus->mute) {
+				volume = 0.0;
+			}
+		}
 
-			// Apply volume and compute peak.
-			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+		// Apply volume and compute peak.
+		for (uint32_t j = 0; j < buffer_size; j++) {
+			buf[j] *= volume;
 
-				float l = Math::abs(buf[j].left);
-				if (l > peak.left) {
-					peak.left = l;
-				}
-				float r = Math::abs(buf[j].right);
-				if (r > peak.right) {
-					peak.right = r;
-				}
+			float l = Math::abs(buf[j].left);
+			if (l > peak.left) {
+				peak.left = l;
 			}
+			float r = Math::abs(buf[j].right);
+			if (r > peak.right) {
+				peak.right = r;
+			}
+		}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
+		bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
 
-			if (!bus->channels[k].used) {
-				// See if any audio is contained, because channel was not used.
+		if (!bus->channels[k].used) {
+			// See if any audio is contained, because channel was not used.
 
-				if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
+			if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
+				bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				bus->channels.write[k].active = false;
+				continue; //went inactive, don't mix.
 			}
+		}
 
-			if (send) {
-				// If not master bus, send.
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
-
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
-			}
+		if (bus_send_index[i] < 0) {
+			continue;
+		}
+		if (bus_mix_serial) {
+			// The send bus may be read by a sidechain before it is processed, so it needs the send now.
+			AudioMixKernels::accumulate(thread_get_channel_mix_buffer(bus_send_index[i], k), buf, buffer_size);
+		} else {
+			// The send bus picks this up once its level is processed.
+			bus->channels.write[k].send_pending = true;
 		}
 	}
-
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
@@ -695,22 +887,10 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->set_filter(&filter, /* clear_history= */ is_just_started);
 		p_processor_r->update_coeffs(buffer_size);
 
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
-			float lerp_param = (float)frame_idx / buffer_size;
-			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
-			AudioFrame mixed = vol * p_source_buf[frame_idx];
-			p_processor_l->process_one_interp(mixed.left);
-			p_processor_r->process_one_interp(mixed.right);
-			p_out_buf[frame_idx] += mixed;
-		}
-
+		// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
+		AudioMixKernels::mix_ramp_filtered(p_out_buf, p_source_buf, p_vol_start, p_vol_final, buffer_size, p_processor_l, p_processor_r);
 	} else {
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
-		}
+		AudioMixKernels::mix_ramp(p_out_buf, p_source_buf, p_vol_start, p_vol_final, buffer_size);
 	}
 }
 
@@ -755,12 +935,14 @@ AudioFrame *AudioServer::thread_get_channel_mix_buffer(int p_bus, int p_buffer)
 	ERR_FAIL_INDEX_V(p_bus, buses.size(), nullptr);
 	ERR_FAIL_INDEX_V(p_buffer, buses[p_bus]->channels.size(), nullptr);
 
-	AudioFrame *data = buses.write[p_bus]->channels.write[p_buffer].buffer.ptrw();
+	// Buses are mixed from several threads, so only touch the requested bus and leave the bus list itself alone.
+	Bus::Channel &channel = buses[p_bus]->channels.write[p_buffer];
+	AudioFrame *data = channel.buffer.ptrw();
 
-	if (!buses[p_bus]->channels[p_buffer].used) {
-		buses.write[p_bus]->channels.write[p_buffer].used = true;
-		buses.write[p_bus]->channels.write[p_buffer].active = true;
-		buses.write[p_bus]->channels.write[p_buffer].last_mix_with_audio = mix_frames;
+	if (!channel.used) {
+		channel.used = true;
+		channel.active = true;
+		channel.last_mix_with_audio = mix_frames;
 		for (uint32_t i = 0; i < buffer_size; i++) {
 			data[i] = AudioFrame(0, 0);
 		}
@@ -833,6 +1015,7 @@ void AudioServer::set_bus_count(int p_count) {
 		buses.write[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		buses[i]->name = attempt;
 		buses[i]->solo = false;
@@ -906,6 +1089,7 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->channels.resize(channel_count);
 	for (int j = 0; j < channel_count; j++) {
 		bus->channels.write[j].buffer.resize(buffer_size);
+		bus->channels.write[j].effect_buffer.resize(buffer_size);
 	}
 	bus->name = attempt;
 	bus->solo = false;
@@ -1104,6 +1288,9 @@ bool AudioServer::is_bus_bypassing_effects(int p_bus) const {
 }
 
 void AudioServer::_update_bus_effects(int p_bus) {
+	for (int j = 0; j < buses[p_bus]->effects.size(); j++) {
+		buses.write[p_bus]->effects.write[j].mix_on_helper_thread = true;
+	}
 	for (int i = 0; i < buses[p_bus]->channels.size(); i++) {
 		buses.write[p_bus]->channels.write[i].effect_instances.resize(buses[p_bus]->effects.size());
 		for (int j = 0; j < buses[p_bus]->effects.size(); j++) {
@@ -1111,6 +1298,9 @@ void AudioServer::_update_bus_effects(int p_bus) {
 			if (Object::cast_to<AudioEffectCompressorInstance>(*fx)) {
 				Object::cast_to<AudioEffectCompressorInstance>(*fx)->set_current_channel(i);
 			}
+			if (fx.is_valid() && !_can_mix_on_helper_thread(fx.ptr())) {
+				buses.write[p_bus]->effects.write[j].mix_on_helper_thread = false;
+			}
 			buses.write[p_bus]->channels.write[i].effect_instances.write[j] = fx;
 		}
 	}
@@ -1507,17 +1697,13 @@ void AudioServer::notify_listener_changed() {
 
 void AudioServer::init_channels_and_buffers() {
 	channel_count = get_channel_count();
-	temp_buffer.resize(channel_count);
 	mix_buffer.resize(buffer_size + LOOKAHEAD_BUFFER_SIZE);
 
-	for (int i = 0; i < temp_buffer.size(); i++) {
-		temp_buffer.write[i].resize(buffer_size);
-	}
-
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1546,6 +1732,13 @@ void AudioServer::init() {
 #endif
 
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/video/video_delay_compensation_ms", PROPERTY_HINT_RANGE, "-1000,1000,1,suffix:ms"), 0);
+
+	int thread_count = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/buses/mix_thread_count", PROPERTY_HINT_RANGE, "-1,16,1"), -1);
+	if (thread_count < 0) {
+		// Leave most cores to the rest of the engine, the audio thread itself always mixes too.
+		thread_count = CLAMP(OS::get_singleton()->get_processor_count() / 4, 0, 3);
+	}
+	set_mix_thread_count(thread_count);
 }
 
 void AudioServer::update() {
@@ -1655,6 +1848,9 @@ void AudioServer::finish() {
 		AudioDriverManager::get_driver(i)->finish();
 	}
 
+	// Drivers are stopped, so nothing can be mixing anymore.
+	_stop_mix_threads();
+
 	for (int i = 0; i < buses.size(); i++) {
 		memdelete(buses[i]);
 	}
@@ -1662,6 +1858,43 @@ void AudioServer::finish() {
 	buses.clear();
 }
 
+void AudioServer::_stop_mix_threads() {
+	if (mix_thread_count == 0) {
+		return;
+	}
+	mix_threads_exit.set();
+	mix_work_semaphore.post(mix_thread_count);
+	for (int i = 0; i < mix_thread_count; i++) {
+		mix_threads[i].wait_to_finish();
+	}
+	memdelete_arr(mix_threads);
+	mix_threads = nullptr;
+	mix_thread_count = 0;
+	mix_threads_exit.clear();
+}
+
+void AudioServer::set_mix_thread_count(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+#ifdef THREADS_ENABLED
+	lock();
+	_stop_mix_threads();
+	if (p_count > 0) {
+		Thread::Settings settings;
+		settings.priority = Thread::PRIORITY_HIGH;
+		mix_threads = memnew_arr(Thread, p_count);
+		for (int i = 0; i < p_count; i++) {
+			mix_threads[i].start(&AudioServer::_mix_thread_func, this, settings);
+		}
+		mix_thread_count = p_count;
+	}
+	unlock();
+#endif
+}
+
+int AudioServer::get_mix_thread_count() const {
+	return mix_thread_count;
+}
+
 /* MISC config */
 
 void AudioServer::lock() {
@@ -1802,6 +2035,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -2137,6 +2371,7 @@ void AudioServer::_bind_methods() {
 
 AudioServer::AudioServer() {
 	singleton = this;
+	AudioMixKernels::set_backend(AudioMixKernels::get_best_backend());
 }
 
 AudioServer::~AudioServer() {
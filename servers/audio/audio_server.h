@@ -31,6 +31,9 @@
 #pragma once
 
 #include "core/math/audio_frame.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -245,8 +248,10 @@ private:
 		struct Channel {
 			bool used = false;
 			bool active = false;
+			bool send_pending = false;
 			AudioFrame peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
 			Vector<AudioFrame> buffer;
+			Vector<AudioFrame> effect_buffer;
 			Vector<Ref<AudioEffectInstance>> effect_instances;
 			uint64_t last_mix_with_audio = 0;
 			Channel() {}
@@ -257,6 +262,8 @@ private:
 		struct Effect {
 			Ref<AudioEffect> effect;
 			bool enabled = false;
+			// False when an instance is scripted or comes from a GDExtension.
+			bool mix_on_helper_thread = true;
 #ifdef DEBUG_ENABLED
 			uint64_t prof_time = 0;
 #endif
@@ -318,8 +325,6 @@ private:
 	// TODO document if this is necessary.
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard_frame_old;
 
-	Vector<Vector<AudioFrame>> temp_buffer; //temp_buffer for each level
-	Vector<AudioFrame> mix_buffer;
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
 
@@ -329,7 +334,49 @@ private:
 
 	void init_channels_and_buffers();
 
+	struct MixItem {
+		AudioStreamPlaybackListNode *playback = nullptr;
+		bool fading_out = false;
+		bool threaded = false;
+	};
+
+	// Rendered playbacks, one stride of `buffer_size + LOOKAHEAD_BUFFER_SIZE` frames per mix item.
+	LocalVector<AudioFrame> mix_buffer;
+	LocalVector<MixItem> mix_items;
+	bool mix_solo_mode = false;
+
+	// Buses only send to buses before them. Buses are grouped by their distance from the leaves
+	// of the send graph, so every bus in a level can be processed once the previous levels are done.
+	LocalVector<int> bus_send_index;
+	LocalVector<uint32_t> bus_depth;
+	LocalVector<uint32_t> bus_order;
+	LocalVector<uint32_t> bus_level_end;
+	LocalVector<bool> bus_threaded;
+	// A compressor sidechain reads another bus's buffer mid-mix, which the levels don't account for.
+	// While one is in use, buses are mixed one by one on the audio thread and push their sends, like the serial mixer.
+	bool bus_mix_serial = false;
+
+	// Dedicated helpers for the audio thread, so mixing never waits behind unrelated WorkerThreadPool tasks.
+	Thread *mix_threads = nullptr;
+	int mix_thread_count = 0;
+	Semaphore mix_work_semaphore;
+	Semaphore mix_done_semaphore;
+	SafeFlag mix_threads_exit;
+	void (AudioServer::*mix_job)(uint32_t) = nullptr;
+	uint32_t mix_job_end = 0;
+	SafeNumeric<uint32_t> mix_job_next;
+
+	static void _mix_thread_func(void *p_userdata);
+	void _mix_job_drain();
+	void _run_mix_job(void (AudioServer::*p_job)(uint32_t), uint32_t p_begin, uint32_t p_end);
+	void _stop_mix_threads();
+
 	void _mix_step();
+	void _mix_playback(uint32_t p_item);
+	void _mix_playback_job(uint32_t p_item);
+	void _mix_playback_to_buses(uint32_t p_item);
+	void _mix_bus(uint32_t p_order);
+	void _mix_bus_job(uint32_t p_order);
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
@@ -430,6 +477,10 @@ public:
 	void set_playback_speed_scale(float p_scale);
 	float get_playback_speed_scale() const;
 
+	// Number of helper threads mixing alongside the audio thread, 0 mixes everything on the audio thread.
+	void set_mix_thread_count(int p_count);
+	int get_mix_thread_count() const;
+
 	// Convenience method.
 	void start_playback_stream(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volume_db_vector, float p_start_time = 0, float p_pitch_scale = 1);
 	// Expose all parameters.
@@ -106,6 +106,11 @@ void AudioStreamPlayback::tag_used_streams() {
 	GDVIRTUAL_CALL(_tag_used_streams);
 }
 
+bool AudioStreamPlayback::can_mix_on_helper_thread() const {
+	// Scripted and GDExtension implementations aren't written to run concurrently.
+	return !get_script_instance() && !_get_extension();
+}
+
 void AudioStreamPlayback::set_parameter(const StringName &p_name, const Variant &p_value) {
 	GDVIRTUAL_CALL(_set_parameter, p_name, p_value);
 }
@@ -857,6 +862,11 @@ void AudioStreamPlaybackRandomizer::tag_used_streams() {
 	randomizer->tag_used(0);
 }
 
+bool AudioStreamPlaybackRandomizer::can_mix_on_helper_thread() const {
+	Ref<AudioStreamPlayback> p = playing; // Thread safety
+	return AudioStreamPlayback::can_mix_on_helper_thread() && (p.is_null() || p->can_mix_on_helper_thread());
+}
+
 int AudioStreamPlaybackRandomizer::mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) {
 	if (playing.is_valid()) {
 		int mixed_samples = playing->mix(p_buffer, p_rate_scale * pitch_scale, p_frames);
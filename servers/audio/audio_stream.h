@@ -108,6 +108,10 @@ public:
 
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames);
 
+	// Whether the AudioServer may call mix() from one of its helper threads. Playbacks that take the
+	// AudioDriver lock while mixing must return false, since the audio thread holds it while waiting for the helpers.
+	virtual bool can_mix_on_helper_thread() const;
+
 	virtual void set_is_sample(bool p_is_sample) {}
 	virtual bool get_is_sample() const { return false; }
 	virtual Ref<AudioSamplePlayback> get_sample_playback() const;
@@ -261,6 +265,8 @@ public:
 
 	virtual void tag_used_streams() override;
 
+	virtual bool can_mix_on_helper_thread() const override { return false; } // Mixing takes the AudioDriver lock.
+
 	~AudioStreamPlaybackMicrophone();
 	AudioStreamPlaybackMicrophone();
 };
@@ -369,6 +375,7 @@ public:
 	virtual void seek(double p_time) override;
 
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override;
+	virtual bool can_mix_on_helper_thread() const override;
 
 	virtual void tag_used_streams() override;
 
@@ -31,40 +31,14 @@
 #include "audio_effect_filter.h"
 
 #include "core/object/class_db.h"
+#include "servers/audio/audio_mix_kernels.h"
 #include "servers/audio/audio_server.h"
 
-template <int S>
-void AudioEffectFilterInstance::_process_filter(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) {
-	for (int i = 0; i < p_frame_count; i++) {
-		float f = p_src_frames[i].left;
-		filter_process[0][0].process_one(f);
-		if constexpr (S > 1) {
-			filter_process[0][1].process_one(f);
-		}
-		if constexpr (S > 2) {
-			filter_process[0][2].process_one(f);
-		}
-		if constexpr (S > 3) {
-			filter_process[0][3].process_one(f);
-		}
-
-		p_dst_frames[i].left = f;
-	}
-
-	for (int i = 0; i < p_frame_count; i++) {
-		float f = p_src_frames[i].right;
-		filter_process[1][0].process_one(f);
-		if constexpr (S > 1) {
-			filter_process[1][1].process_one(f);
-		}
-		if constexpr (S > 2) {
-			filter_process[1][2].process_one(f);
-		}
-		if constexpr (S > 3) {
-			filter_process[1][3].process_one(f);
-		}
-
-		p_dst_frames[i].right = f;
+void AudioEffectFilterInstance::_process_filter(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count, int p_stages) {
+	memcpy(p_dst_frames, p_src_frames, sizeof(AudioFrame) * p_frame_count);
+	// Stages are chained, so filtering the whole block one stage at a time gives the same result as going sample by sample.
+	for (int i = 0; i < p_stages; i++) {
+		AudioMixKernels::filter_stereo(p_dst_frames, p_frame_count, &filter_process[0][i], &filter_process[1][i]);
 	}
 }
 
@@ -83,15 +57,7 @@ void AudioEffectFilterInstance::process(const AudioFrame *p_src_frames, AudioFra
 		}
 	}
 
-	if (stages == 1) {
-		_process_filter<1>(p_src_frames, p_dst_frames, p_frame_count);
-	} else if (stages == 2) {
-		_process_filter<2>(p_src_frames, p_dst_frames, p_frame_count);
-	} else if (stages == 3) {
-		_process_filter<3>(p_src_frames, p_dst_frames, p_frame_count);
-	} else if (stages == 4) {
-		_process_filter<4>(p_src_frames, p_dst_frames, p_frame_count);
-	}
+	_process_filter(p_src_frames, p_dst_frames, p_frame_count, CLAMP(stages, 1, 4));
 }
 
 AudioEffectFilterInstance::AudioEffectFilterInstance() {
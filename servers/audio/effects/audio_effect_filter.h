@@ -44,8 +44,7 @@ class AudioEffectFilterInstance : public AudioEffectInstance {
 	AudioFilterSW filter;
 	AudioFilterSW::Processor filter_process[2][4];
 
-	template <int S>
-	void _process_filter(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count);
+	void _process_filter(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count, int p_stages);
 
 public:
 	virtual void process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) override;
@@ -57,6 +57,8 @@
 #define ServerNameWrapMT PhysicsServer2DWrapMT
 #define server_name physics_server_2d
 #define WRITE_ACTION
+#define CAPTURE_ACTION(m_type, m_args)
+#define CAPTURE_CREATE_ACTION(m_type, m_args, m_ret)
 
 #include "servers/server_wrap_mt_common.h"
 
@@ -335,6 +337,8 @@ public:
 #undef ServerName
 #undef server_name
 #undef WRITE_ACTION
+#undef CAPTURE_ACTION
+#undef CAPTURE_CREATE_ACTION
 };
 
 #ifdef DEBUG_SYNC
@@ -0,0 +1,515 @@
+/**************************************************************************/
+/*  raster_occlusion_cull.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "raster_occlusion_cull.h"
+
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RASTER_OCCLUSION_CULL_SSE2
+#include <emmintrin.h>
+#endif
+
+void RasterOcclusionCull::RasterHZBuffer::clear() {
+	HZBuffer::clear();
+
+	tile_grid_size = Size2i();
+	mesh_triangles.clear();
+	tile_bins.clear();
+	tile_keys.clear();
+}
+
+void RasterOcclusionCull::RasterHZBuffer::resize(const Size2i &p_size) {
+	if (p_size == Size2i()) {
+		clear();
+		return;
+	}
+
+	if (!sizes.is_empty() && p_size == sizes[0]) {
+		return; // Size didn't change
+	}
+
+	HZBuffer::resize(p_size);
+
+	tile_grid_size = Size2i((p_size.x + TILE_SIZE - 1) / TILE_SIZE, (p_size.y + TILE_SIZE - 1) / TILE_SIZE);
+	tile_bins.resize(tile_grid_size.x * tile_grid_size.y);
+	tile_keys.resize(tile_bins.size() * TILE_SIZE * TILE_SIZE);
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_add_triangle(const ClipVertex &p_a, const ClipVertex &p_b, const ClipVertex &p_c, LocalVector<Triangle> &r_triangles) const {
+	// Twice the signed area.
+	const double area = (p_b.x - p_a.x) * (p_c.y - p_a.y) - (p_b.y - p_a.y) * (p_c.x - p_a.x);
+	if (!(Math::abs(area) > 1e-12)) {
+		return;
+	}
+
+	const Size2i &size = sizes[0];
+	const double min_x = MIN(p_a.x, MIN(p_b.x, p_c.x));
+	const double min_y = MIN(p_a.y, MIN(p_b.y, p_c.y));
+	const double max_x = MAX(p_a.x, MAX(p_b.x, p_c.x));
+	const double max_y = MAX(p_a.y, MAX(p_b.y, p_c.y));
+
+	Triangle triangle;
+	// Pixels are sampled at their centers.
+	triangle.min_x = MAX(0, (int)Math::ceil(min_x - 0.5));
+	triangle.min_y = MAX(0, (int)Math::ceil(min_y - 0.5));
+	triangle.max_x = MIN(size.x - 1, (int)Math::floor(max_x - 0.5));
+	triangle.max_y = MIN(size.y - 1, (int)Math::floor(max_y - 0.5));
+	if (triangle.min_x > triangle.max_x || triangle.min_y > triangle.max_y) {
+		return; // Covers no pixel center.
+	}
+
+	// Flip the edges of clockwise triangles, so both windings are drawn.
+	const double sign = area > 0.0 ? -1.0 : 1.0;
+	const ClipVertex *vertices[3] = { &p_a, &p_b, &p_c };
+	for (int i = 0; i < 3; i++) {
+		const ClipVertex &from = *vertices[i];
+		const ClipVertex &to = *vertices[(i + 1) % 3];
+		const double a = (to.y - from.y) * sign;
+		const double b = (from.x - to.x) * sign;
+		triangle.edges[i][0] = a;
+		triangle.edges[i][1] = b;
+		triangle.edges[i][2] = -(a * from.x + b * from.y);
+	}
+
+	const double d1 = p_b.depth - p_a.depth;
+	const double d2 = p_c.depth - p_a.depth;
+	const double dx = (d1 * (p_c.y - p_a.y) - d2 * (p_b.y - p_a.y)) / area;
+	const double dy = (d2 * (p_b.x - p_a.x) - d1 * (p_c.x - p_a.x)) / area;
+	triangle.depth[0] = dx;
+	triangle.depth[1] = dy;
+	triangle.depth[2] = p_a.depth - dx * p_a.x - dy * p_a.y;
+
+	r_triangles.push_back(triangle);
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_add_polygon(ClipVertex *p_vertices, int p_count, LocalVector<Triangle> &r_triangles) const {
+	const Size2i &size = sizes[0];
+
+	double min_x = p_vertices[0].x;
+	double min_y = p_vertices[0].y;
+	double max_x = p_vertices[0].x;
+	double max_y = p_vertices[0].y;
+	for (int i = 1; i < p_count; i++) {
+		min_x = MIN(min_x, p_vertices[i].x);
+		min_y = MIN(min_y, p_vertices[i].y);
+		max_x = MAX(max_x, p_vertices[i].x);
+		max_y = MAX(max_y, p_vertices[i].y);
+	}
+
+	if (max_x < 0.0 || max_y < 0.0 || min_x > size.x || min_y > size.y) {
+		return;
+	}
+
+	// Polygons reaching far outside are clipped to the buffer, so the edge equations keep their precision.
+	// Depth is affine in screen space, so it can be interpolated linearly here.
+	ClipVertex clipped[2][9];
+	ClipVertex *src = p_vertices;
+	if (min_x < 0.0 || min_y < 0.0 || max_x > size.x || max_y > size.y) {
+		const double bounds[4] = { 0.0, 0.0, (double)size.x, (double)size.y };
+		for (int plane = 0; plane < 4; plane++) {
+			const bool is_y = plane & 1;
+			const bool is_max = plane >= 2;
+			ClipVertex *dst = clipped[plane & 1];
+			int count = 0;
+			for (int i = 0; i < p_count; i++) {
+				const ClipVertex &cur = src[i];
+				const ClipVertex &next = src[(i + 1) % p_count];
+				const double cur_value = is_y ? cur.y : cur.x;
+				const double next_value = is_y ? next.y : next.x;
+				const bool cur_in = is_max ? cur_value <= bounds[plane] : cur_value >= bounds[plane];
+				const bool next_in = is_max ? next_value <= bounds[plane] : next_value >= bounds[plane];
+				if (cur_in) {
+					dst[count++] = cur;
+				}
+				if (cur_in != next_in) {
+					const double t = (bounds[plane] - cur_value) / (next_value - cur_value);
+					ClipVertex &v = dst[count++];
+					v.x = cur.x + (next.x - cur.x) * t;
+					v.y = cur.y + (next.y - cur.y) * t;
+					v.depth = cur.depth + (next.depth - cur.depth) * t;
+				}
+			}
+			if (count < 3) {
+				return;
+			}
+			src = dst;
+			p_count = count;
+		}
+	}
+
+	for (int i = 1; i + 1 < p_count; i++) {
+		_add_triangle(src[0], src[i], src[i + 1], r_triangles);
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_setup_mesh(uint32_t p_mesh, const SetupData *p_data) {
+	const Mesh &mesh = p_data->meshes[p_mesh];
+	LocalVector<Triangle> &triangles = mesh_triangles[p_mesh];
+	triangles.clear();
+
+	const Transform3D xform = p_data->cam_inv_transform * mesh.xform;
+	const double z_near = p_data->z_near;
+	const double scale_x = sizes[0].x / (double)p_data->near_size.x;
+	const double scale_y = sizes[0].y / (double)p_data->near_size.y;
+
+	for (uint32_t i = 0; i + 2 < mesh.index_count; i += 3) {
+		Vector3 view[3];
+		for (int j = 0; j < 3; j++) {
+			view[j] = xform.xform(mesh.vertices[mesh.indices[i + j]]);
+		}
+
+		// Clip against the near plane, which leaves up to four vertices.
+		Vector3 clipped[4];
+		int count = 0;
+		for (int j = 0; j < 3; j++) {
+			const Vector3 &cur = view[j];
+			const Vector3 &next = view[(j + 1) % 3];
+			const bool cur_in = -cur.z >= z_near;
+			const bool next_in = -next.z >= z_near;
+			if (cur_in) {
+				clipped[count++] = cur;
+			}
+			if (cur_in != next_in) {
+				clipped[count++] = cur.lerp(next, (-z_near - cur.z) / (next.z - cur.z));
+			}
+		}
+		if (count < 3) {
+			continue;
+		}
+
+		// Project onto the near plane, then into pixels. Row 0 is at the bottom, like in the rays.
+		ClipVertex projected[9];
+		for (int j = 0; j < count; j++) {
+			const double depth = -clipped[j].z;
+			const double ratio = p_data->cam_orthogonal ? 1.0 : z_near / depth;
+			ClipVertex &v = projected[j];
+			v.x = (clipped[j].x * ratio - p_data->near_bottom_left.x) * scale_x;
+			v.y = (clipped[j].y * ratio - p_data->near_bottom_left.y) * scale_y;
+			v.depth = p_data->cam_orthogonal ? -depth : 1.0 / depth;
+		}
+
+		_add_polygon(projected, count, triangles);
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_raster_tile(uint32_t p_tile, const RasterData *p_data) {
+	const Size2i &size = sizes[0];
+	const int tile_x = (p_tile % tile_grid_size.x) * TILE_SIZE;
+	const int tile_y = (p_tile / tile_grid_size.x) * TILE_SIZE;
+	float *keys = &tile_keys[p_tile * TILE_SIZE * TILE_SIZE];
+
+	// Perspective keys are 1/depth, orthogonal keys are -depth, so the closest key is always the largest.
+	const float empty_key = p_data->cam_orthogonal ? -FLT_MAX : 0.0f;
+	for (int i = 0; i < TILE_SIZE * TILE_SIZE; i++) {
+		keys[i] = empty_key;
+	}
+
+	for (const Triangle *triangle : tile_bins[p_tile]) {
+		// Start on a multiple of 4, tiles are aligned to it.
+		const int from_x = MAX(triangle->min_x, tile_x) & ~3;
+		const int to_x = MIN(triangle->max_x, tile_x + TILE_SIZE - 1);
+		const int from_y = MAX(triangle->min_y, tile_y);
+		const int to_y = MIN(triangle->max_y, tile_y + TILE_SIZE - 1);
+		const float(&e)[3][3] = triangle->edges;
+		const float(&d)[3] = triangle->depth;
+
+		for (int y = from_y; y <= to_y; y++) {
+			const float py = y + 0.5f;
+			const float row_e0 = e[0][1] * py + e[0][2];
+			const float row_e1 = e[1][1] * py + e[1][2];
+			const float row_e2 = e[2][1] * py + e[2][2];
+			const float row_d = d[1] * py + d[2];
+			float *row = keys + (y - tile_y) * TILE_SIZE - tile_x;
+
+#ifdef RASTER_OCCLUSION_CULL_SSE2
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 offsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+			for (int x = from_x; x <= to_x; x += 4) {
+				const __m128 px = _mm_add_ps(_mm_set1_ps((float)x), offsets);
+				const __m128 e0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(e[0][0]), px), _mm_set1_ps(row_e0));
+				const __m128 e1 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(e[1][0]), px), _mm_set1_ps(row_e1));
+				const __m128 e2 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(e[2][0]), px), _mm_set1_ps(row_e2));
+				const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)), _mm_cmpge_ps(e2, zero));
+				if (_mm_movemask_ps(inside) == 0) {
+					continue;
+				}
+				const __m128 depth = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(d[0]), px), _mm_set1_ps(row_d));
+				const __m128 old_keys = _mm_loadu_ps(row + x);
+				const __m128 new_keys = _mm_or_ps(_mm_and_ps(inside, depth), _mm_andnot_ps(inside, old_keys));
+				_mm_storeu_ps(row + x, _mm_max_ps(old_keys, new_keys));
+			}
+#else
+			for (int x = from_x; x <= to_x; x += 4) {
+				for (int i = 0; i < 4; i++) {
+					const float px = x + i + 0.5f;
+					if (e[0][0] * px + row_e0 >= 0.0f && e[1][0] * px + row_e1 >= 0.0f && e[2][0] * px + row_e2 >= 0.0f) {
+						row[x + i] = MAX(row[x + i], d[0] * px + row_d);
+					}
+				}
+			}
+#endif
+		}
+	}
+
+	// Convert to distances from the camera, like the ray hits.
+	const int w = size.x;
+	const int h = size.y;
+	const float z_near = p_data->z_near;
+	for (int y = tile_y; y < MIN(tile_y + TILE_SIZE, h); y++) {
+		const float *row = keys + (y - tile_y) * TILE_SIZE - tile_x;
+		const float near_y = p_data->near_bottom_left.y + (y + 0.5f) / h * p_data->near_size.y;
+		for (int x = tile_x; x < MIN(tile_x + TILE_SIZE, w); x++) {
+			const float key = row[x];
+			float distance = p_data->z_far;
+			if (p_data->cam_orthogonal) {
+				if (key > -FLT_MAX) {
+					distance = -key;
+				}
+			} else if (key > 0.0f) {
+				const float near_x = p_data->near_bottom_left.x + (x + 0.5f) / w * p_data->near_size.x;
+				distance = Math::sqrt(near_x * near_x + near_y * near_y + z_near * z_near) / (z_near * key);
+			}
+			mips[0][y * w + x] = MIN(distance, p_data->z_far);
+		}
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::rasterize(const LocalVector<Mesh> &p_meshes, const Transform3D &p_cam_transform, const Vector2 &p_near_bottom_left, const Vector2 &p_near_size, real_t p_z_near, real_t p_z_far, bool p_cam_orthogonal) {
+	ERR_FAIL_COND(is_empty());
+
+	SetupData setup;
+	setup.meshes = p_meshes.ptr();
+	setup.cam_inv_transform = p_cam_transform.affine_inverse();
+	setup.near_bottom_left = p_near_bottom_left;
+	setup.near_size = p_near_size;
+	setup.z_near = p_z_near;
+	setup.cam_orthogonal = p_cam_orthogonal;
+
+	mesh_triangles.resize(p_meshes.size());
+	if (p_meshes.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_setup_mesh, &setup, p_meshes.size(), -1, true, SNAME("RasterOcclusionCullSetup"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (p_meshes.size() == 1) {
+		_setup_mesh(0, &setup);
+	}
+
+	for (LocalVector<const Triangle *> &bin : tile_bins) {
+		bin.clear();
+	}
+	for (const LocalVector<Triangle> &triangles : mesh_triangles) {
+		for (const Triangle &triangle : triangles) {
+			for (int y = triangle.min_y / TILE_SIZE; y <= triangle.max_y / TILE_SIZE; y++) {
+				for (int x = triangle.min_x / TILE_SIZE; x <= triangle.max_x / TILE_SIZE; x++) {
+					tile_bins[y * tile_grid_size.x + x].push_back(&triangle);
+				}
+			}
+		}
+	}
+
+	RasterData raster;
+	raster.z_near = p_z_near;
+	raster.z_far = p_z_far * 1.05f;
+	raster.near_bottom_left = p_near_bottom_left;
+	raster.near_size = p_near_size;
+	raster.cam_orthogonal = p_cam_orthogonal;
+	debug_tex_range = raster.z_far;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_raster_tile, &raster, tile_bins.size(), -1, true, SNAME("RasterOcclusionCullRaster"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	update_mips();
+}
+
+////////////////////////////////////////////////////////
+
+bool RasterOcclusionCull::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RasterOcclusionCull::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RasterOcclusionCull::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RasterOcclusionCull::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	occluder->vertices.clear();
+	occluder->indices.clear();
+	occluder->aabb = AABB();
+
+	const int vertex_count = p_vertices.size();
+	for (const int32_t index : p_indices) {
+		ERR_FAIL_INDEX_MSG(index, vertex_count, "Occluder mesh has an index out of bounds.");
+	}
+
+	occluder->vertices = p_vertices;
+	occluder->indices = p_indices;
+	for (int i = 0; i < vertex_count; i++) {
+		if (i == 0) {
+			occluder->aabb.position = p_vertices[i];
+		} else {
+			occluder->aabb.expand_to(p_vertices[i]);
+		}
+	}
+}
+
+void RasterOcclusionCull::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_scenario(RID p_scenario) {
+	ERR_FAIL_COND(scenarios.has(p_scenario));
+	scenarios[p_scenario] = Scenario();
+}
+
+void RasterOcclusionCull::remove_scenario(RID p_scenario) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios.erase(p_scenario);
+}
+
+void RasterOcclusionCull::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	// Meshes are transformed when drawn, so there is nothing to update here.
+	OccluderInstance &instance = scenario->instances[p_instance];
+	instance.occluder = p_occluder;
+	instance.xform = p_xform;
+	instance.enabled = p_enabled;
+}
+
+void RasterOcclusionCull::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+	scenario->instances.erase(p_instance);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = RasterHZBuffer();
+}
+
+void RasterOcclusionCull::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RasterOcclusionCull::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RasterOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+void RasterOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	RasterHZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer) {
+		return;
+	}
+
+	const Scenario *scenario = scenarios.getptr(buffer->scenario_rid);
+	if (buffer->is_empty() || !scenario) {
+		return;
+	}
+
+	// Only draw the occluders inside the camera frustum.
+	const Vector<Plane> planes = p_cam_projection.get_projection_planes(p_cam_transform);
+	visible_meshes.clear();
+	for (const KeyValue<RID, OccluderInstance> &E : scenario->instances) {
+		const OccluderInstance &instance = E.value;
+		const Occluder *occluder = occluder_owner.get_or_null(instance.occluder);
+		if (!instance.enabled || !occluder || occluder->indices.size() < 3) {
+			continue;
+		}
+
+		const AABB aabb = instance.xform.xform(occluder->aabb);
+		bool outside = false;
+		for (const Plane &plane : planes) {
+			if (plane.is_point_over(aabb.get_support(-plane.normal))) {
+				outside = true;
+				break;
+			}
+		}
+		if (outside) {
+			continue;
+		}
+
+		RasterHZBuffer::Mesh mesh;
+		mesh.xform = instance.xform;
+		mesh.vertices = occluder->vertices.ptr();
+		mesh.indices = occluder->indices.ptr();
+		mesh.index_count = occluder->indices.size();
+		visible_meshes.push_back(mesh);
+	}
+
+	Rect2 vp_rect = _get_viewport_rect(p_cam_projection);
+	Vector2 bottom_left = vp_rect.position;
+	bottom_left += _get_jitter(vp_rect, buffer->get_occlusion_buffer_size());
+
+	buffer->rasterize(visible_meshes, p_cam_transform, bottom_left, vp_rect.get_size(), p_cam_projection.get_z_near(), p_cam_projection.get_z_far(), p_cam_orthogonal);
+}
+
+RasterOcclusionCull::HZBuffer *RasterOcclusionCull::buffer_get_ptr(RID p_buffer) {
+	return buffers.getptr(p_buffer);
+}
+
+RID RasterOcclusionCull::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
+
+RasterOcclusionCull::RasterOcclusionCull() {
+	_jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
+}
+
+RasterOcclusionCull::~RasterOcclusionCull() {
+	for (const RID &rid : occluder_owner.get_owned_list()) {
+		free_occluder(rid);
+	}
+}
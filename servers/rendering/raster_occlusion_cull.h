@@ -0,0 +1,155 @@
+/**************************************************************************/
+/*  raster_occlusion_cull.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/rid_owner.h"
+#include "servers/rendering/renderer_scene_occlusion_cull.h"
+
+// Built-in occlusion culling, used when the raycast module (Embree) is not available
+// or not wanted. Occluder meshes are rasterized on the CPU into the depth buffer in
+// tiles, with the triangles binned per tile and the tiles drawn on worker threads.
+class RasterOcclusionCull : public RendererSceneOcclusionCull {
+public:
+	class RasterHZBuffer : public HZBuffer {
+	public:
+		static constexpr int TILE_SIZE = 32; // Must be a multiple of 4.
+
+		struct Mesh {
+			Transform3D xform;
+			const Vector3 *vertices = nullptr;
+			const int32_t *indices = nullptr;
+			uint32_t index_count = 0;
+		};
+
+	private:
+		// A triangle in buffer pixels, as edge equations that are positive inside,
+		// and a depth plane that is affine in screen space (1/depth, or -depth if orthogonal).
+		struct Triangle {
+			float edges[3][3];
+			float depth[3];
+			int min_x, min_y, max_x, max_y;
+		};
+
+		// A projected vertex, kept in double precision until clipped to the buffer.
+		struct ClipVertex {
+			double x = 0.0;
+			double y = 0.0;
+			double depth = 0.0;
+		};
+
+		struct SetupData {
+			const Mesh *meshes = nullptr;
+			Transform3D cam_inv_transform;
+			Vector2 near_bottom_left;
+			Vector2 near_size;
+			float z_near = 0.0f;
+			bool cam_orthogonal = false;
+		};
+
+		struct RasterData {
+			float z_near = 0.0f;
+			float z_far = 0.0f;
+			Vector2 near_bottom_left;
+			Vector2 near_size;
+			bool cam_orthogonal = false;
+		};
+
+		Size2i tile_grid_size;
+		// Screen triangles of each mesh, and the triangles overlapping each tile.
+		LocalVector<LocalVector<Triangle>> mesh_triangles;
+		LocalVector<LocalVector<const Triangle *>> tile_bins;
+		// Depth keys of all tiles, TILE_SIZE * TILE_SIZE per tile. Larger keys are closer.
+		LocalVector<float> tile_keys;
+
+		void _setup_mesh(uint32_t p_mesh, const SetupData *p_data);
+		void _add_polygon(ClipVertex *p_vertices, int p_count, LocalVector<Triangle> &r_triangles) const;
+		void _add_triangle(const ClipVertex &p_a, const ClipVertex &p_b, const ClipVertex &p_c, LocalVector<Triangle> &r_triangles) const;
+		void _raster_tile(uint32_t p_tile, const RasterData *p_data);
+
+	public:
+		virtual void clear() override;
+		virtual void resize(const Size2i &p_size) override;
+
+		// Draws the meshes and updates the mips. `p_near_bottom_left` and `p_near_size` give the
+		// viewport rect on the near plane, like in RaycastOcclusionCull.
+		void rasterize(const LocalVector<Mesh> &p_meshes, const Transform3D &p_cam_transform, const Vector2 &p_near_bottom_left, const Vector2 &p_near_size, real_t p_z_near, real_t p_z_far, bool p_cam_orthogonal);
+
+		RID scenario_rid;
+	};
+
+private:
+	struct Occluder {
+		PackedVector3Array vertices;
+		PackedInt32Array indices;
+		AABB aabb;
+	};
+
+	struct OccluderInstance {
+		RID occluder;
+		Transform3D xform;
+		bool enabled = true;
+	};
+
+	struct Scenario {
+		HashMap<RID, OccluderInstance> instances;
+	};
+
+	RID_PtrOwner<Occluder> occluder_owner;
+	HashMap<RID, Scenario> scenarios;
+	HashMap<RID, RasterHZBuffer> buffers;
+	LocalVector<RasterHZBuffer::Mesh> visible_meshes;
+
+public:
+	virtual bool is_occluder(RID p_rid) override;
+	virtual RID occluder_allocate() override;
+	virtual void occluder_initialize(RID p_occluder) override;
+	virtual void occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) override;
+	virtual void free_occluder(RID p_occluder) override;
+
+	virtual void add_scenario(RID p_scenario) override;
+	virtual void remove_scenario(RID p_scenario) override;
+	virtual void scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) override;
+	virtual void scenario_remove_instance(RID p_scenario, RID p_instance) override;
+
+	virtual void add_buffer(RID p_buffer) override;
+	virtual void remove_buffer(RID p_buffer) override;
+	virtual HZBuffer *buffer_get_ptr(RID p_buffer) override;
+	virtual void buffer_set_scenario(RID p_buffer, RID p_scenario) override;
+	virtual void buffer_set_size(RID p_buffer, const Vector2i &p_size) override;
+	virtual void buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) override;
+
+	virtual RID buffer_get_debug_texture(RID p_buffer) override;
+
+	RasterOcclusionCull();
+	~RasterOcclusionCull();
+};
@@ -637,20 +637,37 @@ void RendererCanvasCull::canvas_item_set_light_mask(RID p_item, int p_mask) {
 	canvas_item->light_mask = p_mask;
 }
 
-void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D &p_transform) {
-	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
-	ERR_FAIL_NULL(canvas_item);
-
-	if (_interpolation_data.interpolation_enabled && canvas_item->interpolated) {
-		if (!canvas_item->on_interpolate_transform_list) {
-			_interpolation_data.canvas_item_transform_update_list_curr->push_back(p_item);
-			canvas_item->on_interpolate_transform_list = true;
+void RendererCanvasCull::_canvas_item_set_transform(Item *p_canvas_item, const Transform2D &p_transform) {
+	if (_interpolation_data.interpolation_enabled && p_canvas_item->interpolated) {
+		if (!p_canvas_item->on_interpolate_transform_list) {
+			_interpolation_data.canvas_item_transform_update_list_curr->push_back(p_canvas_item->self);
+			p_canvas_item->on_interpolate_transform_list = true;
 		} else {
 			DEV_ASSERT(_interpolation_data.canvas_item_transform_update_list_curr->size() > 0);
 		}
 	}
 
-	canvas_item->xform_curr = p_transform;
+	p_canvas_item->xform_curr = p_transform;
+}
+
+void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D &p_transform) {
+	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
+	ERR_FAIL_NULL(canvas_item);
+
+	_canvas_item_set_transform(canvas_item, p_transform);
+}
+
+void RendererCanvasCull::canvas_item_set_transforms(const Vector<RID> &p_items, const Vector<Transform2D> &p_transforms) {
+	ERR_FAIL_COND(p_items.size() != p_transforms.size());
+
+	const RID *items = p_items.ptr();
+	const Transform2D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_items.size(); i++) {
+		Item *canvas_item = canvas_item_owner.get_or_null(items[i]);
+		ERR_CONTINUE(!canvas_item);
+
+		_canvas_item_set_transform(canvas_item, transforms[i]);
+	}
 }
 
 void RendererCanvasCull::canvas_item_set_visibility_layer(RID p_item, uint32_t p_visibility_layer) {
@@ -212,6 +212,7 @@ private:
 	void _collect_ysort_children(RendererCanvasCull::Item *p_canvas_item, RendererCanvasCull::Item *p_material_owner, const Color &p_modulate, RendererCanvasCull::Item **r_items, int &r_index, int &r_ysort_children_count, int p_z, uint32_t p_canvas_cull_mask);
 	int _count_ysort_children(RendererCanvasCull::Item *p_canvas_item);
 	void _mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner);
+	void _canvas_item_set_transform(Item *p_canvas_item, const Transform2D &p_transform);
 
 	static constexpr int z_range = RSE::CANVAS_ITEM_Z_MAX - RSE::CANVAS_ITEM_Z_MIN + 1;
 
@@ -246,6 +247,7 @@ public:
 	uint32_t canvas_item_get_visibility_layer(RID p_item);
 
 	void canvas_item_set_transform(RID p_item, const Transform2D &p_transform);
+	void canvas_item_set_transforms(const Vector<RID> &p_items, const Vector<Transform2D> &p_transforms);
 	void canvas_item_set_clip(RID p_item, bool p_clip);
 	void canvas_item_set_distance_field_mode(RID p_item, bool p_enable);
 	void canvas_item_set_custom_rect(RID p_item, bool p_custom_rect, const Rect2 &p_rect = Rect2());
@@ -35,6 +35,8 @@
 #include "core/math/geometry_3d.h"
 #include "core/object/callable_mp.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/os/frame_arena.h"
+#include "servers/rendering/raster_occlusion_cull.h"
 #include "servers/rendering/rendering_light_culler.h"
 #include "servers/rendering/rendering_server.h"
 #include "servers/rendering/rendering_server_default.h"
@@ -447,6 +449,7 @@ void RendererSceneCull::scenario_initialize(RID p_rid) {
 
 	scenario->instance_aabbs.set_page_pool(&instance_aabb_page_pool);
 	scenario->instance_data.set_page_pool(&instance_data_page_pool);
+	scenario->instance_frustum_coherence.set_page_pool(&instance_frustum_coherence_page_pool);
 	scenario->instance_visibility.set_page_pool(&instance_visibility_data_page_pool);
 
 	RendererSceneOcclusionCull::get_singleton()->add_scenario(p_rid);
@@ -985,11 +988,8 @@ void RendererSceneCull::instance_geometry_set_transparency(RID p_instance, float
 	}
 }
 
-void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D &p_transform) {
-	Instance *instance = instance_owner.get_or_null(p_instance);
-	ERR_FAIL_NULL(instance);
-
-	if (instance->transform == p_transform) {
+void RendererSceneCull::_instance_set_transform(Instance *p_instance, const Transform3D &p_transform) {
+	if (p_instance->transform == p_transform) {
 		return; // Must be checked to avoid worst evil.
 	}
 
@@ -1001,8 +1001,30 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	}
 
 #endif
-	instance->transform = p_transform;
-	_instance_queue_update(instance, true);
+	p_instance->transform = p_transform;
+	_instance_queue_update(p_instance, true);
+}
+
+void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D &p_transform) {
+	Instance *instance = instance_owner.get_or_null(p_instance);
+	ERR_FAIL_NULL(instance);
+
+	_instance_set_transform(instance, p_transform);
+}
+
+void RendererSceneCull::instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	// Only queues the instances; their AABBs and BVH leaves are all refreshed together
+	// by the next update_dirty_instances().
+	const RID *instances = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(instances[i]);
+		ERR_CONTINUE(!instance);
+
+		_instance_set_transform(instance, transforms[i]);
+	}
 }
 
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
@@ -1187,8 +1209,8 @@ Vector<ObjectID> RendererSceneCull::instances_cull_aabb(const AABB &p_aabb, RID
 	};
 
 	CullAABB cull_aabb;
-	scenario->indexers[Scenario::INDEXER_GEOMETRY].aabb_query(p_aabb, cull_aabb);
-	scenario->indexers[Scenario::INDEXER_VOLUMES].aabb_query(p_aabb, cull_aabb);
+	scenario->indexer_aabb_query(Scenario::INDEXER_GEOMETRY, p_aabb, cull_aabb);
+	scenario->indexer_aabb_query(Scenario::INDEXER_VOLUMES, p_aabb, cull_aabb);
 	return cull_aabb.instances;
 }
 
@@ -1235,8 +1257,8 @@ Vector<ObjectID> RendererSceneCull::instances_cull_convex(const Vector<Plane> &p
 	};
 
 	CullConvex cull_convex;
-	scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(p_convex.ptr(), p_convex.size(), points.ptr(), points.size(), cull_convex);
-	scenario->indexers[Scenario::INDEXER_VOLUMES].convex_query(p_convex.ptr(), p_convex.size(), points.ptr(), points.size(), cull_convex);
+	scenario->indexer_convex_query(Scenario::INDEXER_GEOMETRY, p_convex.ptr(), p_convex.size(), points.ptr(), points.size(), cull_convex);
+	scenario->indexer_convex_query(Scenario::INDEXER_VOLUMES, p_convex.ptr(), p_convex.size(), points.ptr(), points.size(), cull_convex);
 	return cull_convex.instances;
 }
 
@@ -1760,8 +1782,10 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 	if (!p_instance->indexer_id.is_valid()) {
 		if ((1 << p_instance->base_type) & RSE::INSTANCE_GEOMETRY_MASK) {
 			p_instance->indexer_id = p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY].insert(bvh_aabb, p_instance);
+			p_instance->scenario->indexer_changed(Scenario::INDEXER_GEOMETRY);
 		} else {
 			p_instance->indexer_id = p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].insert(bvh_aabb, p_instance);
+			p_instance->scenario->indexer_changed(Scenario::INDEXER_VOLUMES);
 		}
 
 		p_instance->array_index = p_instance->scenario->instance_data.size();
@@ -1846,14 +1870,20 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 
 		p_instance->scenario->instance_data.push_back(idata);
 		p_instance->scenario->instance_aabbs.push_back(InstanceBounds(p_instance->transformed_aabb));
+		p_instance->scenario->instance_frustum_coherence.push_back(InstanceFrustumCoherence());
 		_update_instance_visibility_dependencies(p_instance);
 	} else {
 		if ((1 << p_instance->base_type) & RSE::INSTANCE_GEOMETRY_MASK) {
-			p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY].update(p_instance->indexer_id, bvh_aabb);
+			if (p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY].update(p_instance->indexer_id, bvh_aabb)) {
+				p_instance->scenario->wide_indexers[Scenario::INDEXER_GEOMETRY].update(p_instance->indexer_id, bvh_aabb);
+			}
 		} else {
-			p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].update(p_instance->indexer_id, bvh_aabb);
+			if (p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].update(p_instance->indexer_id, bvh_aabb)) {
+				p_instance->scenario->wide_indexers[Scenario::INDEXER_VOLUMES].update(p_instance->indexer_id, bvh_aabb);
+			}
 		}
 		p_instance->scenario->instance_aabbs[p_instance->array_index] = InstanceBounds(p_instance->transformed_aabb);
+		p_instance->scenario->instance_frustum_coherence[p_instance->array_index].epoch = 0;
 	}
 
 	if (p_instance->visibility_index != -1) {
@@ -1928,8 +1958,10 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 
 	if ((1 << p_instance->base_type) & RSE::INSTANCE_GEOMETRY_MASK) {
 		p_instance->scenario->indexers[Scenario::INDEXER_GEOMETRY].remove(p_instance->indexer_id);
+		p_instance->scenario->indexer_changed(Scenario::INDEXER_GEOMETRY);
 	} else {
 		p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].remove(p_instance->indexer_id);
+		p_instance->scenario->indexer_changed(Scenario::INDEXER_VOLUMES);
 	}
 
 	p_instance->indexer_id = DynamicBVH::ID();
@@ -1941,6 +1973,7 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 		swapped_instance->array_index = p_instance->array_index; //swap
 		p_instance->scenario->instance_data[p_instance->array_index] = p_instance->scenario->instance_data[swap_with_index];
 		p_instance->scenario->instance_aabbs[p_instance->array_index] = p_instance->scenario->instance_aabbs[swap_with_index];
+		p_instance->scenario->instance_frustum_coherence[p_instance->array_index] = p_instance->scenario->instance_frustum_coherence[swap_with_index];
 
 		if (swapped_instance->visibility_index != -1) {
 			swapped_instance->scenario->instance_visibility[swapped_instance->visibility_index].array_index = swapped_instance->array_index;
@@ -1957,6 +1990,7 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 	// pop last
 	p_instance->scenario->instance_data.pop_back();
 	p_instance->scenario->instance_aabbs.pop_back();
+	p_instance->scenario->instance_frustum_coherence.pop_back();
 
 	//uninitialize
 	p_instance->array_index = -1;
@@ -2361,14 +2395,12 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 	}
 }
 
-bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_mesh_lod_threshold, uint32_t p_visible_layers) {
+void RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, float p_screen_mesh_lod_threshold, int32_t p_light_culler_id) {
 	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
 
 	Transform3D light_transform = p_instance->transform;
 	light_transform.orthonormalize(); //scale does not count on lights
 
-	bool animated_material_found = false;
-
 	switch (RSG::light_storage->light_get_type(p_instance->base)) {
 		case RSE::LIGHT_DIRECTIONAL: {
 		} break;
@@ -2377,7 +2409,8 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 			if (shadow_mode == RSE::LIGHT_OMNI_SHADOW_DUAL_PARABOLOID || !RSG::light_storage->light_instances_can_render_shadow_cube()) {
 				if (max_shadows_used + 2 > MAX_UPDATE_SHADOWS) {
-					return true;
+					light->make_shadow_dirty(); // No room left this frame, try again on the next one.
+					return;
 				}
 				for (int i = 0; i < 2; i++) {
 					//using this one ensures that raster deferred will have it
@@ -2395,57 +2428,15 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					planes.write[4] = light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius));
 					planes.write[5] = light_transform.xform(Plane(Vector3(0, 0, -z), 0));
 
-					instance_shadow_cull_result.clear();
-
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
-
-					struct CullConvex {
-						PagedArray<Instance *> *result;
-						_FORCE_INLINE_ bool operator()(void *p_data) {
-							Instance *p_instance = (Instance *)p_data;
-							result->push_back(p_instance);
-							return false;
-						}
-					};
-
-					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
-
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
-
-					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
-
-					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
-					}
-
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RSE::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base))) {
-							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
-						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
-					}
-
-					RSG::mesh_storage->update_mesh_instances();
+					_add_shadow_cull_task(p_instance, planes, i, p_light_culler_id);
 
 					RSG::light_storage->light_instance_set_shadow_transform(light->instance, Projection(), light_transform, radius, 0, i, 0);
-					shadow_data.light = light->instance;
-					shadow_data.pass = i;
 				}
 			} else { //shadow cube
 
 				if (max_shadows_used + 6 > MAX_UPDATE_SHADOWS) {
-					return true;
+					light->make_shadow_dirty();
+					return;
 				}
 
 				real_t radius = RSG::light_storage->light_get_param(p_instance->base, RSE::LIGHT_PARAM_RANGE);
@@ -2478,51 +2469,9 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 					Vector<Plane> planes = cm.get_projection_planes(xform);
 
-					instance_shadow_cull_result.clear();
-
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
-
-					struct CullConvex {
-						PagedArray<Instance *> *result;
-						_FORCE_INLINE_ bool operator()(void *p_data) {
-							Instance *p_instance = (Instance *)p_data;
-							result->push_back(p_instance);
-							return false;
-						}
-					};
-
-					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
-
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
-
-					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+					_add_shadow_cull_task(p_instance, planes, i, p_light_culler_id);
 
-					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
-					}
-
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RSE::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base))) {
-							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
-						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
-					}
-
-					RSG::mesh_storage->update_mesh_instances();
 					RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, xform, radius, 0, i, 0);
-
-					shadow_data.light = light->instance;
-					shadow_data.pass = i;
 				}
 
 				//restore the regular DP matrix
@@ -2534,7 +2483,8 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 			RENDER_TIMESTAMP("Cull SpotLight3D Shadow");
 
 			if (max_shadows_used + 1 > MAX_UPDATE_SHADOWS) {
-				return true;
+				light->make_shadow_dirty();
+				return;
 			}
 
 			real_t radius = RSG::light_storage->light_get_param(p_instance->base, RSE::LIGHT_PARAM_RANGE);
@@ -2546,56 +2496,111 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 			Vector<Plane> planes = cm.get_projection_planes(light_transform);
 
-			instance_shadow_cull_result.clear();
+			_add_shadow_cull_task(p_instance, planes, 0, p_light_culler_id);
 
-			Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
+			RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, light_transform, radius, 0, 0, 0);
 
-			struct CullConvex {
-				PagedArray<Instance *> *result;
-				_FORCE_INLINE_ bool operator()(void *p_data) {
-					Instance *p_instance = (Instance *)p_data;
-					result->push_back(p_instance);
-					return false;
-				}
-			};
+		} break;
+	}
+}
 
-			CullConvex cull_convex;
-			cull_convex.result = &instance_shadow_cull_result;
+void RendererSceneCull::_add_shadow_cull_task(Instance *p_light, const Vector<Plane> &p_planes, uint32_t p_pass, int32_t p_light_culler_id) {
+	InstanceLightData *light = static_cast<InstanceLightData *>(p_light->base_data);
 
-			p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
+	ShadowCullTask &task = shadow_cull_tasks[shadow_cull_task_count++];
+	task.light = p_light;
+	task.shadow_index = max_shadows_used;
+	task.caster_mask = RSG::light_storage->light_get_shadow_caster_mask(p_light->base);
+	task.light_culler_id = light->is_shadow_update_full() ? -1 : p_light_culler_id;
+	task.planes = p_planes;
 
-			RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+	RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+	shadow_data.light = light->instance;
+	shadow_data.pass = p_pass;
+}
 
-			if (!light->is_shadow_update_full()) {
-				light_culler->cull_regular_light(instance_shadow_cull_result);
-			}
+void RendererSceneCull::_shadow_cull_threaded(uint32_t p_task, ShadowCullData *p_cull_data) {
+	ShadowCullTask &task = shadow_cull_tasks[p_task];
 
-			for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-				Instance *instance = instance_shadow_cull_result[j];
-				if (!instance->visible || !((1 << instance->base_type) & RSE::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base))) {
-					continue;
-				} else {
-					if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-						animated_material_found = true;
-					}
+	Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&task.planes[0], task.planes.size());
 
-					if (instance->mesh_instance.is_valid()) {
-						RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-					}
-				}
-				shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+	struct CullConvex {
+		PagedArray<Instance *> *result;
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			Instance *p_instance = (Instance *)p_data;
+			result->push_back(p_instance);
+			return false;
+		}
+	};
+
+	CullConvex cull_convex;
+	cull_convex.result = &task.cull_result;
+
+	p_cull_data->scenario->indexer_convex_query(Scenario::INDEXER_GEOMETRY, task.planes.ptr(), task.planes.size(), points.ptr(), points.size(), cull_convex);
+
+	if (task.light_culler_id != -1) {
+		light_culler->cull_regular_light(task.cull_result, task.light_culler_id);
+	}
+
+	RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[task.shadow_index];
+	const uint32_t caster_mask = p_cull_data->visible_layers & task.caster_mask;
+
+	for (int j = 0; j < (int)task.cull_result.size(); j++) {
+		Instance *instance = task.cull_result[j];
+		if (!instance->visible || !((1 << instance->base_type) & RSE::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(instance->layer_mask & caster_mask)) {
+			continue;
+		} else {
+			if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
+				task.animated_material_found = true;
 			}
 
-			RSG::mesh_storage->update_mesh_instances();
+			// Mesh storage is not thread safe, so the updates are done after all tasks finish.
+			if (instance->mesh_instance.is_valid()) {
+				task.mesh_instances.push_back(instance->mesh_instance);
+			}
+		}
 
-			RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, light_transform, radius, 0, 0, 0);
-			shadow_data.light = light->instance;
-			shadow_data.pass = 0;
+		shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+	}
 
-		} break;
+	task.cull_result.clear();
+}
+
+void RendererSceneCull::_process_shadow_cull_tasks(Scenario *p_scenario, uint32_t p_visible_layers) {
+	if (shadow_cull_task_count == 0) {
+		return;
 	}
 
-	return animated_material_found;
+	RENDER_TIMESTAMP("> Render Light3D Shadows");
+
+	ShadowCullData cull_data;
+	cull_data.scenario = p_scenario;
+	cull_data.visible_layers = p_visible_layers;
+
+	if (shadow_cull_task_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_shadow_cull_threaded, &cull_data, shadow_cull_task_count, -1, true, SNAME("RenderCullShadows"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_shadow_cull_threaded(0, &cull_data);
+	}
+
+	for (uint32_t i = 0; i < shadow_cull_task_count; i++) {
+		ShadowCullTask &task = shadow_cull_tasks[i];
+		for (const RID &mesh_instance : task.mesh_instances) {
+			RSG::mesh_storage->mesh_instance_check_for_update(mesh_instance);
+		}
+		task.mesh_instances.clear();
+
+		if (task.animated_material_found) {
+			static_cast<InstanceLightData *>(task.light->base_data)->make_shadow_dirty();
+			task.animated_material_found = false;
+		}
+	}
+
+	RSG::mesh_storage->update_mesh_instances();
+	shadow_cull_task_count = 0;
+
+	RENDER_TIMESTAMP("< Render Light3D Shadows");
 }
 
 void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_camera, RID p_scenario, RID p_viewport, Size2 p_viewport_size, uint32_t p_jitter_phase_count, float p_screen_mesh_lod_threshold, RID p_shadow_atlas, Ref<XRInterface> &p_xr_interface, float p_window_output_max_value, RenderingServerTypes::RenderInfo *r_render_info) {
@@ -2811,6 +2816,64 @@ bool RendererSceneCull::_visibility_parent_check(const CullData &p_cull_data, co
 	return ((parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK) == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE) || (parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
 }
 
+bool RendererSceneCull::_in_frustum_coherent(const CullData &p_cull_data, uint64_t p_index) {
+	return p_cull_data.frustum_coherence->in_frustum(p_cull_data.scenario->instance_aabbs[p_index], p_cull_data.scenario->instance_frustum_coherence[p_index], p_cull_data.cull->frustum);
+}
+
+void RendererSceneCull::Scenario::FrustumCoherence::update(const Vector<Plane> &p_planes, const Vector3 &p_cam_position, real_t p_z_far, PagedArray<InstanceFrustumCoherence> &r_instances) {
+	// Start over once the drift gets large, as most instances would be tested anyway.
+	if (valid && drift_normal < 1.0 && drift_distance < p_z_far && origin.distance_to(p_cam_position) < p_z_far) {
+		real_t normal_change = 0.0;
+		real_t distance_change = 0.0;
+		for (int i = 0; i < PLANE_COUNT; i++) {
+			const Plane &from = planes[i];
+			const Plane &to = p_planes[i];
+			normal_change = MAX(normal_change, (to.normal - from.normal).length());
+			distance_change = MAX(distance_change, Math::abs((to.normal.dot(origin) - to.d) - (from.normal.dot(origin) - from.d)));
+		}
+		drift_normal += normal_change;
+		// Pad for rounding errors, so a static camera still retests instances on the planes.
+		drift_distance += distance_change + CMP_EPSILON;
+	} else {
+		epoch++;
+		if (epoch == 0) {
+			// Entries last tested in an old epoch with the same number would be trusted again.
+			for (uint64_t i = 0; i < r_instances.size(); i++) {
+				r_instances[i].epoch = 0;
+			}
+			epoch = 1; // 0 marks instances whose bounds changed.
+		}
+		valid = true;
+		origin = p_cam_position;
+		drift_normal = 0.0;
+		drift_distance = 0.0;
+	}
+
+	for (int i = 0; i < PLANE_COUNT; i++) {
+		planes[i] = p_planes[i];
+	}
+}
+
+const RendererSceneCull::Scenario::FrustumCoherence *RendererSceneCull::_update_frustum_coherence(Scenario *p_scenario, RID p_viewport, const Vector<Plane> &p_planes, const Vector3 &p_cam_position, real_t p_z_far) {
+	Scenario::FrustumCoherence &coherence = p_scenario->frustum_coherence;
+	if (p_planes.size() != Scenario::FrustumCoherence::PLANE_COUNT) {
+		return nullptr;
+	}
+
+	uint64_t frame_number = RSG::rasterizer->get_frame_number();
+	if (coherence.viewport != p_viewport) {
+		if (coherence.viewport.is_valid() && coherence.frame + 1 >= frame_number) {
+			return nullptr; // Still in use by another viewport showing this scenario.
+		}
+		coherence.viewport = p_viewport;
+		coherence.valid = false;
+	}
+	coherence.frame = frame_number;
+
+	coherence.update(p_planes, p_cam_position, p_z_far, p_scenario->instance_frustum_coherence);
+	return &coherence;
+}
+
 void RendererSceneCull::_scene_cull_threaded(uint32_t p_thread, CullData *cull_data) {
 	uint32_t cull_total = cull_data->scenario->instance_data.size();
 	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
@@ -2851,13 +2914,14 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #define HIDDEN_BY_VISIBILITY_CHECKS (visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE || visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN)
 #define LAYER_CHECK (cull_data.visible_layers & idata.layer_mask)
 #define IN_FRUSTUM(f) (cull_data.scenario->instance_aabbs[i].in_frustum(f))
+#define IN_CAMERA_FRUSTUM (cull_data.frustum_coherence ? _in_frustum_coherent(cull_data, i) : IN_FRUSTUM(cull_data.cull->frustum))
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
 #define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near, is_orthogonal, cull_data.scenario->instance_data[i].occlusion_timeout))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
-			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
+			if ((LAYER_CHECK && IN_CAMERA_FRUSTUM && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
 				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 				if (base_type == RSE::INSTANCE_LIGHT) {
 					cull_result.lights.push_back(idata.instance);
@@ -3159,6 +3223,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #undef HIDDEN_BY_VISIBILITY_CHECKS
 #undef LAYER_CHECK
 #undef IN_FRUSTUM
+#undef IN_CAMERA_FRUSTUM
 #undef VIS_RANGE_CHECK
 #undef VIS_PARENT_CHECK
 #undef VIS_CHECK
@@ -3259,7 +3324,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 	{
 		cull.shadow_count = 0;
 
-		Vector<Instance *> lights_with_shadow;
+		FrameLocalVector<Instance *> lights_with_shadow;
 
 		for (Instance *E : scenario->directional_lights) {
 			if (!E->visible || !(E->layer_mask & p_visible_layers)) {
@@ -3285,7 +3350,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 		RSG::light_storage->set_directional_shadow_count(lights_with_shadow.size());
 
-		for (int i = 0; i < lights_with_shadow.size(); i++) {
+		for (uint32_t i = 0; i < lights_with_shadow.size(); i++) {
 			_light_instance_setup_directional_shadow(i, lights_with_shadow[i], p_camera_data->main_transform, p_camera_data->main_projection, p_camera_data->is_orthogonal, p_camera_data->vaspect);
 		}
 	}
@@ -3333,6 +3398,9 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		cull_data.occlusion_buffer = RendererSceneOcclusionCull::get_singleton()->buffer_get_ptr(p_viewport);
 		cull_data.camera_matrix = &p_camera_data->main_projection;
 		cull_data.visibility_viewport_mask = scenario->viewport_visibility_masks.has(p_viewport) ? scenario->viewport_visibility_masks[p_viewport] : 0;
+		if (use_frustum_coherence && !render_reflection_probe && p_viewport.is_valid()) {
+			cull_data.frustum_coherence = _update_frustum_coherence(scenario, p_viewport, planes, camera_position, p_camera_data->main_projection.get_z_far());
+		}
 #ifdef DEBUG_CULL_TIME
 		uint64_t time_from = OS::get_singleton()->get_ticks_usec();
 #endif
@@ -3395,6 +3463,8 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		}
 
 		// Positional Shadows
+		// Shadow passes are only set up here, their casters are culled in parallel afterwards.
+		int32_t regular_light_count = 0;
 		for (uint32_t i = 0; i < (uint32_t)scene_cull_result.lights.size(); i++) {
 			Instance *ins = scene_cull_result.lights[i];
 
@@ -3482,12 +3552,14 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 			// so that we can turn off tighter caster culling.
 			light->detect_light_intersects_multiple_cameras(Engine::get_singleton()->get_frames_drawn());
 
+			int32_t light_culler_id = -1;
 			if (light->is_shadow_dirty()) {
 				// Dirty shadows have no need to be drawn if
 				// the light volume doesn't intersect the camera frustum.
 
 				// Returns false if the entire light can be culled.
-				bool allow_redraw = light_culler->prepare_regular_light(*ins);
+				light_culler_id = regular_light_count++;
+				bool allow_redraw = light_culler->prepare_regular_light(*ins, light_culler_id);
 
 				// Directional lights aren't handled here, _light_instance_update_shadow is called from elsewhere.
 				// Checking for this in case this changes, as this is assumed.
@@ -3509,17 +3581,16 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 			if (redraw && max_shadows_used < MAX_UPDATE_SHADOWS) {
 				//must redraw!
-				RENDER_TIMESTAMP("> Render Light3D " + itos(i));
-				if (_light_instance_update_shadow(ins, p_camera_data->main_transform, p_camera_data->main_projection, p_camera_data->is_orthogonal, p_camera_data->vaspect, p_shadow_atlas, scenario, p_screen_mesh_lod_threshold, p_visible_layers)) {
-					light->make_shadow_dirty();
-				}
-				RENDER_TIMESTAMP("< Render Light3D " + itos(i));
+				// Only sets up the culling, which runs for all lights in _process_shadow_cull_tasks().
+				_light_instance_update_shadow(ins, p_camera_data->main_transform, p_camera_data->main_projection, p_camera_data->is_orthogonal, p_camera_data->vaspect, p_shadow_atlas, p_screen_mesh_lod_threshold, light_culler_id);
 			} else {
 				if (redraw) {
 					light->make_shadow_dirty();
 				}
 			}
 		}
+
+		_process_shadow_cull_tasks(scenario, p_visible_layers);
 	}
 
 	//render SDFGI
@@ -3732,7 +3803,7 @@ void RendererSceneCull::render_probes() {
 	/* REFLECTION PROBES */
 
 	SelfList<InstanceReflectionProbeData> *ref_probe = reflection_probe_render_list.first();
-	Vector<SelfList<InstanceReflectionProbeData> *> done_list;
+	FrameLocalVector<SelfList<InstanceReflectionProbeData> *> done_list;
 
 	bool busy = false;
 
@@ -4004,8 +4075,8 @@ void RendererSceneCull::render_particle_colliders() {
 			CullAABB cull_aabb;
 			cull_aabb.result = &instance_cull_result;
 			cull_aabb.heightfield_mask = RSG::particles_storage->particles_collision_get_height_field_mask(hfpc->base);
-			hfpc->scenario->indexers[Scenario::INDEXER_GEOMETRY].aabb_query(hfpc->transformed_aabb, cull_aabb);
-			hfpc->scenario->indexers[Scenario::INDEXER_VOLUMES].aabb_query(hfpc->transformed_aabb, cull_aabb);
+			hfpc->scenario->indexer_aabb_query(Scenario::INDEXER_GEOMETRY, hfpc->transformed_aabb, cull_aabb);
+			hfpc->scenario->indexer_aabb_query(Scenario::INDEXER_VOLUMES, hfpc->transformed_aabb, cull_aabb);
 
 			for (int i = 0; i < (int)instance_cull_result.size(); i++) {
 				Instance *instance = instance_cull_result[i];
@@ -4249,6 +4320,26 @@ void RendererSceneCull::update() {
 	}
 	scene_render->update();
 	update_dirty_instances();
+
+	// Rebuild the wide indexers once the set of instances settles, or once moving
+	// instances have loosened them too much.
+	for (uint32_t i = 0; i < rid_count; i++) {
+		Scenario *s = scenario_owner.get_or_null(rids[i]);
+		for (int j = 0; j < Scenario::INDEXER_MAX; j++) {
+			if (s->wide_indexers[j].is_valid()) {
+				if (s->wide_indexers[j].is_degraded()) {
+					s->wide_indexers[j].build(s->indexers[j]);
+				}
+				continue;
+			}
+			if (s->indexer_stable_updates[j] < WIDE_INDEXER_REBUILD_DELAY) {
+				s->indexer_stable_updates[j]++;
+			} else {
+				s->wide_indexers[j].build(s->indexers[j]);
+			}
+		}
+	}
+
 	render_particle_colliders();
 }
 
@@ -4272,6 +4363,7 @@ bool RendererSceneCull::free(RID p_rid) {
 		}
 		scenario->instance_aabbs.reset();
 		scenario->instance_data.reset();
+		scenario->instance_frustum_coherence.reset();
 		scenario->instance_visibility.reset();
 
 		RSG::light_storage->shadow_atlas_free(scenario->reflection_probe_shadow_atlas);
@@ -4366,10 +4458,10 @@ RendererSceneCull::RendererSceneCull() {
 	singleton = this;
 
 	instance_cull_result.set_page_pool(&instance_cull_page_pool);
-	instance_shadow_cull_result.set_page_pool(&instance_cull_page_pool);
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
+		shadow_cull_tasks[i].cull_result.set_page_pool(&instance_cull_page_pool);
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
@@ -4384,9 +4476,10 @@ RendererSceneCull::RendererSceneCull() {
 	indexer_update_iterations = GLOBAL_GET("rendering/limits/spatial_indexer/update_iterations_per_frame");
 	thread_cull_threshold = GLOBAL_GET("rendering/limits/spatial_indexer/threaded_cull_minimum_instances");
 	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); //make sure there is at least one thread per CPU
+	use_frustum_coherence = GLOBAL_GET("rendering/limits/spatial_indexer/use_frustum_coherence");
 	RendererSceneOcclusionCull::HZBuffer::occlusion_jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
 
-	dummy_occlusion_culling = memnew(RendererSceneOcclusionCull);
+	builtin_occlusion_culling = memnew(RasterOcclusionCull);
 
 	light_culler = memnew(RenderingLightCuller);
 
@@ -4397,10 +4490,10 @@ RendererSceneCull::RendererSceneCull() {
 
 RendererSceneCull::~RendererSceneCull() {
 	instance_cull_result.reset();
-	instance_shadow_cull_result.reset();
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.reset();
+		shadow_cull_tasks[i].cull_result.reset();
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.reset();
@@ -4412,8 +4505,8 @@ RendererSceneCull::~RendererSceneCull() {
 	}
 	scene_cull_result_threads.clear();
 
-	if (dummy_occlusion_culling) {
-		memdelete(dummy_occlusion_culling);
+	if (builtin_occlusion_culling) {
+		memdelete(builtin_occlusion_culling);
 	}
 
 	if (light_culler) {
@@ -32,6 +32,7 @@
 
 #include "core/math/dynamic_bvh.h"
 #include "core/math/transform_interpolator.h"
+#include "core/math/wide_bvh.h"
 #include "core/templates/bin_sorted_array.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
@@ -50,6 +51,8 @@
 class RenderingLightCuller;
 
 class RendererSceneCull : public RenderingMethod {
+	friend class TestRendererSceneCullAccessor;
+
 public:
 	RendererSceneRender *scene_render = nullptr;
 
@@ -126,7 +129,8 @@ public:
 
 	/* VISIBILITY NOTIFIER API */
 
-	RendererSceneOcclusionCull *dummy_occlusion_culling = nullptr;
+	// Used unless a module (such as raycast) provides its own occlusion culling.
+	RendererSceneOcclusionCull *builtin_occlusion_culling = nullptr;
 
 	/* SCENARIO API */
 
@@ -225,6 +229,29 @@ public:
 
 			return true;
 		}
+		// Same test as in_frustum(), but measures it: the largest signed distance to the planes is
+		// negative (minus the margin) when inside, and zero or more when outside.
+		_ALWAYS_INLINE_ real_t frustum_distance(const Frustum &p_frustum) const {
+			real_t distance = -Math::INF;
+			for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+				Vector3 min(
+						bounds[p_frustum.plane_signs_ptr[i].signs[0]],
+						bounds[p_frustum.plane_signs_ptr[i].signs[1]],
+						bounds[p_frustum.plane_signs_ptr[i].signs[2]]);
+
+				distance = MAX(distance, p_frustum.planes_ptr[i].distance_to(min));
+			}
+
+			return distance;
+		}
+		// Distance from the point to the farthest corner.
+		_ALWAYS_INLINE_ real_t reach_from(const Vector3 &p_point) const {
+			Vector3 farthest(
+					MAX(Math::abs(bounds[0] - p_point.x), Math::abs(bounds[3] - p_point.x)),
+					MAX(Math::abs(bounds[1] - p_point.y), Math::abs(bounds[4] - p_point.y)),
+					MAX(Math::abs(bounds[2] - p_point.z), Math::abs(bounds[5] - p_point.z)));
+			return farthest.length();
+		}
 		_ALWAYS_INLINE_ bool in_aabb(const AABB &p_aabb) const {
 			Vector3 end = p_aabb.position + p_aabb.size;
 
@@ -298,6 +325,15 @@ public:
 		uint64_t occlusion_timeout = 0;
 	};
 
+	struct InstanceFrustumCoherence {
+		// Result of the last camera frustum test, reused while the frustum drifted by less than
+		// `key` at this instance. See Scenario::FrustumCoherence.
+		real_t reach = 0.0;
+		real_t key = 0.0;
+		uint32_t epoch = 0; // 0 when the bounds changed.
+		bool inside = false;
+	};
+
 	struct InstanceVisibilityData {
 		uint64_t viewport_state = 0;
 		int32_t array_index = -1;
@@ -322,6 +358,7 @@ public:
 
 	PagedArrayPool<InstanceBounds> instance_aabb_page_pool;
 	PagedArrayPool<InstanceData> instance_data_page_pool;
+	PagedArrayPool<InstanceFrustumCoherence> instance_frustum_coherence_page_pool;
 	PagedArrayPool<InstanceVisibilityData> instance_visibility_data_page_pool;
 
 	struct Scenario {
@@ -332,6 +369,34 @@ public:
 		};
 
 		DynamicBVH indexers[INDEXER_MAX];
+		// Faster copies of the indexers for queries, rebuilt once no leaves were inserted
+		// or removed for a few updates. Moved leaves are refitted in place, until the
+		// refits degrade the tree enough to rebuild it.
+		WideBVH wide_indexers[INDEXER_MAX];
+		uint32_t indexer_stable_updates[INDEXER_MAX] = {};
+
+		_FORCE_INLINE_ void indexer_changed(IndexerType p_indexer) {
+			wide_indexers[p_indexer].invalidate();
+			indexer_stable_updates[p_indexer] = 0;
+		}
+
+		template <typename QueryResult>
+		_FORCE_INLINE_ void indexer_aabb_query(IndexerType p_indexer, const AABB &p_aabb, QueryResult &r_result) {
+			if (wide_indexers[p_indexer].is_valid()) {
+				wide_indexers[p_indexer].aabb_query(p_aabb, r_result);
+			} else {
+				indexers[p_indexer].aabb_query(p_aabb, r_result);
+			}
+		}
+
+		template <typename QueryResult>
+		_FORCE_INLINE_ void indexer_convex_query(IndexerType p_indexer, const Plane *p_planes, int p_plane_count, const Vector3 *p_points, int p_point_count, QueryResult &r_result) {
+			if (wide_indexers[p_indexer].is_valid()) {
+				wide_indexers[p_indexer].convex_query(p_planes, p_plane_count, p_points, p_point_count, r_result);
+			} else {
+				indexers[p_indexer].convex_query(p_planes, p_plane_count, p_points, p_point_count, r_result);
+			}
+		}
 
 		RID self;
 
@@ -353,6 +418,44 @@ public:
 		PagedArray<InstanceData> instance_data;
 		VisibilityArray instance_visibility;
 
+		// Frame-coherent camera frustum culling, used by one viewport at a time.
+		// Signed distances to the planes change by at most `drift_normal * reach + drift_distance`
+		// since the start of the epoch, where reach is an instance's distance from `origin`.
+		struct FrustumCoherence {
+			static constexpr int PLANE_COUNT = 6;
+
+			RID viewport;
+			uint64_t frame = 0;
+			uint32_t epoch = 0;
+			bool valid = false;
+			Vector3 origin;
+			Plane planes[PLANE_COUNT];
+			real_t drift_normal = 0.0;
+			real_t drift_distance = 0.0;
+
+			// Moves the planes to the current frame, or starts a new epoch which tests every instance again.
+			void update(const Vector<Plane> &p_planes, const Vector3 &p_cam_position, real_t p_z_far, PagedArray<InstanceFrustumCoherence> &r_instances);
+
+			// Same result as `p_bounds.in_frustum(p_frustum)`.
+			_ALWAYS_INLINE_ bool in_frustum(const InstanceBounds &p_bounds, InstanceFrustumCoherence &r_cached, const Frustum &p_frustum) const {
+				if (r_cached.epoch == epoch) {
+					// The planes can't have crossed the instance since its last test.
+					if (drift_normal * r_cached.reach + drift_distance < r_cached.key) {
+						return r_cached.inside;
+					}
+				} else {
+					r_cached.epoch = epoch;
+					r_cached.reach = p_bounds.reach_from(origin);
+				}
+
+				const real_t distance = p_bounds.frustum_distance(p_frustum);
+				r_cached.inside = distance < 0.0;
+				r_cached.key = drift_normal * r_cached.reach + drift_distance + Math::abs(distance);
+				return r_cached.inside;
+			}
+		} frustum_coherence;
+		PagedArray<InstanceFrustumCoherence> instance_frustum_coherence;
+
 		Scenario() {
 			indexers[INDEXER_GEOMETRY].set_index(INDEXER_GEOMETRY);
 			indexers[INDEXER_VOLUMES].set_index(INDEXER_VOLUMES);
@@ -361,6 +464,8 @@ public:
 	};
 
 	int indexer_update_iterations = 0;
+	// Updates without insertions or removals before the wide indexers are rebuilt.
+	static constexpr uint32_t WIDE_INDEXER_REBUILD_DELAY = 4;
 
 	mutable RID_Owner<Scenario, true> scenario_owner;
 
@@ -618,6 +723,7 @@ public:
 
 	mutable SelfList<Instance>::List _instance_update_list;
 	void _instance_queue_update(Instance *p_instance, bool p_update_aabb, bool p_update_dependencies = false) const;
+	void _instance_set_transform(Instance *p_instance, const Transform3D &p_transform);
 
 	struct InstanceGeometryData : public InstanceBaseData {
 		RenderGeometryInstance *geometry_instance = nullptr;
@@ -878,7 +984,6 @@ public:
 	PagedArrayPool<RID> rid_cull_page_pool;
 
 	PagedArray<Instance *> instance_cull_result;
-	PagedArray<Instance *> instance_shadow_cull_result;
 
 	struct InstanceCullResult {
 		PagedArray<RenderGeometryInstance *> geometry_instances;
@@ -1006,10 +1111,28 @@ public:
 	RendererSceneRender::RenderShadowData render_shadow_data[MAX_UPDATE_SHADOWS];
 	uint32_t max_shadows_used = 0;
 
+	// Caster culling for one positional light shadow pass. Tasks are set up serially,
+	// then all of them are culled in parallel into their own arrays.
+	struct ShadowCullTask {
+		Instance *light = nullptr;
+		uint32_t shadow_index = 0;
+		uint32_t caster_mask = 0;
+		int32_t light_culler_id = -1; // -1 if the light culler is not used for this pass.
+		Vector<Plane> planes;
+
+		PagedArray<Instance *> cull_result;
+		LocalVector<RID> mesh_instances;
+		bool animated_material_found = false;
+	};
+
+	ShadowCullTask shadow_cull_tasks[MAX_UPDATE_SHADOWS];
+	uint32_t shadow_cull_task_count = 0;
+
 	RendererSceneRender::RenderSDFGIData render_sdfgi_data[SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE];
 	RendererSceneRender::RenderSDFGIUpdateData sdfgi_update_data;
 
 	uint32_t thread_cull_threshold = 200;
+	bool use_frustum_coherence = false;
 
 	mutable RID_Owner<Instance, true> instance_owner{ 65536, 4194304 };
 
@@ -1026,6 +1149,7 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center);
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform);
+	virtual void instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material);
@@ -1078,7 +1202,8 @@ public:
 
 	void _light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect);
 
-	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_mesh_lod_threshold, uint32_t p_visible_layers = 0xFFFFFF);
+	_FORCE_INLINE_ void _light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, float p_screen_mesh_lod_threshold, int32_t p_light_culler_id = -1);
+	void _add_shadow_cull_task(Instance *p_light, const Vector<Plane> &p_planes, uint32_t p_pass, int32_t p_light_culler_id);
 
 	RID _render_get_environment(RID p_camera, RID p_scenario);
 	RID _render_get_compositor(RID p_camera, RID p_scenario);
@@ -1145,12 +1270,23 @@ public:
 		const RendererSceneOcclusionCull::HZBuffer *occlusion_buffer;
 		const Projection *camera_matrix;
 		uint64_t visibility_viewport_mask;
+		const Scenario::FrustumCoherence *frustum_coherence = nullptr;
 	};
 
 	void _scene_cull_threaded(uint32_t p_thread, CullData *cull_data);
+
+	struct ShadowCullData {
+		Scenario *scenario = nullptr;
+		uint32_t visible_layers = 0;
+	};
+
+	void _shadow_cull_threaded(uint32_t p_task, ShadowCullData *p_cull_data);
+	void _process_shadow_cull_tasks(Scenario *p_scenario, uint32_t p_visible_layers);
 	void _scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to);
 	static void _scene_particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis);
 	_FORCE_INLINE_ bool _visibility_parent_check(const CullData &p_cull_data, const InstanceData &p_instance_data);
+	_FORCE_INLINE_ bool _in_frustum_coherent(const CullData &p_cull_data, uint64_t p_index);
+	const Scenario::FrustumCoherence *_update_frustum_coherence(Scenario *p_scenario, RID p_viewport, const Vector<Plane> &p_planes, const Vector3 &p_cam_position, real_t p_z_far);
 
 	bool _render_reflection_probe_step(Instance *p_instance, int p_step);
 
@@ -41,6 +41,13 @@ class RendererSceneOcclusionCull {
 protected:
 	static RendererSceneOcclusionCull *singleton;
 
+	bool _jitter_enabled = false;
+
+	// Offset to apply to the viewport rect in the current frame, if jitter is enabled.
+	Vector2 _get_jitter(const Rect2 &p_viewport_rect, const Size2i &p_buffer_size) const;
+	// Viewport rect on the near plane, in view space.
+	static Rect2 _get_viewport_rect(const Projection &p_cam_projection);
+
 public:
 	class HZBuffer {
 	protected:
@@ -86,7 +86,17 @@ void RenderingLightCuller::prepare_directional_light(const RendererSceneCull::In
 	_prepare_light(*p_instance, p_directional_light_id);
 }
 
-bool RenderingLightCuller::_prepare_light(const RendererSceneCull::Instance &p_instance, int32_t p_directional_light_id) {
+bool RenderingLightCuller::prepare_regular_light(const RendererSceneCull::Instance &p_instance, int32_t p_regular_light_id) {
+	ERR_FAIL_COND_V(p_regular_light_id < 0, true);
+
+	if (p_regular_light_id >= (int32_t)data.regular_cull_planes.size()) {
+		data.regular_cull_planes.resize(p_regular_light_id + 1);
+	}
+
+	return _prepare_light(p_instance, -1, p_regular_light_id);
+}
+
+bool RenderingLightCuller::_prepare_light(const RendererSceneCull::Instance &p_instance, int32_t p_directional_light_id, int32_t p_regular_light_id) {
 	if (!data.is_active()) {
 		return true;
 	}
@@ -135,7 +145,7 @@ bool RenderingLightCuller::_prepare_light(const RendererSceneCull::Instance &p_i
 	// If SOMEHOW there's actually 0 cascades though, I suppose there isn't going to be anything visible after all.
 	bool visible = false;
 	if (p_directional_light_id == -1) {
-		visible = _add_light_camera_planes(data.regular_cull_planes, lsource, { &data.frustum_planes[0], data.frustum_points });
+		visible = _add_light_camera_planes(data.regular_cull_planes[p_regular_light_id], lsource, { &data.frustum_planes[0], data.frustum_points });
 	} else {
 		int used_planes = 1 + lsource.cascade_count; // 2 for ortho (near+far), 3 for pssm2 (near+mid+far), 5 for pssm4 (near+3mids+far).
 		Plane boundary_planes[5];
@@ -245,14 +255,19 @@ bool RenderingLightCuller::cull_directional_light(const RendererSceneCull::Insta
 	return true;
 }
 
-void RenderingLightCuller::cull_regular_light(PagedArray<RendererSceneCull::Instance *> &r_instance_shadow_cull_result) {
+void RenderingLightCuller::cull_regular_light(PagedArray<RendererSceneCull::Instance *> &r_instance_shadow_cull_result, int32_t p_regular_light_id) {
 	if (!data.is_active() || !is_caster_culling_active()) {
 		return;
 	}
 
+	ERR_FAIL_INDEX(p_regular_light_id, (int32_t)data.regular_cull_planes.size());
+
+	// Only read from here on, as several lights may be culled at the same time.
+	const LightCullPlanes &cull_planes = data.regular_cull_planes[p_regular_light_id];
+
 	// If the light is out of range, no need to check anything, just return 0 casters.
 	// Ideally an out of range light should not even be drawn AT ALL (no shadow map, no PCF etc).
-	if (data.out_of_range) {
+	if (cull_planes.out_of_range) {
 		return;
 	}
 
@@ -277,13 +292,13 @@ void RenderingLightCuller::cull_regular_light(PagedArray<RendererSceneCull::Inst
 		real_t r_min, r_max;
 		bool show = true;
 
-		for (int p = 0; p < data.regular_cull_planes.num_cull_planes; p++) {
+		for (int p = 0; p < cull_planes.num_cull_planes; p++) {
 			// As we only need r_min, could this be optimized?
-			bb.project_range_in_plane(data.regular_cull_planes.cull_planes[p], r_min, r_max);
+			bb.project_range_in_plane(cull_planes.cull_planes[p], r_min, r_max);
 
 #ifdef LIGHT_CULLER_DEBUG_LOGGING
 			if (is_logging()) {
-				print_line("\tplane " + itos(p) + " : " + String(data.regular_cull_planes.cull_planes[p]) + " r_min " + String(Variant(r_min)) + " r_max " + String(Variant(r_max)));
+				print_line("\tplane " + itos(p) + " : " + String(cull_planes.cull_planes[p]) + " r_min " + String(Variant(r_min)) + " r_max " + String(Variant(r_max)));
 			}
 #endif
 
@@ -301,7 +316,7 @@ void RenderingLightCuller::cull_regular_light(PagedArray<RendererSceneCull::Inst
 			n--;
 
 #ifdef LIGHT_CULLER_DEBUG_REGULAR_LIGHT
-			data.regular_rejected_count++;
+			data.regular_rejected_count.increment();
 #endif
 		}
 	}
@@ -434,7 +449,7 @@ bool RenderingLightCuller::_add_light_camera_planes(LightCullPlanes &r_cull_plan
 
 	// Start with 0 cull planes.
 	r_cull_planes.num_cull_planes = 0;
-	data.out_of_range = false;
+	r_cull_planes.out_of_range = false;
 	uint32_t lookup = 0;
 
 	// Find which of the camera planes are facing away from the light.
@@ -463,7 +478,7 @@ bool RenderingLightCuller::_add_light_camera_planes(LightCullPlanes &r_cull_plan
 				// be seen.
 				if (dist >= p_light_source.range) {
 					// If the light is out of range, no need to do anything else, everything will be culled.
-					data.out_of_range = true;
+					r_cull_planes.out_of_range = true;
 					return false;
 				}
 			}
@@ -492,7 +507,7 @@ bool RenderingLightCuller::_add_light_camera_planes(LightCullPlanes &r_cull_plan
 
 				// Is the light out of range?
 				if (dist >= p_light_source.range) {
-					data.out_of_range = true;
+					r_cull_planes.out_of_range = true;
 					return false;
 				}
 
@@ -504,7 +519,7 @@ bool RenderingLightCuller::_add_light_camera_planes(LightCullPlanes &r_cull_plan
 				float dist_end = cull_frustum_planes[n].distance_to(pos_end);
 
 				if (dist_end >= end_cone_radius) {
-					data.out_of_range = true;
+					r_cull_planes.out_of_range = true;
 					return false;
 				}
 			}
@@ -602,7 +617,7 @@ bool RenderingLightCuller::prepare_camera(const Transform3D &p_cam_transform, co
 	data.frustum_planes = p_cam_matrix.get_projection_planes(p_cam_transform);
 	DEV_CHECK_ONCE(data.frustum_planes.size() == 6);
 
-	data.regular_cull_planes.num_cull_planes = 0;
+	data.regular_cull_planes.resize(0);
 
 #ifdef LIGHT_CULLER_DEBUG_DIRECTIONAL_LIGHT
 	if (is_logging()) {
@@ -612,10 +627,10 @@ bool RenderingLightCuller::prepare_camera(const Transform3D &p_cam_transform, co
 	}
 #endif
 #ifdef LIGHT_CULLER_DEBUG_REGULAR_LIGHT
-	if (data.regular_rejected_count) {
-		print_line("LightCuller regular lights rejected " + itos(data.regular_rejected_count) + " instances.");
+	if (data.regular_rejected_count.get()) {
+		print_line("LightCuller regular lights rejected " + itos(data.regular_rejected_count.get()) + " instances.");
 	}
-	data.regular_rejected_count = 0;
+	data.regular_rejected_count.set(0);
 #endif
 
 	data.directional_cull_planes.resize(0);
@@ -2004,51 +2004,53 @@ void RenderingServer::_mesh_add_surface(RID p_mesh, const Dictionary &p_surface)
 	mesh_add_surface(p_mesh, _dict_to_surf(p_surface));
 }
 Dictionary RenderingServer::_mesh_get_surface(RID p_mesh, int p_idx) {
-	RenderingServerTypes::SurfaceData sd = mesh_get_surface(p_mesh, p_idx);
+	return _surf_to_dict(mesh_get_surface(p_mesh, p_idx));
+}
 
+Dictionary RenderingServer::_surf_to_dict(const RenderingServerTypes::SurfaceData &p_surface) {
 	Dictionary d;
-	d["primitive"] = sd.primitive;
-	d["format"] = sd.format;
-	d["vertex_data"] = sd.vertex_data;
-	if (sd.attribute_data.size()) {
-		d["attribute_data"] = sd.attribute_data;
+	d["primitive"] = p_surface.primitive;
+	d["format"] = p_surface.format;
+	d["vertex_data"] = p_surface.vertex_data;
+	if (p_surface.attribute_data.size()) {
+		d["attribute_data"] = p_surface.attribute_data;
 	}
-	if (sd.skin_data.size()) {
-		d["skin_data"] = sd.skin_data;
+	if (p_surface.skin_data.size()) {
+		d["skin_data"] = p_surface.skin_data;
 	}
-	d["vertex_count"] = sd.vertex_count;
-	if (sd.index_count) {
-		d["index_data"] = sd.index_data;
-		d["index_count"] = sd.index_count;
+	d["vertex_count"] = p_surface.vertex_count;
+	if (p_surface.index_count) {
+		d["index_data"] = p_surface.index_data;
+		d["index_count"] = p_surface.index_count;
 	}
-	d["aabb"] = sd.aabb;
-	d["uv_scale"] = sd.uv_scale;
+	d["aabb"] = p_surface.aabb;
+	d["uv_scale"] = p_surface.uv_scale;
 
-	if (sd.lods.size()) {
+	if (p_surface.lods.size()) {
 		Array lods;
-		for (int i = 0; i < sd.lods.size(); i++) {
+		for (int i = 0; i < p_surface.lods.size(); i++) {
 			Dictionary ld;
-			ld["edge_length"] = sd.lods[i].edge_length;
-			ld["index_data"] = sd.lods[i].index_data;
+			ld["edge_length"] = p_surface.lods[i].edge_length;
+			ld["index_data"] = p_surface.lods[i].index_data;
 			lods.push_back(ld);
 		}
 		d["lods"] = lods;
 	}
 
-	if (sd.bone_aabbs.size()) {
+	if (p_surface.bone_aabbs.size()) {
 		Array aabbs;
-		for (int i = 0; i < sd.bone_aabbs.size(); i++) {
-			aabbs.push_back(sd.bone_aabbs[i]);
+		for (int i = 0; i < p_surface.bone_aabbs.size(); i++) {
+			aabbs.push_back(p_surface.bone_aabbs[i]);
 		}
 		d["bone_aabbs"] = aabbs;
 	}
 
-	if (sd.blend_shape_data.size()) {
-		d["blend_shape_data"] = sd.blend_shape_data;
+	if (p_surface.blend_shape_data.size()) {
+		d["blend_shape_data"] = p_surface.blend_shape_data;
 	}
 
-	if (sd.material.is_valid()) {
-		d["material"] = sd.material;
+	if (p_surface.material.is_valid()) {
+		d["material"] = p_surface.material;
 	}
 	return d;
 }
@@ -2082,6 +2084,34 @@ void RenderingServer::_particles_set_trail_bind_poses(RID p_particles, const Typ
 	particles_set_trail_bind_poses(p_particles, tbposes);
 }
 
+void RenderingServer::_instance_set_transforms(const TypedArray<RID> &p_instances, const TypedArray<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	Vector<RID> instances;
+	Vector<Transform3D> transforms;
+	instances.resize(p_instances.size());
+	transforms.resize(p_transforms.size());
+	for (int i = 0; i < p_instances.size(); i++) {
+		instances.write[i] = p_instances[i];
+		transforms.write[i] = p_transforms[i];
+	}
+	instance_set_transforms(instances, transforms);
+}
+
+void RenderingServer::_canvas_item_set_transforms(const TypedArray<RID> &p_items, const TypedArray<Transform2D> &p_transforms) {
+	ERR_FAIL_COND(p_items.size() != p_transforms.size());
+
+	Vector<RID> items;
+	Vector<Transform2D> transforms;
+	items.resize(p_items.size());
+	transforms.resize(p_transforms.size());
+	for (int i = 0; i < p_items.size(); i++) {
+		items.write[i] = p_items[i];
+		transforms.write[i] = p_transforms[i];
+	}
+	canvas_item_set_transforms(items, transforms);
+}
+
 String RenderingServer::get_current_rendering_driver_name() const {
 	// Needs to remain in OS, since it's actually OS that interacts with it, but it's better exposed here.
 	return ::OS::get_singleton()->get_current_rendering_driver_name();
@@ -3210,6 +3240,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_layer_mask", "instance", "mask"), &RenderingServer::instance_set_layer_mask);
 	ClassDB::bind_method(D_METHOD("instance_set_pivot_data", "instance", "sorting_offset", "use_aabb_center"), &RenderingServer::instance_set_pivot_data);
 	ClassDB::bind_method(D_METHOD("instance_set_transform", "instance", "transform"), &RenderingServer::instance_set_transform);
+	ClassDB::bind_method(D_METHOD("instance_set_transforms", "instances", "transforms"), &RenderingServer::_instance_set_transforms);
 	ClassDB::bind_method(D_METHOD("instance_attach_object_instance_id", "instance", "id"), &RenderingServer::instance_attach_object_instance_id);
 	ClassDB::bind_method(D_METHOD("instance_set_blend_shape_weight", "instance", "shape", "weight"), &RenderingServer::instance_set_blend_shape_weight);
 	ClassDB::bind_method(D_METHOD("instance_set_surface_override_material", "instance", "surface", "material"), &RenderingServer::instance_set_surface_override_material);
@@ -3314,6 +3345,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("canvas_item_set_light_mask", "item", "mask"), &RenderingServer::canvas_item_set_light_mask);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_visibility_layer", "item", "visibility_layer"), &RenderingServer::canvas_item_set_visibility_layer);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_transform", "item", "transform"), &RenderingServer::canvas_item_set_transform);
+	ClassDB::bind_method(D_METHOD("canvas_item_set_transforms", "items", "transforms"), &RenderingServer::_canvas_item_set_transforms);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_clip", "item", "clip"), &RenderingServer::canvas_item_set_clip);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_distance_field_mode", "item", "enabled"), &RenderingServer::canvas_item_set_distance_field_mode);
 	ClassDB::bind_method(D_METHOD("canvas_item_set_custom_rect", "item", "use_custom_rect", "rect"), &RenderingServer::canvas_item_set_custom_rect, DEFVAL(Rect2()));
@@ -3794,6 +3826,7 @@ void RenderingServer::init() {
 
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/limits/spatial_indexer/update_iterations_per_frame", PROPERTY_HINT_RANGE, "0,1024,1"), 10);
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/limits/spatial_indexer/threaded_cull_minimum_instances", PROPERTY_HINT_RANGE, "32,65536,1"), 1000);
+	GLOBAL_DEF_RST("rendering/limits/spatial_indexer/use_frustum_coherence", false);
 
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/limits/cluster_builder/max_clustered_elements", PROPERTY_HINT_RANGE, "32,8192,1"), 512);
 
@@ -64,6 +64,8 @@ class RenderingDevice;
 class RenderingServer : public Object {
 	GDCLASS(RenderingServer, Object);
 
+	friend class RenderingServerCapture;
+
 	static RenderingServer *singleton;
 
 	int mm_policy = 0;
@@ -724,6 +726,7 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask) = 0;
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center) = 0;
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform) = 0;
+	virtual void instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) = 0;
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id) = 0;
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight) = 0;
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material) = 0;
@@ -801,6 +804,7 @@ public:
 	virtual void canvas_item_set_update_when_visible(RID p_item, bool p_update) = 0;
 
 	virtual void canvas_item_set_transform(RID p_item, const Transform2D &p_transform) = 0;
+	virtual void canvas_item_set_transforms(const Vector<RID> &p_items, const Vector<Transform2D> &p_transforms) = 0;
 	virtual void canvas_item_set_clip(RID p_item, bool p_clip) = 0;
 	virtual void canvas_item_set_distance_field_mode(RID p_item, bool p_enable) = 0;
 	virtual void canvas_item_set_custom_rect(RID p_item, bool p_custom_rect, const Rect2 &p_rect = Rect2()) = 0;
@@ -1061,10 +1065,13 @@ private:
 	RID _mesh_create_from_surfaces(const TypedArray<Dictionary> &p_surfaces, int p_blend_shape_count);
 	void _mesh_add_surface(RID p_mesh, const Dictionary &p_surface);
 	Dictionary _mesh_get_surface(RID p_mesh, int p_idx);
+	static Dictionary _surf_to_dict(const RenderingServerTypes::SurfaceData &p_surface);
 	TypedArray<Dictionary> _instance_geometry_get_shader_parameter_list(RID p_instance) const;
 	TypedArray<Dictionary> _canvas_item_get_instance_shader_parameter_list(RID p_item) const;
 	TypedArray<Image> _bake_render_uv2(RID p_base, const TypedArray<RID> &p_material_overrides, const Size2i &p_image_size);
 	void _particles_set_trail_bind_poses(RID p_particles, const TypedArray<Transform3D> &p_bind_poses);
+	void _instance_set_transforms(const TypedArray<RID> &p_instances, const TypedArray<Transform3D> &p_transforms);
+	void _canvas_item_set_transforms(const TypedArray<RID> &p_items, const TypedArray<Transform2D> &p_transforms);
 #ifdef TOOLS_ENABLED
 	SurfaceUpgradeCallback surface_upgrade_callback = nullptr;
 	bool warn_on_surface_upgrade = true;
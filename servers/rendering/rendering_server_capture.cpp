@@ -0,0 +1,484 @@
+/**************************************************************************/
+/*  rendering_server_capture.cpp                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "rendering_server_capture.h"
+
+#include "core/io/image.h"
+#include "core/object/class_db.h"
+#include "core/object/message_queue.h"
+#include "core/os/os.h"
+#include "core/variant/dictionary.h"
+#include "servers/rendering/rendering_server.h"
+
+static const uint8_t capture_magic[4] = { 'G', 'D', 'R', 'C' };
+
+RenderingServerCapture *RenderingServerCapture::singleton = nullptr;
+SafeFlag RenderingServerCapture::recording;
+thread_local bool RenderingServerCapture::drawing = false;
+
+bool RenderingServerCapture::Args::_convert(const RenderingServerTypes::SurfaceData &p_surface, Variant &r_variant) {
+	// Same layout the bound mesh_add_surface() and mesh_create_from_surfaces() take.
+	r_variant = RenderingServer::_surf_to_dict(p_surface);
+	return true;
+}
+
+Error RenderingServerCapture::start(const String &p_path, int p_frames) {
+	MutexLock lock(mutex);
+	ERR_FAIL_COND_V_MSG(file.is_valid(), ERR_ALREADY_IN_USE, "A rendering capture is already in progress.");
+
+	Error err;
+	file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(file.is_null(), err, vformat("Cannot open rendering capture file: \"%s\".", p_path));
+
+	file->store_buffer(capture_magic, 4);
+	file->store_32(FORMAT_VERSION);
+
+	method_ids.clear();
+	method_binds.clear();
+	dropped_calls.clear();
+	unbound_calls.clear();
+	call_count = 0;
+	frame_count = 0;
+	frames_left = p_frames;
+	recording.set();
+
+	print_verbose(vformat("Capturing RenderingServer calls to: \"%s\".", p_path));
+	return OK;
+}
+
+void RenderingServerCapture::_stop() {
+	if (file.is_null()) {
+		return;
+	}
+	recording.clear();
+	file.unref();
+
+	print_line(vformat("Rendering capture: %d frames, %d calls written.", frame_count, call_count));
+	for (const KeyValue<StringName, uint32_t> &E : dropped_calls) {
+		print_line(vformat("Rendering capture: %d calls to %s() skipped, their arguments cannot be serialized.", E.value, E.key));
+	}
+	for (const KeyValue<StringName, uint32_t> &E : unbound_calls) {
+		print_line(vformat("Rendering capture: %d calls to %s() skipped, no bound RenderingServer method takes these arguments.", E.value, E.key));
+	}
+}
+
+void RenderingServerCapture::stop() {
+	MutexLock lock(mutex);
+	_stop();
+}
+
+// Replay goes through ClassDB, so only calls matching a bound method by name
+// and argument types are worth writing. Some server methods are not bound,
+// or are bound under another name or signature.
+bool RenderingServerCapture::_is_bound(const StringName &p_method, const Args &p_args) {
+	MethodBind **cached = method_binds.getptr(p_method);
+	MethodBind *method = cached ? *cached : method_binds.insert(p_method, ClassDB::get_method(SNAME("RenderingServer"), p_method))->value;
+	if (!method) {
+		return false;
+	}
+
+	const int arg_count = p_args.values.size();
+	if (arg_count > method->get_argument_count() || arg_count < method->get_argument_count() - method->get_default_argument_count()) {
+		return false;
+	}
+	for (int i = 0; i < arg_count; i++) {
+		if (!Variant::can_convert_strict(p_args.values[i].get_type(), method->get_argument_type(i))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool RenderingServerCapture::_write_call(RecordType p_type, const char *p_method, const Args &p_args) {
+	StringName method = p_method;
+	HashMap<StringName, uint32_t> *skipped = nullptr;
+	if (!p_args.valid) {
+		skipped = &dropped_calls;
+	} else if (!_is_bound(method, p_args)) {
+		skipped = &unbound_calls;
+	}
+	if (skipped) {
+		uint32_t *count = skipped->getptr(method);
+		if (count) {
+			(*count)++;
+		} else {
+			skipped->insert(method, 1);
+		}
+		return false;
+	}
+
+	file->store_8(p_type);
+
+	// Method names are written once, the first time the method is seen. The
+	// reader recognizes them because ids are handed out sequentially.
+	const uint32_t *id = method_ids.getptr(method);
+	if (id) {
+		file->store_32(*id);
+	} else {
+		uint32_t new_id = method_ids.size();
+		method_ids.insert(method, new_id);
+		file->store_32(new_id);
+		file->store_pascal_string(method);
+	}
+
+	file->store_8(p_args.values.size());
+	for (const Variant &value : p_args.values) {
+		_store_value(file, value);
+	}
+	call_count++;
+	return true;
+}
+
+void RenderingServerCapture::record_call(const char *p_method, const Args &p_args) {
+	MutexLock lock(mutex);
+	if (file.is_null()) {
+		return;
+	}
+	_write_call(RECORD_CALL, p_method, p_args);
+}
+
+void RenderingServerCapture::record_create(const char *p_method, const Args &p_args, RID p_rid) {
+	MutexLock lock(mutex);
+	if (file.is_null()) {
+		return;
+	}
+	if (_write_call(RECORD_CREATE, p_method, p_args)) {
+		file->store_64(p_rid.get_id());
+	}
+}
+
+void RenderingServerCapture::frame_drawn(double p_frame_step) {
+	MutexLock lock(mutex);
+	if (file.is_null()) {
+		return;
+	}
+	file->store_8(RECORD_FRAME);
+	file->store_double(p_frame_step);
+	frame_count++;
+
+	if (frames_left > 0) {
+		frames_left--;
+		if (frames_left == 0) {
+			_stop();
+		}
+	}
+}
+
+bool RenderingServerCapture::_is_serializable(const Variant &p_value, bool p_allow_images) {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT: {
+			// Other objects would be written as instance IDs, which mean nothing on replay.
+			Object *object = p_value.get_validated_object();
+			return object == nullptr || (p_allow_images && Object::cast_to<Image>(object) != nullptr);
+		}
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			for (int i = 0; i < array.size(); i++) {
+				if (!_is_serializable(array[i], p_allow_images)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		case Variant::DICTIONARY: {
+			// Only arrays are walked by _store_value(), images must not be nested in dictionaries.
+			const Dictionary dict = p_value;
+			for (const KeyValue<Variant, Variant> &E : dict) {
+				if (!_is_serializable(E.key, false) || !_is_serializable(E.value, false)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		default: {
+			return true;
+		}
+	}
+}
+
+// Traces are written without objects, so replaying one cannot instantiate
+// arbitrary classes. Images are stored as their fields and rebuilt on replay.
+void RenderingServerCapture::_store_value(const Ref<FileAccess> &p_file, const Variant &p_value) {
+	if (p_value.get_type() == Variant::OBJECT) {
+		Ref<Image> image = p_value;
+		if (image.is_valid()) {
+			p_file->store_8(VALUE_IMAGE);
+			p_file->store_32(image->get_format());
+			p_file->store_32(image->get_width());
+			p_file->store_32(image->get_height());
+			p_file->store_8(image->has_mipmaps());
+			const Vector<uint8_t> data = image->get_data();
+			p_file->store_32(data.size());
+			p_file->store_buffer(data);
+			return;
+		}
+	} else if (p_value.get_type() == Variant::ARRAY) {
+		if (!_is_serializable(p_value, false)) {
+			// Holds images, write the elements one by one.
+			const Array array = p_value;
+			p_file->store_8(VALUE_ARRAY);
+			p_file->store_32(array.size());
+			for (int i = 0; i < array.size(); i++) {
+				_store_value(p_file, array[i]);
+			}
+			return;
+		}
+	}
+
+	p_file->store_8(VALUE_VARIANT);
+	p_file->store_var(p_value, false);
+}
+
+Variant RenderingServerCapture::_get_value(const Ref<FileAccess> &p_file) {
+	switch (p_file->get_8()) {
+		case VALUE_VARIANT: {
+			return p_file->get_var(false);
+		}
+		case VALUE_IMAGE: {
+			const Image::Format format = Image::Format(p_file->get_32());
+			const int width = p_file->get_32();
+			const int height = p_file->get_32();
+			const bool mipmaps = p_file->get_8();
+			Vector<uint8_t> data;
+			data.resize(p_file->get_32());
+			p_file->get_buffer(data.ptrw(), data.size());
+			ERR_FAIL_INDEX_V(format, Image::FORMAT_MAX, Variant());
+			ERR_FAIL_COND_V(data.size() != Image::get_image_data_size(width, height, format, mipmaps), Variant());
+			return Image::create_from_data(width, height, mipmaps, format, data);
+		}
+		case VALUE_ARRAY: {
+			Array array;
+			array.resize(p_file->get_32());
+			for (int i = 0; i < array.size(); i++) {
+				array[i] = _get_value(p_file);
+			}
+			return array;
+		}
+		default: {
+			ERR_FAIL_V_MSG(Variant(), "Invalid value in rendering capture file.");
+		}
+	}
+}
+
+bool RenderingServerCapture::_remap_rids(Variant &r_value, const HashMap<uint64_t, RID> &p_rids) {
+	switch (r_value.get_type()) {
+		case Variant::RID: {
+			RID rid = r_value;
+			if (rid.is_null()) {
+				return true;
+			}
+			const RID *mapped = p_rids.getptr(rid.get_id());
+			if (!mapped) {
+				// Created before the capture started, or by a call that was not captured.
+				return false;
+			}
+			r_value = *mapped;
+			return true;
+		}
+		case Variant::ARRAY: {
+			Array array = r_value;
+			for (int i = 0; i < array.size(); i++) {
+				Variant element = array[i];
+				if (!_remap_rids(element, p_rids)) {
+					return false;
+				}
+				array[i] = element;
+			}
+			return true;
+		}
+		case Variant::DICTIONARY: {
+			Dictionary dict = r_value;
+			Array keys = dict.keys();
+			for (int i = 0; i < keys.size(); i++) {
+				Variant value = dict[keys[i]];
+				if (!_remap_rids(value, p_rids)) {
+					return false;
+				}
+				dict[keys[i]] = value;
+			}
+			return true;
+		}
+		default: {
+			return true;
+		}
+	}
+}
+
+Error RenderingServerCapture::replay(const String &p_path, ReplayStats *r_stats) {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	ERR_FAIL_NULL_V(rs, ERR_UNCONFIGURED);
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Cannot open rendering capture file: \"%s\".", p_path));
+
+	uint8_t magic[4] = {};
+	f->get_buffer(magic, 4);
+	ERR_FAIL_COND_V_MSG(memcmp(magic, capture_magic, 4) != 0, ERR_FILE_UNRECOGNIZED, vformat("Not a rendering capture file: \"%s\".", p_path));
+	uint32_t version = f->get_32();
+	ERR_FAIL_COND_V_MSG(version != FORMAT_VERSION, ERR_FILE_UNRECOGNIZED, vformat("Unsupported rendering capture version %d in: \"%s\".", version, p_path));
+
+	const StringName class_name = SNAME("RenderingServer");
+	const StringName free_rid = SNAME("free_rid");
+
+	LocalVector<StringName> methods;
+	LocalVector<MethodBind *> method_binds;
+	HashMap<uint64_t, RID> rids;
+	HashMap<StringName, uint32_t> skipped_calls;
+	HashMap<StringName, uint32_t> unresolved_calls;
+	LocalVector<Variant> args;
+	LocalVector<const Variant *> arg_ptrs;
+
+	uint64_t call_count = 0;
+	uint64_t skip_count = 0;
+	uint64_t unresolved_count = 0;
+	uint64_t frame_count = 0;
+	uint64_t draw_usec_total = 0;
+	uint64_t draw_usec_min = UINT64_MAX;
+	uint64_t draw_usec_max = 0;
+
+	while (true) {
+		uint8_t type = f->get_8();
+		if (f->eof_reached()) {
+			break;
+		}
+
+		if (type == RECORD_FRAME) {
+			double frame_step = f->get_double();
+
+			// Apply the queued calls first, only the frame itself is measured.
+			rs->sync();
+			uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			rs->draw(false, frame_step);
+			rs->sync();
+			uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+			MessageQueue::get_singleton()->flush();
+
+			draw_usec_total += elapsed;
+			draw_usec_min = MIN(draw_usec_min, elapsed);
+			draw_usec_max = MAX(draw_usec_max, elapsed);
+			frame_count++;
+			continue;
+		}
+
+		ERR_FAIL_COND_V_MSG(type != RECORD_CALL && type != RECORD_CREATE, ERR_FILE_CORRUPT, vformat("Invalid record in rendering capture file: \"%s\".", p_path));
+
+		uint32_t id = f->get_32();
+		if (id == methods.size()) {
+			StringName name = f->get_pascal_string();
+			methods.push_back(name);
+			method_binds.push_back(ClassDB::get_method(class_name, name));
+		}
+		ERR_FAIL_UNSIGNED_INDEX_V(id, methods.size(), ERR_FILE_CORRUPT);
+
+		uint32_t arg_count = f->get_8();
+		args.resize(arg_count);
+		arg_ptrs.resize(arg_count);
+		uint64_t freed_id = 0;
+		bool resolved = true;
+		for (uint32_t i = 0; i < arg_count; i++) {
+			args[i] = _get_value(f);
+			if (i == 0 && methods[id] == free_rid) {
+				freed_id = RID(args[i]).get_id();
+			}
+			resolved = _remap_rids(args[i], rids) && resolved;
+			arg_ptrs[i] = &args[i];
+		}
+		uint64_t created_id = type == RECORD_CREATE ? f->get_64() : 0;
+		ERR_FAIL_COND_V_MSG(f->eof_reached(), ERR_FILE_CORRUPT, vformat("Truncated rendering capture file: \"%s\".", p_path));
+
+		MethodBind *method = method_binds[id];
+		Callable::CallError ce;
+		Variant ret;
+		if (method && resolved) {
+			ret = method->call(rs, arg_ptrs.ptr(), arg_count, ce);
+		}
+		if (!method || !resolved || ce.error != Callable::CallError::CALL_OK) {
+			// Missing RIDs are expected when the capture started mid-session, a call that
+			// does not match its bound method means the trace does not fit this build.
+			HashMap<StringName, uint32_t> &counts = resolved ? unresolved_calls : skipped_calls;
+			uint32_t *count = counts.getptr(methods[id]);
+			if (count) {
+				(*count)++;
+			} else {
+				counts.insert(methods[id], 1);
+			}
+			if (resolved) {
+				unresolved_count++;
+			} else {
+				skip_count++;
+			}
+			continue;
+		}
+
+		if (type == RECORD_CREATE) {
+			rids[created_id] = ret;
+		} else if (freed_id) {
+			rids.erase(freed_id);
+		}
+		call_count++;
+	}
+
+	for (const KeyValue<uint64_t, RID> &E : rids) {
+		rs->free_rid(E.value);
+	}
+	rs->sync();
+
+	if (r_stats) {
+		r_stats->frames = frame_count;
+		r_stats->calls = call_count;
+		r_stats->skipped = skip_count;
+		r_stats->unresolved = unresolved_count;
+	}
+
+	print_line(vformat("Rendering replay: %d frames, %d calls replayed, %d skipped.", frame_count, call_count, skip_count));
+	for (const KeyValue<StringName, uint32_t> &E : skipped_calls) {
+		print_verbose(vformat("Rendering replay: %d calls to %s() skipped.", E.value, E.key));
+	}
+	if (frame_count) {
+		print_line(vformat("Rendering replay: frame time avg %.3f ms, min %.3f ms, max %.3f ms.", draw_usec_total / 1000.0 / frame_count, draw_usec_min / 1000.0, draw_usec_max / 1000.0));
+	}
+	if (unresolved_count) {
+		for (const KeyValue<StringName, uint32_t> &E : unresolved_calls) {
+			ERR_PRINT(vformat("Rendering replay: %d calls to %s() could not be made, no bound RenderingServer method takes their arguments.", E.value, E.key));
+		}
+		return ERR_METHOD_NOT_FOUND;
+	}
+	return OK;
+}
+
+RenderingServerCapture::RenderingServerCapture() {
+	singleton = this;
+}
+
+RenderingServerCapture::~RenderingServerCapture() {
+	stop();
+	singleton = nullptr;
+}
@@ -0,0 +1,180 @@
+/**************************************************************************/
+/*  rendering_server_capture.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/file_access.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/variant/array.h"
+#include "core/variant/variant.h"
+#include "servers/rendering/rendering_server_types.h"
+
+class MethodBind;
+
+// Records the calls made into the RenderingServer to a trace file, so a
+// frame sequence can be replayed without the scene tree or scripts that
+// produced it (see --rendering-capture and --rendering-replay).
+class RenderingServerCapture {
+public:
+	// Arguments of a captured call, converted to Variants so they can be
+	// written with the regular Variant encoding. Images are the only objects
+	// kept, they are written field by field. Calls taking raw pointers,
+	// callbacks or other objects cannot be replayed and are flagged as invalid.
+	struct Args {
+		LocalVector<Variant> values;
+		bool valid = true;
+
+		Args() {}
+
+		template <typename... P>
+		Args(const P &...p_args) {
+			values.reserve(sizeof...(P));
+			(_push(p_args), ...);
+		}
+
+	private:
+		template <typename T>
+		void _push(const T &p_value) {
+			Variant value;
+			if (_to_variant(p_value, value)) {
+				values.push_back(value);
+			} else {
+				valid = false;
+			}
+		}
+
+		template <typename T>
+		static bool _to_variant(const T &p_value, Variant &r_variant) {
+			if constexpr (std::is_pointer_v<T>) {
+				return false;
+			} else if constexpr (std::is_constructible_v<Variant, const T &>) {
+				r_variant = Variant(p_value);
+				return _is_serializable(r_variant);
+			} else {
+				return _convert(p_value, r_variant);
+			}
+		}
+
+		template <typename T>
+		static bool _convert(const T &p_value, Variant &r_variant) {
+			return false;
+		}
+
+		template <typename T>
+		static bool _convert(const Vector<T> &p_value, Variant &r_variant) {
+			Array array;
+			array.resize(p_value.size());
+			for (int i = 0; i < p_value.size(); i++) {
+				Variant element;
+				if (!_to_variant(p_value[i], element)) {
+					return false;
+				}
+				array[i] = element;
+			}
+			r_variant = array;
+			return true;
+		}
+
+		static bool _convert(const RenderingServerTypes::SurfaceData &p_surface, Variant &r_variant);
+	};
+
+private:
+	enum RecordType : uint8_t {
+		RECORD_CALL,
+		RECORD_CREATE,
+		RECORD_FRAME,
+	};
+
+	enum ValueType : uint8_t {
+		VALUE_VARIANT,
+		VALUE_IMAGE,
+		VALUE_ARRAY,
+	};
+
+	static constexpr uint32_t FORMAT_VERSION = 2;
+
+	static RenderingServerCapture *singleton;
+	// Read by every thread calling into the server, cleared by whichever one ends the capture.
+	static SafeFlag recording;
+	static thread_local bool drawing;
+
+	Mutex mutex;
+	Ref<FileAccess> file;
+	HashMap<StringName, uint32_t> method_ids;
+	HashMap<StringName, MethodBind *> method_binds;
+	HashMap<StringName, uint32_t> dropped_calls;
+	HashMap<StringName, uint32_t> unbound_calls;
+	uint64_t call_count = 0;
+	uint64_t frame_count = 0;
+	int frames_left = 0;
+
+	bool _is_bound(const StringName &p_method, const Args &p_args);
+	bool _write_call(RecordType p_type, const char *p_method, const Args &p_args);
+	void _stop();
+
+	static bool _is_serializable(const Variant &p_value, bool p_allow_images = true);
+	static void _store_value(const Ref<FileAccess> &p_file, const Variant &p_value);
+	static Variant _get_value(const Ref<FileAccess> &p_file);
+	static bool _remap_rids(Variant &r_value, const HashMap<uint64_t, RID> &p_rids);
+
+public:
+	static RenderingServerCapture *get_singleton() { return singleton; }
+
+	_FORCE_INLINE_ static bool is_recording() { return recording.is_set() && !drawing; }
+
+	// Calls the renderer makes into the server while drawing a frame are a
+	// consequence of the captured stream, not part of it.
+	static void set_drawing(bool p_drawing) { drawing = p_drawing; }
+
+	Error start(const String &p_path, int p_frames = 0);
+	void stop();
+
+	void record_call(const char *p_method, const Args &p_args);
+	void record_create(const char *p_method, const Args &p_args, RID p_rid);
+	void frame_drawn(double p_frame_step);
+
+	struct ReplayStats {
+		uint64_t frames = 0;
+		uint64_t calls = 0;
+		// Calls on RIDs created before the capture started.
+		uint64_t skipped = 0;
+		// Calls the bound RenderingServer methods rejected.
+		uint64_t unresolved = 0;
+	};
+
+	// Returns ERR_METHOD_NOT_FOUND if any call could not be made, after replaying the rest.
+	static Error replay(const String &p_path, ReplayStats *r_stats = nullptr);
+
+	RenderingServerCapture();
+	~RenderingServerCapture();
+};
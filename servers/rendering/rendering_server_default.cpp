@@ -31,6 +31,7 @@
 #include "rendering_server_default.h"
 
 #include "core/object/callable_mp.h"
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "core/profiling/profiling.h"
 #include "servers/display/display_server.h"
@@ -74,6 +75,14 @@ void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_call
 }
 
 void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+	if (create_thread) {
+		// The rendering thread runs behind the main loop, so it recycles its frame arena itself.
+		// It runs as a WorkerThreadPool task, so this only releases what the thread allocated.
+		FrameArena::reset();
+	}
+
+	RenderingServerCapture::set_drawing(true);
+
 	GodotProfileZoneGroupedFirst(_profile_zone, "rasterizer->begin_frame");
 	RSG::rasterizer->begin_frame(frame_step);
 
@@ -126,6 +135,8 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 	RSG::canvas->update_visibility_notifiers();
 	RSG::scene->update_visibility_notifiers();
 
+	RenderingServerCapture::set_drawing(false);
+
 	GodotProfileZoneGrouped(_profile_zone, "post_draw_steps");
 	if (create_thread) {
 		callable_mp(this, &RenderingServerDefault::_run_post_draw_steps).call_deferred();
@@ -445,6 +456,9 @@ void RenderingServerDefault::draw(bool p_present, double frame_step) {
 	// Needs to be done before changes is reset to 0, to not force the editor to redraw.
 	RS::get_singleton()->emit_signal(SNAME("frame_pre_draw"));
 	changes = 0;
+	if (unlikely(RenderingServerCapture::is_recording())) {
+		RenderingServerCapture::get_singleton()->frame_drawn(frame_step);
+	}
 	if (create_thread) {
 		command_queue.push(this, &RenderingServerDefault::_draw, p_present, frame_step);
 	} else {
@@ -38,6 +38,7 @@
 #include "servers/rendering/renderer_compositor.h"
 #include "servers/rendering/renderer_viewport.h"
 #include "servers/rendering/rendering_method.h"
+#include "servers/rendering/rendering_server_capture.h"
 #include "servers/rendering/rendering_server.h"
 #include "servers/rendering/rendering_server_enums.h"
 #include "servers/rendering/rendering_server_globals.h"
@@ -114,6 +115,14 @@ public:
 #endif
 
 #define WRITE_ACTION redraw_request();
+#define CAPTURE_ACTION(m_type, m_args) \
+	if (unlikely(RenderingServerCapture::is_recording())) { \
+		RenderingServerCapture::get_singleton()->record_call(#m_type, RenderingServerCapture::Args m_args); \
+	}
+#define CAPTURE_CREATE_ACTION(m_type, m_args, m_ret) \
+	if (unlikely(RenderingServerCapture::is_recording())) { \
+		RenderingServerCapture::get_singleton()->record_create(#m_type, RenderingServerCapture::Args m_args, m_ret); \
+	}
 #define ASYNC_COND_PUSH (Thread::get_caller_id() != server_thread)
 #define ASYNC_COND_PUSH_AND_RET (Thread::get_caller_id() != server_thread)
 #define ASYNC_COND_PUSH_AND_SYNC (Thread::get_caller_id() != server_thread)
@@ -136,6 +145,7 @@ public:
 #define FUNCRIDTEX0(m_type) \
 	virtual RID m_type##_create() override { \
 		RID ret = RSG::texture_storage->texture_allocate(); \
+		CAPTURE_CREATE_ACTION(m_type##_create, (), ret) \
 		if (Thread::get_caller_id() == server_thread || RSG::rasterizer->can_create_resources_async()) { \
 			RSG::texture_storage->m_type##_initialize(ret); \
 		} else { \
@@ -147,6 +157,7 @@ public:
 #define FUNCRIDTEX1(m_type, m_type1) \
 	virtual RID m_type##_create(m_type1 p1) override { \
 		RID ret = RSG::texture_storage->texture_allocate(); \
+		CAPTURE_CREATE_ACTION(m_type##_create, (p1), ret) \
 		if (Thread::get_caller_id() == server_thread || RSG::rasterizer->can_create_resources_async()) { \
 			RSG::texture_storage->m_type##_initialize(ret, p1); \
 		} else { \
@@ -158,6 +169,7 @@ public:
 #define FUNCRIDTEX2(m_type, m_type1, m_type2) \
 	virtual RID m_type##_create(m_type1 p1, m_type2 p2) override { \
 		RID ret = RSG::texture_storage->texture_allocate(); \
+		CAPTURE_CREATE_ACTION(m_type##_create, (p1, p2), ret) \
 		if (Thread::get_caller_id() == server_thread || RSG::rasterizer->can_create_resources_async()) { \
 			RSG::texture_storage->m_type##_initialize(ret, p1, p2); \
 		} else { \
@@ -169,6 +181,7 @@ public:
 #define FUNCRIDTEX3(m_type, m_type1, m_type2, m_type3) \
 	virtual RID m_type##_create(m_type1 p1, m_type2 p2, m_type3 p3) override { \
 		RID ret = RSG::texture_storage->texture_allocate(); \
+		CAPTURE_CREATE_ACTION(m_type##_create, (p1, p2, p3), ret) \
 		if (Thread::get_caller_id() == server_thread || RSG::rasterizer->can_create_resources_async()) { \
 			RSG::texture_storage->m_type##_initialize(ret, p1, p2, p3); \
 		} else { \
@@ -180,6 +193,7 @@ public:
 #define FUNCRIDTEX4(m_type, m_type1, m_type2, m_type3, m_type4) \
 	virtual RID m_type##_create(m_type1 p1, m_type2 p2, m_type3 p3, m_type4 p4) override { \
 		RID ret = RSG::texture_storage->texture_allocate(); \
+		CAPTURE_CREATE_ACTION(m_type##_create, (p1, p2, p3, p4), ret) \
 		if (Thread::get_caller_id() == server_thread || RSG::rasterizer->can_create_resources_async()) { \
 			RSG::texture_storage->m_type##_initialize(ret, p1, p2, p3, p4); \
 		} else { \
@@ -191,6 +205,7 @@ public:
 #define FUNCRIDTEX5(m_type, m_type1, m_type2, m_type3, m_type4, m_type5) \
 	virtual RID m_type##_create(m_type1 p1, m_type2 p2, m_type3 p3, m_type4 p4, m_type5 p5) override { \
 		RID ret = RSG::texture_storage->texture_allocate(); \
+		CAPTURE_CREATE_ACTION(m_type##_create, (p1, p2, p3, p4, p5), ret) \
 		if (Thread::get_caller_id() == server_thread || RSG::rasterizer->can_create_resources_async()) { \
 			RSG::texture_storage->m_type##_initialize(ret, p1, p2, p3, p4, p5); \
 		} else { \
@@ -202,6 +217,7 @@ public:
 #define FUNCRIDTEX6(m_type, m_type1, m_type2, m_type3, m_type4, m_type5, m_type6) \
 	virtual RID m_type##_create(m_type1 p1, m_type2 p2, m_type3 p3, m_type4 p4, m_type5 p5, m_type6 p6) override { \
 		RID ret = RSG::texture_storage->texture_allocate(); \
+		CAPTURE_CREATE_ACTION(m_type##_create, (p1, p2, p3, p4, p5, p6), ret) \
 		if (Thread::get_caller_id() == server_thread || RSG::rasterizer->can_create_resources_async()) { \
 			RSG::texture_storage->m_type##_initialize(ret, p1, p2, p3, p4, p5, p6); \
 		} else { \
@@ -277,6 +293,7 @@ public:
 
 	virtual RID shader_create() override {
 		RID ret = RSG::material_storage->shader_allocate();
+		CAPTURE_CREATE_ACTION(shader_create, (), ret)
 		if (Thread::get_caller_id() == server_thread) {
 			RSG::material_storage->shader_initialize(ret, false);
 		} else {
@@ -287,6 +304,7 @@ public:
 
 	virtual RID shader_create_from_code(const String &p_code, const String &p_path_hint = String()) override {
 		RID shader = RSG::material_storage->shader_allocate();
+		CAPTURE_CREATE_ACTION(shader_create_from_code, (p_code, p_path_hint), shader)
 		bool using_server_thread = Thread::get_caller_id() == server_thread;
 		if (using_server_thread || RSG::rasterizer->can_create_resources_async()) {
 			if (using_server_thread) {
@@ -323,6 +341,7 @@ public:
 
 	virtual RID material_create_from_shader(RID p_next_pass, int p_render_priority, RID p_shader) override {
 		RID material = RSG::material_storage->material_allocate();
+		CAPTURE_CREATE_ACTION(material_create_from_shader, (p_next_pass, p_render_priority, p_shader), material)
 		bool using_server_thread = Thread::get_caller_id() == server_thread;
 		if (using_server_thread || RSG::rasterizer->can_create_resources_async()) {
 			if (using_server_thread) {
@@ -362,6 +381,7 @@ public:
 
 	virtual RID mesh_create_from_surfaces(const Vector<RenderingServerTypes::SurfaceData> &p_surfaces, int p_blend_shape_count = 0) override {
 		RID mesh = RSG::mesh_storage->mesh_allocate();
+		CAPTURE_CREATE_ACTION(mesh_create_from_surfaces, (p_surfaces, p_blend_shape_count), mesh)
 
 		bool using_server_thread = Thread::get_caller_id() == server_thread;
 		if (using_server_thread || RSG::rasterizer->can_create_resources_async()) {
@@ -934,6 +954,7 @@ public:
 	FUNC2(instance_set_layer_mask, RID, uint32_t)
 	FUNC3(instance_set_pivot_data, RID, float, bool)
 	FUNC2(instance_set_transform, RID, const Transform3D &)
+	FUNC2(instance_set_transforms, const Vector<RID> &, const Vector<Transform3D> &)
 	FUNC2(instance_attach_object_instance_id, RID, ObjectID)
 	FUNC3(instance_set_blend_shape_weight, RID, int, float)
 	FUNC3(instance_set_surface_override_material, RID, int, RID)
@@ -1009,6 +1030,7 @@ public:
 	FUNC2(canvas_item_set_update_when_visible, RID, bool)
 
 	FUNC2(canvas_item_set_transform, RID, const Transform2D &)
+	FUNC2(canvas_item_set_transforms, const Vector<RID> &, const Vector<Transform2D> &)
 	FUNC2(canvas_item_set_clip, RID, bool)
 	FUNC2(canvas_item_set_distance_field_mode, RID, bool)
 	FUNC3(canvas_item_set_custom_rect, RID, bool, const Rect2 &)
@@ -1162,6 +1184,8 @@ public:
 #undef server_name
 #undef ServerName
 #undef WRITE_ACTION
+#undef CAPTURE_ACTION
+#undef CAPTURE_CREATE_ACTION
 #undef SYNC_DEBUG
 #ifdef DEBUG_ENABLED
 #undef MAIN_THREAD_SYNC_WARN
@@ -1179,6 +1203,9 @@ public:
 	/* FREE */
 
 	virtual void free_rid(RID p_rid) override {
+		if (unlikely(RenderingServerCapture::is_recording())) {
+			RenderingServerCapture::get_singleton()->record_call("free_rid", RenderingServerCapture::Args(p_rid));
+		}
 		if (Thread::get_caller_id() == server_thread) {
 			command_queue.flush_if_pending();
 			_free(p_rid);
@@ -58,6 +58,7 @@
 #define FUNCRIDSPLIT(m_type) \
 	virtual RID m_type##_create() override { \
 		RID ret = server_name->m_type##_allocate(); \
+		CAPTURE_CREATE_ACTION(m_type##_create, (), ret) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type##_initialize, ret); \
 		} else { \
@@ -90,6 +91,7 @@
 #define FUNC0(m_type) \
 	virtual void m_type() override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, ()) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type); \
 		} else { \
@@ -111,6 +113,7 @@
 #define FUNC0S(m_type) \
 	virtual void m_type() override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, ()) \
 		if (ASYNC_COND_PUSH_AND_SYNC) { \
 			command_queue.push_and_sync(server_name, &ServerName::m_type); \
 			SYNC_DEBUG \
@@ -167,6 +170,7 @@
 #define FUNC1S(m_type, m_arg1) \
 	virtual void m_type(m_arg1 p1) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1)) \
 		if (ASYNC_COND_PUSH_AND_SYNC) { \
 			command_queue.push_and_sync(server_name, &ServerName::m_type, p1); \
 			SYNC_DEBUG \
@@ -192,6 +196,7 @@
 #define FUNC1(m_type, m_arg1) \
 	virtual void m_type(m_arg1 p1) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1); \
 		} else { \
@@ -242,6 +247,7 @@
 #define FUNC2S(m_type, m_arg1, m_arg2) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2)) \
 		if (ASYNC_COND_PUSH_AND_SYNC) { \
 			command_queue.push_and_sync(server_name, &ServerName::m_type, p1, p2); \
 			SYNC_DEBUG \
@@ -267,6 +273,7 @@
 #define FUNC2(m_type, m_arg1, m_arg2) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2); \
 		} else { \
@@ -317,6 +324,7 @@
 #define FUNC3S(m_type, m_arg1, m_arg2, m_arg3) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3)) \
 		if (ASYNC_COND_PUSH_AND_SYNC) { \
 			command_queue.push_and_sync(server_name, &ServerName::m_type, p1, p2, p3); \
 			SYNC_DEBUG \
@@ -342,6 +350,7 @@
 #define FUNC3(m_type, m_arg1, m_arg2, m_arg3) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3); \
 		} else { \
@@ -392,6 +401,7 @@
 #define FUNC4S(m_type, m_arg1, m_arg2, m_arg3, m_arg4) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4)) \
 		if (ASYNC_COND_PUSH_AND_SYNC) { \
 			command_queue.push_and_sync(server_name, &ServerName::m_type, p1, p2, p3, p4); \
 			SYNC_DEBUG \
@@ -417,6 +427,7 @@
 #define FUNC4(m_type, m_arg1, m_arg2, m_arg3, m_arg4) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4); \
 		} else { \
@@ -467,6 +478,7 @@
 #define FUNC5S(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5)) \
 		if (ASYNC_COND_PUSH_AND_SYNC) { \
 			command_queue.push_and_sync(server_name, &ServerName::m_type, p1, p2, p3, p4, p5); \
 			SYNC_DEBUG \
@@ -492,6 +504,7 @@
 #define FUNC5(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4, p5); \
 		} else { \
@@ -542,6 +555,7 @@
 #define FUNC6S(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6)) \
 		if (ASYNC_COND_PUSH_AND_SYNC) { \
 			command_queue.push_and_sync(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6); \
 			SYNC_DEBUG \
@@ -567,6 +581,7 @@
 #define FUNC6(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6); \
 		} else { \
@@ -617,6 +632,7 @@
 #define FUNC7S(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6, m_arg7) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6, m_arg7 p7) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6, p7)) \
 		if (ASYNC_COND_PUSH_AND_SYNC) { \
 			command_queue.push_and_sync(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6, p7); \
 			SYNC_DEBUG \
@@ -642,6 +658,7 @@
 #define FUNC7(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6, m_arg7) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6, m_arg7 p7) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6, p7)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6, p7); \
 		} else { \
@@ -692,6 +709,7 @@
 #define FUNC8S(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6, m_arg7, m_arg8) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6, m_arg7 p7, m_arg8 p8) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6, p7, p8)) \
 		if (ASYNC_COND_PUSH_AND_SYNC) { \
 			command_queue.push_and_sync(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6, p7, p8); \
 			SYNC_DEBUG \
@@ -717,6 +735,7 @@
 #define FUNC8(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6, m_arg7, m_arg8) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6, m_arg7 p7, m_arg8 p8) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6, p7, p8)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6, p7, p8); \
 		} else { \
@@ -738,6 +757,7 @@
 #define FUNC9(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6, m_arg7, m_arg8, m_arg9) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6, m_arg7 p7, m_arg8 p8, m_arg9 p9) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6, p7, p8, p9)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6, p7, p8, p9); \
 		} else { \
@@ -749,6 +769,7 @@
 #define FUNC10(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6, m_arg7, m_arg8, m_arg9, m_arg10) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6, m_arg7 p7, m_arg8 p8, m_arg9 p9, m_arg10 p10) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6, p7, p8, p9, p10)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10); \
 		} else { \
@@ -760,6 +781,7 @@
 #define FUNC11(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6, m_arg7, m_arg8, m_arg9, m_arg10, m_arg11) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6, m_arg7 p7, m_arg8 p8, m_arg9 p9, m_arg10 p10, m_arg11 p11) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11); \
 		} else { \
@@ -771,6 +793,7 @@
 #define FUNC12(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6, m_arg7, m_arg8, m_arg9, m_arg10, m_arg11, m_arg12) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6, m_arg7 p7, m_arg8 p8, m_arg9 p9, m_arg10 p10, m_arg11 p11, m_arg12 p12) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12); \
 		} else { \
@@ -782,6 +805,7 @@
 #define FUNC13(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6, m_arg7, m_arg8, m_arg9, m_arg10, m_arg11, m_arg12, m_arg13) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6, m_arg7 p7, m_arg8 p8, m_arg9 p9, m_arg10 p10, m_arg11 p11, m_arg12 p12, m_arg13 p13) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13); \
 		} else { \
@@ -793,6 +817,7 @@
 #define FUNC14(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6, m_arg7, m_arg8, m_arg9, m_arg10, m_arg11, m_arg12, m_arg13, m_arg14) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6, m_arg7 p7, m_arg8 p8, m_arg9 p9, m_arg10 p10, m_arg11 p11, m_arg12 p12, m_arg13 p13, m_arg14 p14) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14); \
 		} else { \
@@ -804,6 +829,7 @@
 #define FUNC15(m_type, m_arg1, m_arg2, m_arg3, m_arg4, m_arg5, m_arg6, m_arg7, m_arg8, m_arg9, m_arg10, m_arg11, m_arg12, m_arg13, m_arg14, m_arg15) \
 	virtual void m_type(m_arg1 p1, m_arg2 p2, m_arg3 p3, m_arg4 p4, m_arg5 p5, m_arg6 p6, m_arg7 p7, m_arg8 p8, m_arg9 p9, m_arg10 p10, m_arg11 p11, m_arg12 p12, m_arg13 p13, m_arg14 p14, m_arg15 p15) override { \
 		WRITE_ACTION \
+		CAPTURE_ACTION(m_type, (p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15)) \
 		if (ASYNC_COND_PUSH) { \
 			command_queue.push(server_name, &ServerName::m_type, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15); \
 		} else { \
@@ -34,6 +34,7 @@ TEST_FORCE_LINK(test_file_access)
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_memory.h"
 #include "tests/test_utils.h"
 
 namespace TestFileAccess {
@@ -297,4 +298,44 @@ TEST_CASE("[FileAccess] Cursor positioning") {
 	}
 }
 
+TEST_CASE("[FileAccess] Buffer views") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("testdata.csv"), FileAccess::READ);
+	REQUIRE(f.is_valid());
+
+	const uint64_t len = f->get_length();
+	const Vector<uint8_t> contents = f->get_buffer(len);
+	REQUIRE(contents.size() == (int64_t)len);
+
+	f->seek(4);
+	Span<uint8_t> view = f->get_buffer_view(len - 4);
+	if (view.is_empty()) {
+		// Not every platform can provide views, in which case the position must not move.
+		CHECK(f->get_position() == 4);
+	} else {
+		CHECK(view.size() == len - 4);
+		CHECK(memcmp(view.ptr(), contents.ptr() + 4, len - 4) == 0);
+		CHECK(f->get_position() == len);
+
+		// Reading normally after a view continues where it ended.
+		f->seek(2);
+		CHECK(f->get_buffer_view(1).size() == 1);
+		CHECK(f->get_8() == contents[3]);
+	}
+
+	f->seek(len - 1);
+	CHECK(f->get_buffer_view(2).is_empty());
+	CHECK(f->get_position() == len - 1);
+
+	Ref<FileAccessMemory> memory;
+	memory.instantiate();
+	REQUIRE(memory->open_custom(contents.ptr(), len) == OK);
+	memory->seek(1);
+	Span<uint8_t> memory_view = memory->get_buffer_view(3);
+	REQUIRE(memory_view.size() == 3);
+	CHECK(memory_view.ptr() == contents.ptr() + 1);
+	CHECK(memory->get_position() == 4);
+	CHECK(memory->get_buffer_view(len).is_empty());
+	CHECK(memory->get_position() == 4);
+}
+
 } // namespace TestFileAccess
@@ -32,6 +32,7 @@
 
 TEST_FORCE_LINK(test_resource)
 
+#include "core/config/project_settings.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
@@ -573,6 +574,41 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Saving and loading packed arrays in binary format") {
+	Ref<Resource> resource = memnew(Resource);
+	PackedVector3Array vertices;
+	PackedColorArray colors;
+	PackedInt32Array indices;
+	for (int i = 0; i < 37; i++) {
+		vertices.push_back(Vector3(i, i * 0.5, -i));
+		colors.push_back(Color(i / 37.0, 0.25, 0.5, 1.0));
+		indices.push_back(i * 3);
+	}
+	// Odd-sized byte array so the following blocks need padding to stay aligned.
+	resource->set_meta("bytes", PackedByteArray({ 1, 2, 3 }));
+	resource->set_meta("vertices", vertices);
+	resource->set_meta("colors", colors);
+	resource->set_meta("indices", indices);
+	resource->set_meta("transform", Transform3D(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3)));
+	resource->set_meta("aabb", AABB(Vector3(-1, -2, -3), Vector3(4, 5, 6)));
+	resource->set_meta("color", Color(0.1, 0.2, 0.3, 0.4));
+	resource->set_meta("empty", PackedFloat64Array());
+
+	const String save_path_binary = TestUtils::get_temp_path("resource_packed.res");
+	ResourceSaver::save(resource, save_path_binary);
+	const Ref<Resource> &loaded = ResourceLoader::load(save_path_binary, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+
+	CHECK(loaded->get_meta("bytes") == PackedByteArray({ 1, 2, 3 }));
+	CHECK(loaded->get_meta("vertices") == vertices);
+	CHECK(loaded->get_meta("colors") == colors);
+	CHECK(loaded->get_meta("indices") == indices);
+	CHECK(loaded->get_meta("transform") == Transform3D(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3)));
+	CHECK(loaded->get_meta("aabb") == AABB(Vector3(-1, -2, -3), Vector3(4, 5, 6)));
+	CHECK(loaded->get_meta("color") == Color(0.1, 0.2, 0.3, 0.4));
+	CHECK(PackedFloat64Array(loaded->get_meta("empty")).is_empty());
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -628,4 +664,46 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	resource_c->remove_meta("next");
 }
 
+TEST_CASE("[Resource] Threaded loading by dependency graph") {
+	const String leaf_path = TestUtils::get_temp_path("graph_leaf.tres");
+	const String middle_path = TestUtils::get_temp_path("graph_middle.tres");
+	const String root_path = TestUtils::get_temp_path("graph_root.tres");
+	{
+		Ref<Resource> leaf = memnew(Resource);
+		leaf->set_name("Leaf");
+		ResourceSaver::save(leaf, leaf_path, ResourceSaver::FLAG_CHANGE_PATH);
+		Ref<Resource> middle = memnew(Resource);
+		middle->set_name("Middle");
+		middle->set_meta("leaf", leaf);
+		ResourceSaver::save(middle, middle_path, ResourceSaver::FLAG_CHANGE_PATH);
+		Ref<Resource> root = memnew(Resource);
+		root->set_name("Root");
+		root->set_meta("middle", middle);
+		root->set_meta("leaf", leaf);
+		ResourceSaver::save(root, root_path);
+	}
+
+	ProjectSettings::get_singleton()->set_setting("threading/resource_loader/use_dependency_graph", true);
+	CHECK(ResourceLoader::load_threaded_request(root_path, "", true) == OK);
+	const Ref<Resource> root = ResourceLoader::load_threaded_get(root_path);
+	ProjectSettings::get_singleton()->set_setting("threading/resource_loader/use_dependency_graph", false);
+
+	REQUIRE(root.is_valid());
+	const Ref<Resource> middle = root->get_meta("middle");
+	REQUIRE(middle.is_valid());
+	CHECK(middle->get_name() == "Middle");
+	CHECK_MESSAGE(
+			root->get_meta("leaf") == middle->get_meta("leaf"),
+			"The shared dependency should be loaded only once.");
+
+	const ResourceLoader::DependencyGraphReport report = ResourceLoader::get_last_dependency_graph_report();
+	CHECK(report.path == root_path);
+	CHECK(report.resource_count == 3);
+	REQUIRE(report.critical_path.size() == 3);
+	CHECK(report.critical_path[0] == root_path);
+	CHECK(report.critical_path[1] == middle_path);
+	CHECK(report.critical_path[2] == leaf_path);
+	CHECK(report.critical_path_usec <= report.serial_usec);
+}
+
 } // namespace TestResource
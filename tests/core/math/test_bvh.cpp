@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*  test_bvh.cpp                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_bvh)
+
+#include "core/math/bvh.h"
+#include "core/math/random_pcg.h"
+
+namespace TestBVH {
+
+struct TestObject {
+	uint32_t id = 0;
+	uint32_t layer = 0;
+};
+
+class TestPairFunction {
+public:
+	static bool user_pair_check(const TestObject *p_a, const TestObject *p_b) {
+		return p_a->layer & p_b->layer;
+	}
+};
+
+class TestCullFunction {
+public:
+	static bool user_cull_check(const TestObject *p_a, const TestObject *p_b) {
+		return true;
+	}
+};
+
+typedef BVH_Manager<TestObject, 1, true, 32, TestPairFunction, TestCullFunction> TestBVH;
+
+struct PairEvent {
+	uint32_t a = 0;
+	uint32_t b = 0;
+	bool paired = false;
+
+	bool operator==(const PairEvent &p_other) const {
+		return a == p_other.a && b == p_other.b && paired == p_other.paired;
+	}
+};
+
+static void *pair_callback(void *p_self, uint32_t, TestObject *p_a, int, uint32_t, TestObject *p_b, int) {
+	((LocalVector<PairEvent> *)p_self)->push_back({ p_a->id, p_b->id, true });
+	return p_a;
+}
+
+static void unpair_callback(void *p_self, uint32_t, TestObject *p_a, int, uint32_t, TestObject *p_b, int, void *) {
+	((LocalVector<PairEvent> *)p_self)->push_back({ p_a->id, p_b->id, false });
+}
+
+static AABB random_aabb(RandomPCG &p_rng) {
+	Vector3 position = Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()) * 100.0;
+	Vector3 size = Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()) * 4.0 + Vector3(1, 1, 1);
+	return AABB(position, size);
+}
+
+TEST_CASE("[BVH] Parallel pairing sends the same callbacks as serial pairing") {
+	const uint32_t object_count = 1000;
+
+	LocalVector<TestObject> objects;
+	objects.resize(object_count);
+	for (uint32_t i = 0; i < object_count; i++) {
+		objects[i].id = i;
+		objects[i].layer = 1 << (i % 3);
+	}
+
+	LocalVector<PairEvent> serial_events;
+	LocalVector<PairEvent> parallel_events;
+
+	TestBVH serial_bvh;
+	TestBVH parallel_bvh;
+	serial_bvh.set_pair_callback(pair_callback, &serial_events);
+	serial_bvh.set_unpair_callback(unpair_callback, &serial_events);
+	parallel_bvh.set_pair_callback(pair_callback, &parallel_events);
+	parallel_bvh.set_unpair_callback(unpair_callback, &parallel_events);
+	parallel_bvh.params_set_parallel_pairing_threshold(1);
+
+	RandomPCG rng(1234);
+	LocalVector<BVHHandle> serial_handles;
+	LocalVector<BVHHandle> parallel_handles;
+	for (uint32_t i = 0; i < object_count; i++) {
+		AABB aabb = random_aabb(rng);
+		serial_handles.push_back(serial_bvh.create(&objects[i], true, 0, 1, aabb));
+		parallel_handles.push_back(parallel_bvh.create(&objects[i], true, 0, 1, aabb));
+	}
+
+	for (int step = 0; step < 10; step++) {
+		serial_bvh.update();
+		parallel_bvh.update();
+
+		// Move a different subset every step, so both pairs and unpairs happen.
+		for (uint32_t i = step % 2; i < object_count; i += 2) {
+			AABB aabb = random_aabb(rng);
+			serial_bvh.move(serial_handles[i], aabb);
+			parallel_bvh.move(parallel_handles[i], aabb);
+		}
+	}
+	serial_bvh.update();
+	parallel_bvh.update();
+
+	CHECK_MESSAGE(serial_events.size() > 0, "Random objects should have produced some pairs.");
+	CHECK_MESSAGE(serial_events.size() == parallel_events.size(), "Both modes should send as many callbacks.");
+
+	bool all_match = serial_events.size() == parallel_events.size();
+	for (uint32_t i = 0; all_match && i < serial_events.size(); i++) {
+		all_match = serial_events[i] == parallel_events[i];
+	}
+	CHECK_MESSAGE(all_match, "Both modes should send callbacks for the same pairs, in the same order.");
+
+	for (uint32_t i = 0; i < object_count; i++) {
+		serial_bvh.erase(serial_handles[i]);
+		parallel_bvh.erase(parallel_handles[i]);
+	}
+}
+
+} // namespace TestBVH
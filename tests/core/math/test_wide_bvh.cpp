@@ -0,0 +1,335 @@
+/**************************************************************************/
+/*  test_wide_bvh.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_wide_bvh)
+
+#include "core/math/random_pcg.h"
+#include "core/math/wide_bvh.h"
+#include "core/os/os.h"
+#include "core/templates/hash_set.h"
+
+namespace TestWideBVH {
+
+struct CollectResult {
+	HashSet<uintptr_t> found;
+
+	bool operator()(void *p_data) {
+		found.insert((uintptr_t)p_data);
+		return false;
+	}
+};
+
+struct CountResult {
+	uint32_t count = 0;
+
+	bool operator()(void *p_data) {
+		count++;
+		return false;
+	}
+};
+
+static AABB random_aabb(RandomPCG &p_rng, real_t p_extent) {
+	Vector3 position = Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()) * p_extent;
+	Vector3 size = Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()) * 4.0 + Vector3(0.1, 0.1, 0.1);
+	return AABB(position, size);
+}
+
+// A rotated box as a convex shape: six planes pointing out and its eight corners.
+static void make_convex(const Transform3D &p_xform, const Vector3 &p_half_extents, Vector<Plane> &r_planes, Vector<Vector3> &r_points) {
+	r_planes.clear();
+	r_points.clear();
+	for (int i = 0; i < 3; i++) {
+		Vector3 normal = p_xform.basis.get_column(i).normalized();
+		real_t extent = p_half_extents[i] * p_xform.basis.get_column(i).length();
+		r_planes.push_back(Plane(normal, p_xform.origin + normal * extent));
+		r_planes.push_back(Plane(-normal, p_xform.origin - normal * extent));
+	}
+	for (int i = 0; i < 8; i++) {
+		Vector3 corner((i & 1) ? p_half_extents.x : -p_half_extents.x, (i & 2) ? p_half_extents.y : -p_half_extents.y, (i & 4) ? p_half_extents.z : -p_half_extents.z);
+		r_points.push_back(p_xform.xform(corner));
+	}
+}
+
+static bool same_results(const HashSet<uintptr_t> &p_a, const HashSet<uintptr_t> &p_b) {
+	if (p_a.size() != p_b.size()) {
+		return false;
+	}
+	for (const uintptr_t &E : p_a) {
+		if (!p_b.has(E)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void check_queries(DynamicBVH &p_bvh, const WideBVH &p_wide, RandomPCG &p_rng) {
+	for (int i = 0; i < 50; i++) {
+		const AABB box = random_aabb(p_rng, 100.0).grow(p_rng.randf() * 20.0);
+		CollectResult binary;
+		CollectResult wide;
+		p_bvh.aabb_query(box, binary);
+		p_wide.aabb_query(box, wide);
+		CHECK_MESSAGE(same_results(binary.found, wide.found), "AABB queries should find the same leaves.");
+
+		Transform3D xform(Basis::from_euler(Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()) * Math::TAU), Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()) * 100.0);
+		Vector<Plane> planes;
+		Vector<Vector3> points;
+		make_convex(xform, Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()) * 30.0 + Vector3(1, 1, 1), planes, points);
+		binary.found.clear();
+		wide.found.clear();
+		p_bvh.convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), binary);
+		p_wide.convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), wide);
+		CHECK_MESSAGE(same_results(binary.found, wide.found), "Convex queries should find the same leaves.");
+	}
+}
+
+TEST_CASE("[WideBVH] Empty and single leaf trees") {
+	DynamicBVH bvh;
+	WideBVH wide;
+	CHECK_FALSE(wide.is_valid());
+
+	wide.build(bvh);
+	CHECK(wide.is_valid());
+	CHECK(wide.get_leaf_count() == 0);
+	CollectResult result;
+	wide.aabb_query(AABB(Vector3(-10, -10, -10), Vector3(20, 20, 20)), result);
+	CHECK(result.found.is_empty());
+
+	DynamicBVH::ID id = bvh.insert(AABB(Vector3(1, 1, 1), Vector3(1, 1, 1)), (void *)uintptr_t(1));
+	wide.invalidate();
+	CHECK_FALSE(wide.is_valid());
+	wide.build(bvh);
+	CHECK(wide.get_leaf_count() == 1);
+	CHECK(wide.get_node_count() == 1);
+	wide.aabb_query(AABB(Vector3(0, 0, 0), Vector3(1.5, 1.5, 1.5)), result);
+	CHECK(result.found.has(1));
+
+	result.found.clear();
+	const AABB moved(Vector3(5, 5, 5), Vector3(1, 1, 1));
+	bvh.update(id, moved);
+	wide.update(id, moved);
+	wide.aabb_query(AABB(Vector3(0, 0, 0), Vector3(1.5, 1.5, 1.5)), result);
+	CHECK(result.found.is_empty());
+
+	bvh.remove(id);
+}
+
+TEST_CASE("[WideBVH] Queries match DynamicBVH") {
+	const uint32_t leaf_count = 2000;
+
+	RandomPCG rng(1234);
+	DynamicBVH bvh;
+	LocalVector<DynamicBVH::ID> ids;
+	for (uint32_t i = 0; i < leaf_count; i++) {
+		ids.push_back(bvh.insert(random_aabb(rng, 100.0), (void *)uintptr_t(i + 1)));
+	}
+	bvh.optimize_incremental(4);
+
+	WideBVH wide;
+	wide.build(bvh);
+	CHECK(wide.get_leaf_count() == leaf_count);
+	CHECK_MESSAGE(wide.get_node_count() < leaf_count - 1, "The tree should have fewer nodes than the binary one.");
+	check_queries(bvh, wide, rng);
+
+	SUBCASE("After moving leaves") {
+		for (uint32_t i = 0; i < leaf_count; i += 3) {
+			const AABB box = random_aabb(rng, 100.0);
+			if (bvh.update(ids[i], box)) {
+				wide.update(ids[i], box);
+			}
+		}
+		CHECK(wide.is_valid());
+		check_queries(bvh, wide, rng);
+	}
+
+	SUBCASE("After rebuilding with removed leaves") {
+		for (uint32_t i = 0; i < leaf_count; i += 2) {
+			bvh.remove(ids[i]);
+			ids[i] = DynamicBVH::ID();
+		}
+		wide.invalidate();
+		wide.build(bvh);
+		CHECK(wide.get_leaf_count() == leaf_count / 2);
+		check_queries(bvh, wide, rng);
+	}
+
+	for (uint32_t i = 0; i < leaf_count; i++) {
+		if (ids[i].is_valid()) {
+			bvh.remove(ids[i]);
+		}
+	}
+}
+
+TEST_CASE("[WideBVH] Convex queries with open plane sets match DynamicBVH") {
+	const uint32_t leaf_count = 2000;
+
+	RandomPCG rng(4321);
+	DynamicBVH bvh;
+	LocalVector<DynamicBVH::ID> ids;
+	for (uint32_t i = 0; i < leaf_count; i++) {
+		ids.push_back(bvh.insert(random_aabb(rng, 100.0), (void *)uintptr_t(i + 1)));
+	}
+	bvh.optimize_incremental(4);
+
+	WideBVH wide;
+	wide.build(bvh);
+
+	uint32_t plane_only_found = 0;
+	for (int i = 0; i < 100; i++) {
+		Transform3D xform(Basis::from_euler(Vector3(rng.randf(), rng.randf(), rng.randf()) * Math::TAU), Vector3(rng.randf(), rng.randf(), rng.randf()) * 100.0);
+		Vector<Plane> planes;
+		Vector<Vector3> points;
+		make_convex(xform, Vector3(rng.randf(), rng.randf(), rng.randf()) * 30.0 + Vector3(1, 1, 1), planes, points);
+
+		// Fewer planes than the points span, so whole subtrees are inside the planes but outside the points.
+		const int plane_count = 1 + i % 5;
+		CollectResult binary;
+		CollectResult wide_result;
+		bvh.convex_query(planes.ptr(), plane_count, points.ptr(), points.size(), binary);
+		wide.convex_query(planes.ptr(), plane_count, points.ptr(), points.size(), wide_result);
+		CHECK_MESSAGE(same_results(binary.found, wide_result.found), "Convex queries with open plane sets should find the same leaves.");
+
+		// Without points, only the planes are tested.
+		binary.found.clear();
+		wide_result.found.clear();
+		bvh.convex_query(planes.ptr(), plane_count, nullptr, 0, binary);
+		wide.convex_query(planes.ptr(), plane_count, nullptr, 0, wide_result);
+		CHECK_MESSAGE(same_results(binary.found, wide_result.found), "Convex queries without points should find the same leaves.");
+		plane_only_found += wide_result.found.size();
+	}
+	CHECK_MESSAGE(plane_only_found > 0, "Queries without points should return the leaves inside the planes.");
+
+	for (uint32_t i = 0; i < leaf_count; i++) {
+		bvh.remove(ids[i]);
+	}
+}
+
+TEST_CASE("[WideBVH] Moving leaves degrades the tree until rebuilt") {
+	const uint32_t leaf_count = 1000;
+
+	RandomPCG rng(4321);
+	DynamicBVH bvh;
+	LocalVector<DynamicBVH::ID> ids;
+	LocalVector<AABB> boxes;
+	for (uint32_t i = 0; i < leaf_count; i++) {
+		boxes.push_back(random_aabb(rng, 100.0));
+		ids.push_back(bvh.insert(boxes[i], (void *)uintptr_t(i + 1)));
+	}
+	bvh.optimize_incremental(4);
+
+	WideBVH wide;
+	wide.build(bvh);
+	CHECK_FALSE(wide.is_degraded());
+
+	// Small moves keep the tree tight enough to be worth refitting.
+	for (uint32_t i = 0; i < leaf_count; i++) {
+		boxes[i].position += Vector3(0.01, 0.01, 0.01);
+		if (bvh.update(ids[i], boxes[i])) {
+			wide.update(ids[i], boxes[i]);
+		}
+	}
+	CHECK_FALSE_MESSAGE(wide.is_degraded(), "Small moves should not require a rebuild.");
+
+	// Leaves scattering across the world stretch the internal nodes built around their old positions.
+	for (int pass = 0; pass < 10 && !wide.is_degraded(); pass++) {
+		for (uint32_t i = 0; i < leaf_count; i++) {
+			boxes[i] = random_aabb(rng, 100.0);
+			if (bvh.update(ids[i], boxes[i])) {
+				wide.update(ids[i], boxes[i]);
+			}
+		}
+		CHECK(wide.is_valid());
+		check_queries(bvh, wide, rng);
+	}
+	CHECK_MESSAGE(wide.is_degraded(), "Scattered leaves should degrade the refitted tree.");
+
+	wide.build(bvh);
+	CHECK_FALSE_MESSAGE(wide.is_degraded(), "Rebuilding should restore the tree.");
+	CHECK(wide.get_leaf_count() == leaf_count);
+	check_queries(bvh, wide, rng);
+
+	for (uint32_t i = 0; i < leaf_count; i++) {
+		bvh.remove(ids[i]);
+	}
+}
+
+TEST_CASE_BENCHMARK("[WideBVH][Benchmark] Convex queries against DynamicBVH") {
+	const uint32_t leaf_count = 1000000;
+	const int query_count = 200;
+
+	RandomPCG rng(4321);
+	DynamicBVH bvh;
+	LocalVector<DynamicBVH::ID> ids;
+	ids.reserve(leaf_count);
+	for (uint32_t i = 0; i < leaf_count; i++) {
+		ids.push_back(bvh.insert(random_aabb(rng, 2000.0), (void *)uintptr_t(i + 1)));
+	}
+
+	WideBVH wide;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	wide.build(bvh);
+	const uint64_t build_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	LocalVector<Vector<Plane>> planes;
+	LocalVector<Vector<Vector3>> points;
+	planes.resize(query_count);
+	points.resize(query_count);
+	for (int i = 0; i < query_count; i++) {
+		Transform3D xform(Basis::from_euler(Vector3(rng.randf(), rng.randf(), rng.randf()) * Math::TAU), Vector3(rng.randf(), rng.randf(), rng.randf()) * 2000.0);
+		make_convex(xform, Vector3(100, 100, 300), planes[i], points[i]);
+	}
+
+	CountResult binary;
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < query_count; i++) {
+		bvh.convex_query(planes[i].ptr(), planes[i].size(), points[i].ptr(), points[i].size(), binary);
+	}
+	const uint64_t binary_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	CountResult wide_result;
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < query_count; i++) {
+		wide.convex_query(planes[i].ptr(), planes[i].size(), points[i].ptr(), points[i].size(), wide_result);
+	}
+	const uint64_t wide_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	String result = vformat("%d leaves, %d queries: DynamicBVH %.2f ms, WideBVH %.2f ms (build %.2f ms).",
+			leaf_count, query_count, binary_usec / 1000.0, wide_usec / 1000.0, build_usec / 1000.0);
+	MESSAGE(result.utf8().get_data());
+	CHECK(binary.count == wide_result.count);
+
+	for (uint32_t i = 0; i < leaf_count; i++) {
+		bvh.remove(ids[i]);
+	}
+}
+
+} // namespace TestWideBVH
@@ -36,6 +36,8 @@ TEST_FORCE_LINK(test_object)
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "tests/signal_watcher.h"
 
 namespace TestObject {
@@ -261,6 +263,42 @@ TEST_CASE("[Object] Built-in property getter") {
 			"The returned value should equal the one which was set with built-in setter.");
 }
 
+TEST_CASE("[Object] Batch property setter") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	_TestDerivedObject first;
+	_TestDerivedObject second;
+	Object plain;
+
+	Array objects = { &first, &second };
+
+	SUBCASE("Packed array values") {
+		Object::set_batch(objects, "property", PackedInt64Array({ 10, 20 }));
+		CHECK(first.get_property() == 10);
+		CHECK(second.get_property() == 20);
+	}
+
+	SUBCASE("Array values") {
+		Object::set_batch(objects, "property", Array({ 30, 40.0 }));
+		CHECK(first.get_property() == 30);
+		CHECK(second.get_property() == 40);
+	}
+
+	SUBCASE("Objects without the property") {
+		objects.push_back(&plain);
+		Object::set_batch(objects, "metadata/value", PackedInt32Array({ 1, 2, 3 }));
+		CHECK(first.get_meta("value") == Variant(1));
+		CHECK(plain.get_meta("value") == Variant(3));
+	}
+
+	SUBCASE("Mismatched sizes") {
+		first.set_property(0);
+		ERR_PRINT_OFF;
+		Object::set_batch(objects, "property", PackedInt64Array({ 10 }));
+		ERR_PRINT_ON;
+		CHECK(first.get_property() == 0);
+	}
+}
+
 TEST_CASE("[Object] Script property setter") {
 	Object object;
 	Variant script;
@@ -691,4 +729,75 @@ TEST_CASE("[Object] RequiredResult") {
 	CHECK_EQ(ref, var);
 }
 
+TEST_CASE("[ObjectDB] Instance IDs are invalidated on free") {
+	Object *object = memnew(Object);
+	const ObjectID id = object->get_instance_id();
+	CHECK(ObjectDB::get_instance(id) == object);
+	memdelete(object);
+	CHECK(ObjectDB::get_instance(id) == nullptr);
+
+	// The slot is reused, but the old ID must not resolve to the new object.
+	Object *other = memnew(Object);
+	CHECK(other->get_instance_id() != id);
+	CHECK(ObjectDB::get_instance(id) == nullptr);
+	CHECK(ObjectDB::get_instance(other->get_instance_id()) == other);
+	memdelete(other);
+
+	CHECK(ObjectDB::get_instance(ObjectID()) == nullptr);
+
+	Ref<RefCounted> ref;
+	ref.instantiate();
+	CHECK(ref->get_instance_id().is_ref_counted());
+	CHECK(ObjectDB::get_instance(ref->get_instance_id()) == ref.ptr());
+}
+
+struct ThreadedObjectDB {
+	static constexpr int OBJECT_COUNT = 2000;
+
+	SafeNumeric<uint32_t> failures;
+
+	static void churn(void *p_userdata) {
+		ThreadedObjectDB *state = (ThreadedObjectDB *)p_userdata;
+		LocalVector<Object *> objects;
+		LocalVector<ObjectID> ids;
+		for (int round = 0; round < 5; round++) {
+			for (int i = 0; i < OBJECT_COUNT; i++) {
+				objects.push_back(memnew(Object));
+				ids.push_back(objects[i]->get_instance_id());
+			}
+			for (int i = 0; i < OBJECT_COUNT; i++) {
+				if (ObjectDB::get_instance(ids[i]) != objects[i]) {
+					state->failures.increment();
+				}
+			}
+			// Free from the end so slots are recycled in a different order.
+			for (int i = OBJECT_COUNT - 1; i >= 0; i--) {
+				memdelete(objects[i]);
+				if (ObjectDB::get_instance(ids[i]) != nullptr) {
+					state->failures.increment();
+				}
+			}
+			objects.clear();
+			ids.clear();
+		}
+	}
+};
+
+TEST_CASE("[ObjectDB] Instances created and freed from many threads") {
+	const int object_count = ObjectDB::get_object_count();
+
+	ThreadedObjectDB state;
+	TightLocalVector<Thread> threads;
+	threads.resize(8);
+	for (Thread &thread : threads) {
+		thread.start(&ThreadedObjectDB::churn, &state);
+	}
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	CHECK(state.failures.get() == 0);
+	CHECK(ObjectDB::get_object_count() == object_count);
+}
+
 } // namespace TestObject
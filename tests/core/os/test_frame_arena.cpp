@@ -0,0 +1,190 @@
+/**************************************************************************/
+/*  test_frame_arena.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_frame_arena)
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/frame_arena.h"
+
+namespace TestFrameArena {
+
+TEST_CASE("[FrameArena] Allocations are aligned and counted") {
+	FrameArena::begin_frame();
+	CHECK(FrameArena::get_thread_usage() == 0);
+
+	uint8_t *a = (uint8_t *)FrameArena::alloc(3);
+	uint8_t *b = (uint8_t *)FrameArena::alloc(100);
+	CHECK(a != nullptr);
+	CHECK(b != nullptr);
+	CHECK((uintptr_t)a % Memory::MAX_ALIGN == 0);
+	CHECK((uintptr_t)b % Memory::MAX_ALIGN == 0);
+	CHECK(b >= a + 3);
+	CHECK(FrameArena::get_thread_usage() >= 103);
+
+	FrameArena::begin_frame();
+	CHECK(FrameArena::get_thread_usage() == 0);
+	CHECK(FrameArena::get_high_water_mark() >= 103);
+}
+
+TEST_CASE("[FrameArena] Last allocation grows in place") {
+	FrameArena::begin_frame();
+
+	uint32_t *data = (uint32_t *)FrameArena::alloc(4 * sizeof(uint32_t));
+	for (uint32_t i = 0; i < 4; i++) {
+		data[i] = i;
+	}
+	uint32_t *grown = (uint32_t *)FrameArena::realloc(data, 4 * sizeof(uint32_t), 64 * sizeof(uint32_t));
+	CHECK(grown == data);
+
+	// Not the last allocation anymore, so it must be copied.
+	FrameArena::alloc(16);
+	uint32_t *moved = (uint32_t *)FrameArena::realloc(grown, 64 * sizeof(uint32_t), 128 * sizeof(uint32_t));
+	CHECK(moved != grown);
+	for (uint32_t i = 0; i < 4; i++) {
+		CHECK(moved[i] == i);
+	}
+}
+
+TEST_CASE("[FrameArena] Allocations larger than a block") {
+	FrameArena::begin_frame();
+
+	const size_t size = FrameArena::DEFAULT_BLOCK_SIZE * 3;
+	uint8_t *small = (uint8_t *)FrameArena::alloc(32);
+	uint8_t *large = (uint8_t *)FrameArena::alloc(size);
+	memset(small, 1, 32);
+	memset(large, 2, size);
+	CHECK(small[31] == 1);
+	CHECK(large[0] == 2);
+	CHECK(large[size - 1] == 2);
+	CHECK(FrameArena::get_reserved_bytes() >= size);
+
+	FrameArena::begin_frame();
+	CHECK(FrameArena::get_high_water_mark() >= size);
+
+	// The recycled arena fits the previous frame in a single block.
+	uint8_t *first = (uint8_t *)FrameArena::alloc(32);
+	uint8_t *second = (uint8_t *)FrameArena::alloc(size);
+	CHECK(second == first + Memory::get_aligned_address(32, Memory::MAX_ALIGN));
+}
+
+TEST_CASE("[FrameArena] FrameLocalVector") {
+	FrameArena::begin_frame();
+
+	FrameLocalVector<int> vector;
+	for (int i = 0; i < 1000; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.size() == 1000);
+	for (int i = 0; i < 1000; i++) {
+		CHECK(vector[i] == i);
+	}
+	// Growing the vector alone keeps reusing the same allocation.
+	CHECK(FrameArena::get_thread_usage() < 1000 * sizeof(int) * 2);
+
+	vector.reset();
+	CHECK(vector.is_empty());
+}
+
+TEST_CASE("[FrameArena] Scopes release only their own allocations") {
+	FrameArena::begin_frame();
+
+	uint8_t *outer = (uint8_t *)FrameArena::alloc(64);
+	memset(outer, 1, 64);
+	const uint64_t outer_usage = FrameArena::get_thread_usage();
+
+	{
+		FrameArena::Scope scope;
+		FrameArena::alloc(128);
+		{
+			FrameArena::Scope nested;
+			FrameArena::alloc(FrameArena::DEFAULT_BLOCK_SIZE * 2);
+		}
+		CHECK(FrameArena::get_thread_usage() == outer_usage + 128);
+
+		// Inside a scope, resetting stops at the scope boundary.
+		FrameArena::reset();
+		CHECK(FrameArena::get_thread_usage() == outer_usage);
+		FrameArena::alloc(32);
+	}
+	CHECK(FrameArena::get_thread_usage() == outer_usage);
+	CHECK(outer[0] == 1);
+	CHECK(outer[63] == 1);
+
+	// The allocation from before the scope can't be grown in place over the scope's memory.
+	{
+		FrameArena::Scope scope;
+		uint8_t *grown = (uint8_t *)FrameArena::realloc(outer, 64, 256);
+		CHECK(grown != outer);
+	}
+	CHECK(FrameArena::get_thread_usage() == outer_usage);
+
+	FrameArena::reset();
+	CHECK(FrameArena::get_thread_usage() == 0);
+}
+
+TEST_CASE("[FrameArena] Worker tasks do not share the submitter's arena") {
+	FrameArena::begin_frame();
+	FrameArena::alloc(64);
+	const uint64_t usage = FrameArena::get_thread_usage();
+
+	struct Data {
+		SafeNumeric<uint32_t> valid;
+
+		void work(uint32_t p_index, void *p_userdata) {
+			// Every task starts from the boundary of its own scope.
+			const uint64_t start = FrameArena::get_thread_usage();
+			uint32_t *values = (uint32_t *)FrameArena::alloc(256 * sizeof(uint32_t));
+			for (uint32_t i = 0; i < 256; i++) {
+				values[i] = p_index;
+			}
+			// Crossing a main loop frame must not recycle memory a task is using.
+			FrameArena::begin_frame();
+			bool ok = FrameArena::get_thread_usage() >= start + 256 * sizeof(uint32_t);
+			for (uint32_t i = 0; i < 256; i++) {
+				ok = ok && values[i] == p_index;
+			}
+			if (ok) {
+				valid.increment();
+			}
+		}
+	} data;
+
+	ERR_PRINT_OFF;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(&data, &Data::work, nullptr, 64, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	ERR_PRINT_ON;
+
+	CHECK(data.valid.get() == 64);
+	CHECK(FrameArena::get_thread_usage() == usage);
+}
+
+} // namespace TestFrameArena
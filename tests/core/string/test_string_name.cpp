@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*  test_string_name.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_string_name)
+
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const StringName a = "test_string_name_interning";
+	const StringName b = String("test_string_name_interning");
+	const StringName c = StringName("test_string_name_interning_other");
+
+	CHECK(a == b);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(a != c);
+	CHECK(a == "test_string_name_interning");
+	CHECK(StringName().is_empty());
+	CHECK(StringName("").is_empty());
+}
+
+TEST_CASE("[StringName] Names can be recreated after being released") {
+	for (int i = 0; i < 1000; i++) {
+		// Enough unique names to trigger sweeping of released ones.
+		const String name = "test_string_name_released_" + itos(i % 10);
+		StringName first = name;
+		CHECK(String(first) == name);
+		first = StringName();
+
+		StringName second = name;
+		CHECK(String(second) == name);
+		StringName third = second;
+		CHECK(third.data_unique_pointer() == second.data_unique_pointer());
+	}
+}
+
+struct ThreadedInterning {
+	static constexpr int NAME_COUNT = 2000;
+	static constexpr int ROUNDS = 20;
+
+	LocalVector<LocalVector<StringName>> names;
+
+	static void intern(void *p_userdata) {
+		LocalVector<StringName> &names = *(LocalVector<StringName> *)p_userdata;
+		for (int round = 0; round < ROUNDS; round++) {
+			names.clear();
+			for (int i = 0; i < NAME_COUNT; i++) {
+				names.push_back(StringName("test_string_name_threaded_" + itos(i)));
+				// Names released right away keep the shards busy with sweeping.
+				StringName transient = "test_string_name_transient_" + itos(i * ROUNDS + round);
+			}
+		}
+	}
+};
+
+TEST_CASE("[StringName] Concurrent interning yields the same names") {
+	const int thread_count = MAX(4, OS::get_singleton()->get_processor_count());
+
+	ThreadedInterning state;
+	state.names.resize(thread_count);
+	TightLocalVector<Thread> threads;
+	threads.resize(thread_count);
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].start(&ThreadedInterning::intern, &state.names[i]);
+	}
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	for (int i = 0; i < ThreadedInterning::NAME_COUNT; i++) {
+		const StringName &expected = state.names[0][i];
+		CHECK(String(expected) == "test_string_name_threaded_" + itos(i));
+		for (int j = 1; j < thread_count; j++) {
+			CHECK(state.names[j][i].data_unique_pointer() == expected.data_unique_pointer());
+		}
+	}
+}
+
+struct ThreadedBenchmark {
+	static constexpr int ITERATIONS = 200000;
+
+	LocalVector<String> strings;
+
+	static void intern(void *p_userdata) {
+		const LocalVector<String> &strings = *(const LocalVector<String> *)p_userdata;
+		for (int i = 0; i < ITERATIONS; i++) {
+			StringName name = strings[i % strings.size()];
+		}
+	}
+};
+
+TEST_CASE_BENCHMARK("[StringName][Benchmark] Concurrent interning from String") {
+	ThreadedBenchmark state;
+	for (int i = 0; i < 256; i++) {
+		state.strings.push_back("test_string_name_benchmark_" + itos(i));
+	}
+	// Keep the names alive, as in the common case of looking up existing properties and methods.
+	LocalVector<StringName> keep_alive;
+	for (const String &string : state.strings) {
+		keep_alive.push_back(string);
+	}
+
+	for (int thread_count = 1; thread_count <= OS::get_singleton()->get_processor_count(); thread_count *= 2) {
+		TightLocalVector<Thread> threads;
+		threads.resize(thread_count);
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (Thread &thread : threads) {
+			thread.start(&ThreadedBenchmark::intern, &state.strings);
+		}
+		for (Thread &thread : threads) {
+			thread.wait_to_finish();
+		}
+		const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		String result = vformat("%d threads: %.1f ns per StringName construction.", thread_count, usec * 1000.0 / ((double)ThreadedBenchmark::ITERATIONS * thread_count));
+		MESSAGE(result.utf8().get_data());
+	}
+}
+
+} // namespace TestStringName
@@ -0,0 +1,194 @@
+/**************************************************************************/
+/*  test_ordered_a_hash_map.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_ordered_a_hash_map)
+
+#include "core/templates/ordered_a_hash_map.h"
+
+namespace TestOrderedAHashMap {
+
+template <typename K, typename V>
+static Vector<K> keys_of(const OrderedAHashMap<K, V> &p_map) {
+	Vector<K> keys;
+	for (const KeyValue<K, V> &E : p_map) {
+		keys.push_back(E.key);
+	}
+	return keys;
+}
+
+TEST_CASE("[OrderedAHashMap] Insert, overwrite and erase") {
+	OrderedAHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+	map[7] = 14;
+
+	CHECK(map.size() == 2);
+	CHECK(map[42] == 1234);
+	CHECK(map.has(7));
+	CHECK(map.find(7)->value == 14);
+
+	CHECK(map.erase(42));
+	CHECK_FALSE(map.erase(42));
+	CHECK(map.size() == 1);
+	CHECK_FALSE(map.has(42));
+	CHECK(map.getptr(42) == nullptr);
+	CHECK(*map.getptr(7) == 14);
+}
+
+TEST_CASE("[OrderedAHashMap] Insertion order is kept across erase") {
+	OrderedAHashMap<int, int> map;
+	for (int i = 0; i < 10; i++) {
+		map.insert(i, i * 10);
+	}
+	map.erase(0);
+	map.erase(4);
+	map.erase(9);
+	map.insert(4, 40);
+
+	const Vector<int> expected = { 1, 2, 3, 5, 6, 7, 8, 4 };
+	CHECK(keys_of(map) == expected);
+	CHECK(map.get_by_index(0).key == 1);
+	CHECK(map.get_by_index(3).key == 5);
+	CHECK(map.get_by_index(7).key == 4);
+
+	// Iterating from a found element continues in insertion order.
+	OrderedAHashMap<int, int>::ConstIterator E = map.find(3);
+	++E;
+	CHECK(E->key == 5);
+}
+
+TEST_CASE("[OrderedAHashMap] Compaction and growth") {
+	OrderedAHashMap<int, int> map;
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, i);
+	}
+	// Erase most elements, which compacts the element array along the way.
+	for (int i = 0; i < 1000; i++) {
+		if (i % 10 != 0) {
+			CHECK(map.erase(i));
+		}
+	}
+	CHECK(map.size() == 100);
+	for (int i = 1000; i < 3000; i++) {
+		map.insert(i, i);
+	}
+
+	CHECK(map.size() == 2100);
+	int previous = -1;
+	uint32_t count = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key > previous);
+		CHECK(E.value == E.key);
+		CHECK(map.has(E.key));
+		previous = E.key;
+		count++;
+	}
+	CHECK(count == 2100);
+	CHECK_FALSE(map.has(5));
+	CHECK(map.has(990));
+}
+
+TEST_CASE("[OrderedAHashMap] Copy and clear") {
+	OrderedAHashMap<String, int> map;
+	map.insert("a", 1);
+	map.insert("b", 2);
+	map.insert("c", 3);
+	map.erase("b");
+
+	OrderedAHashMap<String, int> copy(map);
+	CHECK(copy.size() == 2);
+	CHECK(copy["c"] == 3);
+	CHECK(keys_of(copy) == Vector<String>{ "a", "c" });
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(map.begin() == map.end());
+	map.insert("d", 4);
+	CHECK(keys_of(map) == Vector<String>{ "d" });
+	CHECK(copy.size() == 2);
+}
+
+struct ReverseKeyOrder {
+	bool operator()(const KeyValue<int, int> &p_a, const KeyValue<int, int> &p_b) const {
+		return p_a.key > p_b.key;
+	}
+};
+
+struct ValueOrder {
+	bool operator()(const KeyValue<int, int> &p_a, const KeyValue<int, int> &p_b) const {
+		return p_a.value < p_b.value;
+	}
+};
+
+TEST_CASE("[OrderedAHashMap] Value pointers stay valid until erased") {
+	OrderedAHashMap<int, int> map;
+	map.insert(0, 100);
+	int *first = map.getptr(0);
+	for (int i = 1; i < 1000; i++) {
+		map.insert(i, i);
+	}
+	for (int i = 1; i < 1000; i += 2) {
+		map.erase(i);
+	}
+	for (int i = 1000; i < 3000; i++) {
+		map.insert(i, i);
+	}
+	map.sort_custom<ValueOrder>();
+
+	CHECK(map.getptr(0) == first);
+	CHECK(*first == 100);
+
+	// Assigning through a pointer while inserting the key it is read from.
+	map[5000] = map[0];
+	CHECK(map[5000] == 100);
+}
+
+TEST_CASE("[OrderedAHashMap] Sort") {
+	OrderedAHashMap<int, int> map;
+	for (int i = 0; i < 20; i++) {
+		map.insert(i, i % 3);
+	}
+	map.erase(5);
+
+	map.sort_custom<ReverseKeyOrder>();
+	CHECK(map.get_by_index(0).key == 19);
+	CHECK(map.get_by_index(18).key == 0);
+	CHECK(map.has(7));
+	CHECK_FALSE(map.has(5));
+
+	// Equal elements keep their current order.
+	map.sort_custom<ValueOrder>();
+	const Vector<int> expected = { 18, 15, 12, 9, 6, 3, 0, 19, 16, 13, 10, 7, 4, 1, 17, 14, 11, 8, 2 };
+	CHECK(keys_of(map) == expected);
+}
+
+} // namespace TestOrderedAHashMap
@@ -0,0 +1,117 @@
+/**************************************************************************/
+/*  test_thread_cached_allocator.cpp                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_thread_cached_allocator)
+
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/thread_cached_allocator.h"
+
+namespace TestThreadCachedAllocator {
+
+struct Element {
+	String name;
+	int value = 42;
+};
+
+static ThreadCachedAllocator<Element> allocator;
+static thread_local ThreadCachedAllocator<Element>::Cache allocator_cache;
+
+TEST_CASE("[ThreadCachedAllocator] Elements are constructed and destroyed") {
+	LocalVector<Element *> elements;
+	// More than a thread keeps, so whole batches go back to the shared pool.
+	for (uint32_t i = 0; i < ThreadCachedAllocator<Element>::CACHE_SIZE * 3; i++) {
+		Element *element = allocator.alloc(allocator_cache);
+		CHECK(element->value == 42);
+		CHECK(element->name.is_empty());
+		element->name = itos(i);
+		element->value = i;
+		elements.push_back(element);
+	}
+	for (uint32_t i = 0; i < elements.size(); i++) {
+		CHECK(elements[i]->name == itos(i));
+		CHECK(elements[i]->value == int(i));
+		allocator.free(allocator_cache, elements[i]);
+	}
+
+	// Reused memory starts over from a new element.
+	Element *element = allocator.alloc(allocator_cache, Element{ "reused", 7 });
+	CHECK(element->name == "reused");
+	CHECK(element->value == 7);
+	allocator.free(allocator_cache, element);
+}
+
+struct ThreadedElements {
+	static constexpr int ELEMENT_COUNT = 1000;
+
+	int index = 0;
+	LocalVector<Element *> allocated;
+	LocalVector<Element *> *to_free = nullptr;
+
+	static void run(void *p_userdata) {
+		ThreadedElements &state = *(ThreadedElements *)p_userdata;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			Element *element = allocator.alloc(allocator_cache);
+			element->name = itos(state.index) + "_" + itos(i);
+			state.allocated.push_back(element);
+		}
+		// Frees what another thread allocated earlier.
+		if (state.to_free) {
+			for (Element *element : *state.to_free) {
+				allocator.free(allocator_cache, element);
+			}
+		}
+	}
+};
+
+TEST_CASE("[ThreadCachedAllocator] Elements can be freed by other threads") {
+	ThreadedElements first;
+	Thread thread;
+	thread.start(&ThreadedElements::run, &first);
+	thread.wait_to_finish();
+
+	ThreadedElements second;
+	second.index = 1;
+	second.to_free = &first.allocated;
+	thread.start(&ThreadedElements::run, &second);
+	thread.wait_to_finish();
+
+	for (int i = 0; i < ThreadedElements::ELEMENT_COUNT; i++) {
+		CHECK(second.allocated[i]->name == "1_" + itos(i));
+	}
+	for (Element *element : second.allocated) {
+		allocator.free(allocator_cache, element);
+	}
+}
+
+} // namespace TestThreadCachedAllocator
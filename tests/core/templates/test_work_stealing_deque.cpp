@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*  test_work_stealing_deque.cpp                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_work_stealing_deque)
+
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/work_stealing_deque.h"
+
+namespace TestWorkStealingDeque {
+
+TEST_CASE("[WorkStealingDeque] Owner push and pop are LIFO") {
+	WorkStealingDeque<uint32_t, 8> deque;
+	CHECK(deque.is_empty());
+
+	for (uint32_t i = 1; i <= 5; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK(deque.size() == 5);
+
+	uint32_t value = 0;
+	for (uint32_t i = 5; i >= 1; i--) {
+		CHECK(deque.pop(value));
+		CHECK(value == i);
+	}
+	CHECK_FALSE(deque.pop(value));
+	CHECK(deque.is_empty());
+}
+
+TEST_CASE("[WorkStealingDeque] Steal is FIFO") {
+	WorkStealingDeque<uint32_t, 8> deque;
+	for (uint32_t i = 1; i <= 3; i++) {
+		deque.push(i);
+	}
+
+	uint32_t value = 0;
+	CHECK(deque.steal(value));
+	CHECK(value == 1);
+	CHECK(deque.pop(value));
+	CHECK(value == 3);
+	CHECK(deque.steal(value));
+	CHECK(value == 2);
+	CHECK_FALSE(deque.steal(value));
+	CHECK_FALSE(deque.pop(value));
+}
+
+TEST_CASE("[WorkStealingDeque] Push fails when full and wraps around") {
+	WorkStealingDeque<uint32_t, 4> deque;
+	for (uint32_t i = 0; i < 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK_FALSE_MESSAGE(deque.push(4), "Pushing past the capacity should fail.");
+
+	uint32_t value = 0;
+	CHECK(deque.steal(value));
+	CHECK(value == 0);
+	CHECK_MESSAGE(deque.push(4), "Pushing should succeed again after stealing.");
+
+	uint32_t expected = 1;
+	bool all_match = true;
+	while (deque.steal(value)) {
+		all_match &= value == expected;
+		expected++;
+	}
+	CHECK(all_match);
+	CHECK(expected == 5);
+}
+
+struct ConcurrentState {
+	static const uint32_t ITEMS = 100000;
+
+	WorkStealingDeque<uint32_t, 64> deque;
+	LocalVector<SafeNumeric<uint32_t>> taken;
+	SafeFlag done;
+
+	static void thief(void *p_user) {
+		ConcurrentState *state = (ConcurrentState *)p_user;
+		uint32_t value = 0;
+		while (!state->done.is_set() || !state->deque.is_empty()) {
+			if (state->deque.steal(value)) {
+				state->taken[value].increment();
+			}
+		}
+	}
+};
+
+TEST_CASE("[WorkStealingDeque] Every item is taken exactly once with concurrent thieves") {
+	ConcurrentState state;
+	state.taken.resize(ConcurrentState::ITEMS);
+
+	const int thief_count = CLAMP(OS::get_singleton()->get_processor_count() - 1, 1, 7);
+	TightLocalVector<Thread> thieves;
+	thieves.resize(thief_count);
+	for (Thread &thief : thieves) {
+		thief.start(&ConcurrentState::thief, &state);
+	}
+
+	uint32_t value = 0;
+	for (uint32_t i = 0; i < ConcurrentState::ITEMS; i++) {
+		while (!state.deque.push(i)) {
+			if (state.deque.pop(value)) {
+				state.taken[value].increment();
+			}
+		}
+		if (i % 3 == 0 && state.deque.pop(value)) {
+			state.taken[value].increment();
+		}
+	}
+	while (!state.deque.is_empty()) {
+		if (state.deque.pop(value)) {
+			state.taken[value].increment();
+		}
+	}
+	state.done.set();
+
+	for (Thread &thief : thieves) {
+		thief.wait_to_finish();
+	}
+
+	bool all_taken_once = true;
+	for (uint32_t i = 0; i < ConcurrentState::ITEMS; i++) {
+		all_taken_once &= state.taken[i].get() == 1;
+	}
+	CHECK_MESSAGE(all_taken_once, "Every pushed item should have been popped or stolen exactly once.");
+}
+
+} // namespace TestWorkStealingDeque
@@ -174,4 +174,109 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+static LocalVector<WorkerThreadPool::GroupID> nested_groups;
+
+static void static_nested_group_element(void *p_arg, uint32_t p_index) {
+	counter[(uintptr_t)p_arg].increment();
+}
+
+static void static_nested_group_spawner(void *p_arg, uint32_t p_index) {
+	// Posted from a pool thread, so these go to its own work queue and may be stolen by others.
+	// Not awaited here, since blocking every pool thread on a group would deadlock.
+	nested_groups[p_index] = WorkerThreadPool::get_singleton()->add_native_group_task(static_nested_group_element, (void *)(uintptr_t)p_index, (uintptr_t)p_arg, -1, true);
+}
+
+static void _run_nested_groups(int p_spawners, int p_elements) {
+	nested_groups.resize(p_spawners);
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_nested_group_spawner, (void *)(uintptr_t)p_elements, p_spawners, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	for (int i = 0; i < p_spawners; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(nested_groups[i]);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Process group tasks posted from pool threads") {
+	const int spawners = 16;
+	const int elements = 64;
+
+	counter.clear();
+	counter.resize(spawners);
+	_run_nested_groups(spawners, elements);
+
+	bool all_completed = true;
+	for (int i = 0; i < spawners; i++) {
+		all_completed &= counter[i].get() == elements;
+	}
+	CHECK_MESSAGE(all_completed, "Every nested group should have processed all its elements.");
+}
+
+static void static_nested_task(void *p_arg) {
+	counter[0].increment();
+}
+
+static void static_nested_task_spawner(void *p_arg) {
+	// Awaiting from a pool thread is collaborative, so this thread helps processing its own tasks.
+	const int count = (uintptr_t)p_arg;
+	LocalVector<WorkerThreadPool::TaskID> task_ids;
+	task_ids.resize(count);
+	for (int i = 0; i < count; i++) {
+		task_ids[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_task, nullptr, true);
+	}
+	for (int i = count - 1; i >= 0; i--) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_ids[i]);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Process tasks posted from pool threads") {
+	const int spawners = 8;
+	const int tasks = 100;
+
+	counter.clear();
+	counter.resize(1);
+
+	LocalVector<WorkerThreadPool::TaskID> task_ids;
+	for (int i = 0; i < spawners; i++) {
+		task_ids.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_nested_task_spawner, (void *)(uintptr_t)tasks, true));
+	}
+	for (uint32_t i = 0; i < task_ids.size(); i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_ids[i]);
+	}
+
+	CHECK(counter[0].get() == spawners * tasks);
+}
+
+TEST_CASE_BENCHMARK("[WorkerThreadPool][Benchmark] Contention with tasks fanned out from many threads at once") {
+	const int spawners = MAX(2, WorkerThreadPool::get_singleton()->get_thread_count());
+	const int iterations = 100;
+	const int tasks_per_spawner = 512;
+	const int elements_per_group = 4096;
+
+	counter.clear();
+	counter.resize(spawners);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		_run_nested_groups(spawners, elements_per_group);
+	}
+	uint64_t group_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	LocalVector<WorkerThreadPool::TaskID> task_ids;
+	for (int i = 0; i < iterations; i++) {
+		task_ids.clear();
+		for (int j = 0; j < spawners; j++) {
+			task_ids.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_nested_task_spawner, (void *)(uintptr_t)tasks_per_spawner, true));
+		}
+		for (uint32_t j = 0; j < task_ids.size(); j++) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task_ids[j]);
+		}
+	}
+	uint64_t task_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	String result = vformat("%d threads, %d spawners: nested groups %.3f ms/iteration, nested tasks %.3f ms/iteration.",
+			WorkerThreadPool::get_singleton()->get_thread_count(), spawners, group_usec / 1000.0 / iterations, task_usec / 1000.0 / iterations);
+	MESSAGE(result.utf8().get_data());
+	CHECK(counter[0].get() > 0);
+}
+
 } // namespace TestWorkerThreadPool
@@ -601,6 +601,49 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] Order is kept after erase") {
+	Dictionary d;
+	for (int i = 0; i < 100; i++) {
+		d[i] = i;
+	}
+	for (int i = 0; i < 100; i++) {
+		if (i % 4 != 1) {
+			d.erase(i);
+		}
+	}
+	d[0] = 0;
+
+	CHECK(d.size() == 26);
+	CHECK_EQ(d.get_key_at_index(0), Variant(1));
+	CHECK_EQ(d.get_key_at_index(24), Variant(97));
+	CHECK_EQ(d.get_key_at_index(25), Variant(0));
+	CHECK_EQ(d.get_value_at_index(1), Variant(5));
+	CHECK_EQ(d.get_key_at_index(26), Variant());
+
+	// Iteration through next() follows the same order.
+	const Variant *key = d.next(nullptr);
+	for (int i = 0; i < 25; i++) {
+		REQUIRE(key);
+		CHECK_EQ(*key, Variant(i * 4 + 1));
+		key = d.next(key);
+	}
+	REQUIRE(key);
+	CHECK_EQ(*key, Variant(0));
+	CHECK(d.next(key) == nullptr);
+}
+
+TEST_CASE("[Dictionary] StringName and String keys") {
+	Dictionary d;
+	d[StringName("health")] = 10;
+	d[StringName("mana")] = 20;
+
+	CHECK(d.has(StringName("health")));
+	CHECK(d.has("health"));
+	CHECK_EQ(d[StringName("mana")], Variant(20));
+	CHECK_EQ(d["mana"], Variant(20));
+	CHECK_FALSE(d.has(StringName("stamina")));
+}
+
 TEST_CASE("[Dictionary] sort()") {
 	Dictionary d;
 	d[3] = 3;
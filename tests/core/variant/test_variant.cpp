@@ -32,6 +32,9 @@
 
 TEST_FORCE_LINK(test_variant)
 
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
 
@@ -2246,4 +2249,99 @@ TEST_CASE("[Variant] Operator NOT") {
 	}
 }
 
+struct PooledVariants {
+	static constexpr int COUNT = 10000;
+
+	LocalVector<Variant> made;
+	LocalVector<Variant> *to_free = nullptr;
+
+	static void make(void *p_userdata) {
+		PooledVariants &state = *(PooledVariants *)p_userdata;
+		state.made.resize(COUNT);
+		for (int i = 0; i < COUNT; i++) {
+			switch (i % 3) {
+				case 0:
+					state.made[i] = AABB(Vector3(i, 0, 0), Vector3(1, 1, 1));
+					break;
+				case 1:
+					state.made[i] = Transform3D(Basis(), Vector3(0, i, 0));
+					break;
+				default:
+					state.made[i] = Projection(Vector4(i, 0, 0, 0), Vector4(), Vector4(), Vector4());
+			}
+		}
+		// Free what another thread made, so buckets move between threads.
+		state.to_free->clear();
+	}
+};
+
+TEST_CASE("[Variant] Pooled math types made and freed on different threads") {
+	PooledVariants states[2];
+	LocalVector<Variant> initial[2];
+	for (int i = 0; i < 2; i++) {
+		initial[i].resize(PooledVariants::COUNT);
+		for (int j = 0; j < PooledVariants::COUNT; j++) {
+			initial[i][j] = Transform3D(Basis(), Vector3(j, j, j));
+		}
+		states[i].to_free = &initial[1 - i];
+	}
+
+	Thread threads[2];
+	for (int i = 0; i < 2; i++) {
+		threads[i].start(&PooledVariants::make, &states[i]);
+	}
+	for (int i = 0; i < 2; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	for (int i = 0; i < 2; i++) {
+		CHECK(initial[i].is_empty());
+		REQUIRE(states[i].made.size() == PooledVariants::COUNT);
+		for (int j = 0; j < PooledVariants::COUNT; j += 997) {
+			const Variant &v = states[i].made[j];
+			switch (j % 3) {
+				case 0:
+					CHECK(AABB(v).position.x == j);
+					break;
+				case 1:
+					CHECK(Transform3D(v).origin.y == j);
+					break;
+				default:
+					CHECK(Projection(v).columns[0].x == j);
+			}
+		}
+	}
+}
+
+struct PoolBenchmark {
+	static constexpr int ITERATIONS = 200000;
+
+	static void churn(void *p_userdata) {
+		Variant values[16];
+		for (int i = 0; i < ITERATIONS; i++) {
+			values[i & 15] = Transform3D(Basis(), Vector3(i, 0, 0));
+		}
+	}
+};
+
+// Compare builds with and without `variant_thread_pools=yes`.
+TEST_CASE_BENCHMARK("[Variant][Benchmark] Concurrent math type allocation") {
+	for (int thread_count = 1; thread_count <= OS::get_singleton()->get_processor_count(); thread_count *= 2) {
+		TightLocalVector<Thread> threads;
+		threads.resize(thread_count);
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (Thread &thread : threads) {
+			thread.start(&PoolBenchmark::churn, nullptr);
+		}
+		for (Thread &thread : threads) {
+			thread.wait_to_finish();
+		}
+		const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		String result = vformat("%d threads: %.1f ns per Transform3D Variant assignment.", thread_count, usec * 1000.0 / ((double)PoolBenchmark::ITERATIONS * thread_count));
+		MESSAGE(result.utf8().get_data());
+	}
+}
+
 } // namespace TestVariant
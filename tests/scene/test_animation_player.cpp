@@ -32,7 +32,10 @@
 
 TEST_FORCE_LINK(test_animation_player)
 
+#include "scene/2d/node_2d.h"
 #include "scene/animation/animation_player.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
 #include "scene/resources/animation.h"
 
 namespace TestAnimationPlayer {
@@ -62,4 +65,55 @@ TEST_CASE("[AnimationPlayer] get & set blend_time") {
 	memdelete(animation_player);
 }
 
+TEST_CASE("[SceneTree][AnimationPlayer] Parallel blending gives the same result as serial blending") {
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	int position_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(position_track, NodePath("Target:position"));
+	animation->track_insert_key(position_track, 0.0, Vector2(0, 0));
+	animation->track_insert_key(position_track, 1.0, Vector2(100, 50));
+	int visible_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(visible_track, NodePath("Target:visible"));
+	animation->value_track_set_update_mode(visible_track, Animation::UPDATE_DISCRETE);
+	animation->track_insert_key(visible_track, 0.0, false);
+
+	Ref<AnimationLibrary> animation_library;
+	animation_library.instantiate();
+	animation_library->add_animation("move", animation);
+
+	const int count = 8;
+	Node *root = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	LocalVector<Node2D *> targets;
+	for (int i = 0; i < count; i++) {
+		Node *holder = memnew(Node);
+		root->add_child(holder);
+		Node2D *target = memnew(Node2D);
+		target->set_name("Target");
+		holder->add_child(target);
+		targets.push_back(target);
+
+		AnimationPlayer *player = memnew(AnimationPlayer);
+		player->set_parallel_blending_enabled(i % 2 == 0);
+		player->set_callback_mode_process(AnimationMixer::ANIMATION_CALLBACK_MODE_PROCESS_IDLE);
+		player->add_animation_library("", animation_library);
+		holder->add_child(player);
+		player->play("move");
+	}
+
+	SceneTree::get_singleton()->process(0.25);
+	SceneTree::get_singleton()->process(0.25);
+
+	// Even players blend in parallel, odd ones serially.
+	for (int i = 0; i < count; i += 2) {
+		CHECK(targets[i]->get_position() != Vector2());
+		CHECK(targets[i]->get_position() == targets[i + 1]->get_position());
+		CHECK_FALSE(targets[i]->is_visible());
+		CHECK_FALSE(targets[i + 1]->is_visible());
+	}
+
+	memdelete(root);
+}
+
 } // namespace TestAnimationPlayer
@@ -439,6 +439,47 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 		CHECK_EQ(E, node1_1);
 	}
 
+	SUBCASE("Nodes added to a sorted group should be merged in tree order") {
+		node2->add_to_group("nodes");
+		Vector<Node *> nodes = SceneTree::get_singleton()->get_nodes_in_group("nodes");
+		REQUIRE_EQ(nodes.size(), 1);
+
+		// Both go before the node already sorted, in reverse tree order.
+		node1_1->add_to_group("nodes");
+		node1->add_to_group("nodes");
+		nodes = SceneTree::get_singleton()->get_nodes_in_group("nodes");
+		REQUIRE_EQ(nodes.size(), 3);
+		CHECK_EQ(nodes[0], node1);
+		CHECK_EQ(nodes[1], node1_1);
+		CHECK_EQ(nodes[2], node2);
+
+		// Moving a child changes tree order under nodes already in the group.
+		SceneTree::get_singleton()->get_root()->move_child(node2, 0);
+		nodes = SceneTree::get_singleton()->get_nodes_in_group("nodes");
+		REQUIRE_EQ(nodes.size(), 3);
+		CHECK_EQ(nodes[0], node2);
+		CHECK_EQ(nodes[1], node1);
+		CHECK_EQ(nodes[2], node1_1);
+	}
+
+	SUBCASE("Iterating a group should skip nodes removed from the tree while iterating") {
+		node1->add_to_group("nodes");
+		node1_1->add_to_group("nodes");
+		node2->add_to_group("nodes");
+
+		Vector<Node *> visited;
+		SceneTree::get_singleton()->for_each_node_in_group("nodes", [&](Node *p_node) {
+			visited.push_back(p_node);
+			if (p_node == node1) {
+				SceneTree::get_singleton()->get_root()->remove_child(node2);
+			}
+		});
+		REQUIRE_EQ(visited.size(), 2);
+		CHECK_EQ(visited[0], node1);
+		CHECK_EQ(visited[1], node1_1);
+		CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("nodes"), 2);
+	}
+
 	SUBCASE("Nodes added as siblings of another node should be right next to it") {
 		node1->remove_child(node1_1);
 
@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*  test_node_3d.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_node_3d)
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+
+namespace TestNode3D {
+
+TEST_CASE("[SceneTree][Node3D] Transform store") {
+	SceneTree *tree = SceneTree::get_singleton();
+	SceneTreeTransformStore &store = tree->get_transform_store();
+
+	Node3D *parent = memnew(Node3D);
+	Node3D *child = memnew(Node3D);
+	Node3D *grandchild = memnew(Node3D);
+	Node3D *top_level = memnew(Node3D);
+	parent->add_child(child);
+	child->add_child(grandchild);
+	child->add_child(top_level);
+	top_level->set_as_top_level(true);
+	tree->get_root()->add_child(parent);
+
+	store.set_enabled(tree->get_root(), true);
+	CHECK_EQ(store.get_node_count(), 4u);
+
+	SUBCASE("Global transforms are resolved when notifications are flushed") {
+		parent->set_position(Vector3(1, 0, 0));
+		child->set_position(Vector3(0, 2, 0));
+		grandchild->set_rotation(Vector3(0, Math::PI, 0));
+		top_level->set_position(Vector3(5, 5, 5));
+		tree->flush_transform_notifications();
+
+		// Resolved by the store itself, not lazily by the getters below.
+		CHECK(store.is_global_transform_cached(parent));
+		CHECK(store.is_global_transform_cached(child));
+		CHECK(store.is_global_transform_cached(grandchild));
+		CHECK(store.is_global_transform_cached(top_level));
+
+		CHECK(child->get_global_position().is_equal_approx(Vector3(1, 2, 0)));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(1, 2, 0)));
+		CHECK(grandchild->get_global_basis().is_equal_approx(Basis(Vector3(0, 1, 0), Math::PI)));
+		CHECK(top_level->get_global_position().is_equal_approx(Vector3(5, 5, 5)));
+
+		// Only the parent changed; descendants follow, the top level node does not.
+		parent->set_position(Vector3(0, 0, 3));
+		CHECK_FALSE(store.is_global_transform_cached(grandchild));
+		tree->flush_transform_notifications();
+		CHECK(store.is_global_transform_cached(grandchild));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(0, 2, 3)));
+		CHECK(top_level->get_global_position().is_equal_approx(Vector3(5, 5, 5)));
+	}
+
+	SUBCASE("Nested changes are resolved in depth order") {
+		// The deeper node changes first, so its ancestor's change must still be applied before it.
+		grandchild->set_position(Vector3(0, 0, 1));
+		child->set_position(Vector3(0, 1, 0));
+		parent->set_position(Vector3(1, 0, 0));
+		tree->flush_transform_notifications();
+		CHECK(store.is_global_transform_cached(grandchild));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(1, 1, 1)));
+
+		// A top level node is skipped when its parent moves, but not when it moves itself.
+		child->set_position(Vector3(0, 2, 0));
+		top_level->set_position(Vector3(0, 0, 4));
+		tree->flush_transform_notifications();
+		CHECK(store.is_global_transform_cached(grandchild));
+		CHECK(store.is_global_transform_cached(top_level));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(1, 2, 1)));
+		CHECK(top_level->get_global_position().is_equal_approx(Vector3(0, 0, 4)));
+	}
+
+	SUBCASE("Disabling scale updates the stored transforms") {
+		parent->set_scale(Vector3(2, 2, 2));
+		child->set_position(Vector3(0, 1, 0));
+		tree->flush_transform_notifications();
+		CHECK(store.is_global_transform_cached(grandchild));
+		CHECK(grandchild->get_global_basis().get_scale().is_equal_approx(Vector3(2, 2, 2)));
+
+		child->set_disable_scale(true);
+		CHECK_FALSE_MESSAGE(store.is_global_transform_cached(grandchild), "Disabling scale should dirty the subtree.");
+		tree->flush_transform_notifications();
+		CHECK(store.is_global_transform_cached(child));
+		CHECK(store.is_global_transform_cached(grandchild));
+		CHECK(child->get_global_basis().get_scale().is_equal_approx(Vector3(1, 1, 1)));
+		CHECK(grandchild->get_global_basis().get_scale().is_equal_approx(Vector3(1, 1, 1)));
+		CHECK(child->get_global_position().is_equal_approx(Vector3(0, 2, 0)));
+	}
+
+	SUBCASE("Nodes leaving and entering the tree are tracked") {
+		child->remove_child(grandchild);
+		CHECK_EQ(store.get_node_count(), 3u);
+
+		parent->set_position(Vector3(0, 1, 0));
+		tree->flush_transform_notifications();
+		CHECK(child->get_global_position().is_equal_approx(Vector3(0, 1, 0)));
+
+		// Re-added under another parent, the entries need to be sorted again.
+		top_level->add_child(grandchild);
+		CHECK_EQ(store.get_node_count(), 4u);
+		grandchild->set_position(Vector3(1, 0, 0));
+		top_level->set_position(Vector3(0, 0, 2));
+		tree->flush_transform_notifications();
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(1, 0, 2)));
+	}
+
+	store.set_enabled(tree->get_root(), false);
+	CHECK_EQ(store.get_node_count(), 0u);
+
+	memdelete(parent);
+}
+
+} // namespace TestNode3D
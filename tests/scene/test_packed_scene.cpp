@@ -33,6 +33,9 @@
 TEST_FORCE_LINK(test_packed_scene)
 
 #include "core/object/callable_mp.h"
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/gui/control.h"
 #include "scene/resources/packed_scene.h"
 
 namespace TestPackedScene {
@@ -282,4 +285,121 @@ TEST_CASE("[PackedScene] Recreate State") {
 	memdelete(scene);
 }
 
+TEST_CASE("[PackedScene] Instantiate Many") {
+	// root (Node2D)
+	// `- Child (Control, unique name, in group)
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(4, 2));
+	scene->set_meta("tag", "bullet");
+
+	Control *child = memnew(Control);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+	child->set_offset(SIDE_LEFT, 12.5);
+	child->set_unique_name_in_owner(true);
+	child->add_to_group("projectiles", true);
+	child->connect("renamed", Callable(scene, "set_meta").bind("hit", true), Object::CONNECT_PERSIST);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	CHECK(packed_scene->pack(scene) == OK);
+
+	const TypedArray<Node> instances = packed_scene->instantiate_many(3);
+	REQUIRE(instances.size() == 3);
+
+	for (int i = 0; i < instances.size(); i++) {
+		Node2D *instance = Object::cast_to<Node2D>(instances[i]);
+		REQUIRE(instance != nullptr);
+		CHECK(instance != scene);
+		CHECK(instance->get_name() == "TestScene");
+		CHECK(instance->get_position() == Vector2(4, 2));
+		CHECK(instance->get_meta("tag") == Variant("bullet"));
+
+		REQUIRE(instance->get_child_count() == 1);
+		Control *instance_child = Object::cast_to<Control>(instance->get_child(0));
+		REQUIRE(instance_child != nullptr);
+		CHECK(instance_child->get_owner() == instance);
+		CHECK(instance_child->get_offset(SIDE_LEFT) == doctest::Approx(12.5));
+		CHECK(instance_child->is_in_group("projectiles"));
+		CHECK(instance->get_node_or_null(NodePath("%Child")) == instance_child);
+
+		CHECK_FALSE(instance->has_meta("hit"));
+		instance_child->emit_signal(SNAME("renamed"));
+		CHECK(instance->get_meta("hit", false) == Variant(true));
+	}
+
+	for (int i = 0; i < instances.size(); i++) {
+		memdelete(Object::cast_to<Node>(instances[i]));
+	}
+	memdelete(scene);
+}
+
+TEST_CASE("[PackedScene] Instantiate After Repacking") {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_rotation(0.5);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+
+	Node2D *instance = Object::cast_to<Node2D>(packed_scene->instantiate());
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_rotation() == doctest::Approx(0.5));
+	memdelete(instance);
+
+	// Instantiation must not reuse anything resolved for the previous contents.
+	scene->set_rotation(1.5);
+	scene->set_name("RepackedScene");
+	packed_scene->pack(scene);
+
+	instance = Object::cast_to<Node2D>(packed_scene->instantiate());
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_name() == "RepackedScene");
+	CHECK(instance->get_rotation() == doctest::Approx(1.5));
+	memdelete(instance);
+
+	memdelete(scene);
+}
+
+TEST_CASE_BENCHMARK("[PackedScene][Benchmark] Instantiate a small scene many times") {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("Bullet");
+	for (int i = 0; i < 4; i++) {
+		Node2D *child = memnew(Node2D);
+		child->set_name(vformat("Part%d", i));
+		child->set_position(Vector2(i, i));
+		child->set_z_index(i);
+		scene->add_child(child);
+		child->set_owner(scene);
+	}
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+
+	const int count = 2000;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < count; i++) {
+		memdelete(packed_scene->instantiate());
+	}
+	const uint64_t single_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	const TypedArray<Node> instances = packed_scene->instantiate_many(count);
+	const uint64_t many_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(instances.size() == count);
+
+	for (int i = 0; i < instances.size(); i++) {
+		memdelete(Object::cast_to<Node>(instances[i]));
+	}
+	memdelete(scene);
+
+	const String result = vformat("%d instances: instantiate() %d usec, instantiate_many() %d usec.", count, single_usec, many_usec);
+	MESSAGE(result.utf8().get_data());
+}
+
 } // namespace TestPackedScene
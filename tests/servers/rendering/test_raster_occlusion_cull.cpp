@@ -0,0 +1,150 @@
+/**************************************************************************/
+/*  test_raster_occlusion_cull.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_raster_occlusion_cull)
+
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "servers/rendering/raster_occlusion_cull.h"
+
+namespace TestRasterOcclusionCull {
+
+typedef RasterOcclusionCull::RasterHZBuffer RasterHZBuffer;
+
+// A quad facing the camera, which looks down -Z from the origin.
+static const Vector3 quad_vertices[4] = { Vector3(-1, -1, 0), Vector3(1, -1, 0), Vector3(1, 1, 0), Vector3(-1, 1, 0) };
+static const int32_t quad_indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+static RasterHZBuffer::Mesh make_quad(const Transform3D &p_xform) {
+	RasterHZBuffer::Mesh mesh;
+	mesh.xform = p_xform;
+	mesh.vertices = quad_vertices;
+	mesh.indices = quad_indices;
+	mesh.index_count = 6;
+	return mesh;
+}
+
+static bool is_box_occluded(const RasterHZBuffer &p_buffer, const Projection &p_projection, const Vector3 &p_center, real_t p_half_size, bool p_orthogonal) {
+	const real_t bounds[6] = {
+		p_center.x - p_half_size, p_center.y - p_half_size, p_center.z - p_half_size,
+		p_center.x + p_half_size, p_center.y + p_half_size, p_center.z + p_half_size
+	};
+	uint64_t timeout = 0;
+	return p_buffer.is_occluded(bounds, Vector3(), Transform3D(), p_projection, p_projection.get_z_near(), p_orthogonal, timeout);
+}
+
+TEST_CASE("[RasterOcclusionCull] Occluder quad hides what is behind it") {
+	const bool jitter_enabled = RasterHZBuffer::occlusion_jitter_enabled;
+	RasterHZBuffer::occlusion_jitter_enabled = false;
+
+	LocalVector<RasterHZBuffer::Mesh> meshes;
+	// Scaled by 4, 10 units in front of the camera.
+	meshes.push_back(make_quad(Transform3D(Basis().scaled(Vector3(4, 4, 1)), Vector3(0, 0, -10))));
+
+	SUBCASE("Perspective") {
+		const Projection projection = Projection::create_perspective(90, 1, 1, 100);
+		RasterHZBuffer buffer;
+		buffer.resize(Size2i(64, 64));
+		buffer.rasterize(meshes, Transform3D(), Vector2(-1, -1), Vector2(2, 2), 1, 100, false);
+
+		CHECK(is_box_occluded(buffer, projection, Vector3(0, 0, -20), 1, false));
+		CHECK_FALSE(is_box_occluded(buffer, projection, Vector3(0, 0, -5), 1, false));
+		CHECK_FALSE(is_box_occluded(buffer, projection, Vector3(12, 0, -20), 1, false));
+		// Larger than the occluder, so it pokes out on the sides.
+		CHECK_FALSE(is_box_occluded(buffer, projection, Vector3(0, 0, -30), 20, false));
+	}
+
+	SUBCASE("Orthogonal") {
+		const Projection projection = Projection::create_orthogonal_aspect(20, 1, 1, 100);
+		RasterHZBuffer buffer;
+		buffer.resize(Size2i(64, 64));
+		buffer.rasterize(meshes, Transform3D(), Vector2(-10, -10), Vector2(20, 20), 1, 100, true);
+
+		CHECK(is_box_occluded(buffer, projection, Vector3(0, 0, -20), 1, true));
+		CHECK_FALSE(is_box_occluded(buffer, projection, Vector3(0, 0, -5), 1, true));
+		CHECK_FALSE(is_box_occluded(buffer, projection, Vector3(7, 0, -20), 1, true));
+	}
+
+	SUBCASE("Occluder crossing the near plane") {
+		const Projection projection = Projection::create_perspective(90, 1, 1, 100);
+		// A floor from behind the camera to far ahead, one unit below it.
+		meshes.clear();
+		meshes.push_back(make_quad(Transform3D(Basis(Vector3(1, 0, 0), -Math::PI / 2).scaled_local(Vector3(1000, 1000, 1)), Vector3(0, -1, 0))));
+
+		RasterHZBuffer buffer;
+		buffer.resize(Size2i(64, 64));
+		buffer.rasterize(meshes, Transform3D(), Vector2(-1, -1), Vector2(2, 2), 1, 100, false);
+
+		CHECK(is_box_occluded(buffer, projection, Vector3(0, -5, -20), 1, false));
+		CHECK_FALSE(is_box_occluded(buffer, projection, Vector3(0, 2, -20), 1, false));
+	}
+
+	RasterHZBuffer::occlusion_jitter_enabled = jitter_enabled;
+}
+
+TEST_CASE_BENCHMARK("[RasterOcclusionCull][Benchmark] Rasterize box occluders") {
+	const int box_count = 2000;
+	const int frame_count = 20;
+
+	static const Vector3 box_vertices[8] = {
+		Vector3(-1, -1, -1), Vector3(1, -1, -1), Vector3(1, 1, -1), Vector3(-1, 1, -1),
+		Vector3(-1, -1, 1), Vector3(1, -1, 1), Vector3(1, 1, 1), Vector3(-1, 1, 1)
+	};
+	static const int32_t box_indices[36] = {
+		0, 2, 1, 0, 3, 2, 4, 5, 6, 4, 6, 7, 0, 1, 5, 0, 5, 4,
+		3, 6, 2, 3, 7, 6, 0, 4, 7, 0, 7, 3, 1, 2, 6, 1, 6, 5
+	};
+
+	RandomPCG rng(1234);
+	LocalVector<RasterHZBuffer::Mesh> meshes;
+	for (int i = 0; i < box_count; i++) {
+		RasterHZBuffer::Mesh mesh;
+		mesh.xform = Transform3D(Basis().scaled(Vector3(1, 1, 1) * (0.5 + rng.randf() * 2.0)), Vector3(rng.randf() * 200 - 100, rng.randf() * 20 - 10, -rng.randf() * 200 - 2));
+		mesh.vertices = box_vertices;
+		mesh.indices = box_indices;
+		mesh.index_count = 36;
+		meshes.push_back(mesh);
+	}
+
+	RasterHZBuffer buffer;
+	buffer.resize(Size2i(512, 288));
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < frame_count; i++) {
+		buffer.rasterize(meshes, Transform3D(), Vector2(-1.777, -1), Vector2(3.555, 2), 1, 500, false);
+	}
+	const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	String result = vformat("%d boxes into %dx%d: %.3f ms per frame.", box_count, 512, 288, usec / 1000.0 / frame_count);
+	MESSAGE(result.utf8().get_data());
+}
+
+} // namespace TestRasterOcclusionCull
@@ -0,0 +1,257 @@
+/**************************************************************************/
+/*  test_renderer_scene_cull.cpp                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_renderer_scene_cull)
+
+#include "core/math/projection.h"
+#include "core/math/random_pcg.h"
+#include "core/templates/hash_set.h"
+#include "servers/rendering/renderer_scene_cull.h"
+#include "servers/rendering/rendering_server.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+class TestRendererSceneCullAccessor {
+public:
+	// Culls the shadow casters of one pass per set of planes, like _process_shadow_cull_tasks().
+	// Without threads, the tasks run one after the other on this thread.
+	// The tasks have no light, so the scenario must not contain animated materials.
+	static void cull_shadow_casters(RID p_scenario, const LocalVector<Vector<Plane>> &p_passes, bool p_threaded, LocalVector<HashSet<RenderGeometryInstance *>> &r_casters) {
+		RendererSceneCull *scene = static_cast<RendererSceneCull *>(RSG::scene);
+		scene->update_dirty_instances();
+		RendererSceneCull::Scenario *scenario = scene->scenario_owner.get_or_null(p_scenario);
+		REQUIRE(scenario);
+		REQUIRE(p_passes.size() <= RendererSceneCull::MAX_UPDATE_SHADOWS);
+
+		for (uint32_t i = 0; i < p_passes.size(); i++) {
+			RendererSceneCull::ShadowCullTask &task = scene->shadow_cull_tasks[i];
+			task.light = nullptr;
+			task.shadow_index = i;
+			task.caster_mask = UINT32_MAX;
+			task.light_culler_id = -1;
+			task.planes = p_passes[i];
+		}
+		scene->shadow_cull_task_count = p_passes.size();
+		scene->max_shadows_used = p_passes.size();
+
+		if (p_threaded) {
+			scene->_process_shadow_cull_tasks(scenario, UINT32_MAX);
+		} else {
+			RendererSceneCull::ShadowCullData cull_data;
+			cull_data.scenario = scenario;
+			cull_data.visible_layers = UINT32_MAX;
+			for (uint32_t i = 0; i < p_passes.size(); i++) {
+				scene->_shadow_cull_threaded(i, &cull_data);
+				scene->shadow_cull_tasks[i].mesh_instances.clear();
+				scene->shadow_cull_tasks[i].animated_material_found = false;
+			}
+			scene->shadow_cull_task_count = 0;
+		}
+
+		r_casters.resize(p_passes.size());
+		for (uint32_t i = 0; i < p_passes.size(); i++) {
+			PagedArray<RenderGeometryInstance *> &instances = scene->render_shadow_data[i].instances;
+			r_casters[i].clear();
+			for (uint64_t j = 0; j < instances.size(); j++) {
+				r_casters[i].insert(instances[j]);
+			}
+			instances.clear();
+		}
+		scene->max_shadows_used = 0;
+	}
+};
+
+namespace TestRendererSceneCull {
+
+typedef RendererSceneCull::Frustum Frustum;
+typedef RendererSceneCull::InstanceBounds InstanceBounds;
+typedef RendererSceneCull::InstanceFrustumCoherence InstanceFrustumCoherence;
+typedef RendererSceneCull::Scenario::FrustumCoherence FrustumCoherence;
+
+static const real_t Z_FAR = 100.0;
+
+static AABB random_aabb(RandomPCG &p_rng) {
+	const Vector3 position(p_rng.random(-60.0, 60.0), p_rng.random(-10.0, 10.0), p_rng.random(-60.0, 60.0));
+	const Vector3 size(p_rng.random(0.1, 4.0), p_rng.random(0.1, 4.0), p_rng.random(0.1, 4.0));
+	return AABB(position, size);
+}
+
+// Runs the coherent test on every instance and counts the ones that disagree with the full test.
+static int count_mismatches(const FrustumCoherence &p_coherence, const LocalVector<InstanceBounds> &p_bounds, PagedArray<InstanceFrustumCoherence> &r_cached, const Frustum &p_frustum) {
+	int mismatches = 0;
+	for (uint32_t i = 0; i < p_bounds.size(); i++) {
+		if (p_coherence.in_frustum(p_bounds[i], r_cached[i], p_frustum) != p_bounds[i].in_frustum(p_frustum)) {
+			mismatches++;
+		}
+	}
+	return mismatches;
+}
+
+TEST_CASE("[RendererSceneCull] Frame-coherent frustum culling matches the full test") {
+	const Projection projection = Projection::create_perspective(70.0, 16.0 / 9.0, 0.05, Z_FAR);
+	RandomPCG rng(4242);
+
+	PagedArrayPool<InstanceFrustumCoherence> pool;
+	PagedArray<InstanceFrustumCoherence> cached;
+	cached.set_page_pool(&pool);
+	LocalVector<InstanceBounds> bounds;
+	for (int i = 0; i < 2000; i++) {
+		bounds.push_back(InstanceBounds(random_aabb(rng)));
+		cached.push_back(InstanceFrustumCoherence());
+	}
+
+	FrustumCoherence coherence;
+	int mismatches = 0;
+	uint32_t epochs = 0;
+	for (int frame = 0; frame < 600; frame++) {
+		// Orbit and turn, with pauses where the camera stands still, and a few jumps.
+		const real_t t = frame < 200 || frame > 260 ? frame * 0.01 : 2.0;
+		Transform3D camera;
+		camera.basis = Basis(Vector3(0, 1, 0), t * 3.0) * Basis(Vector3(1, 0, 0), Math::sin(t * 5.0) * 0.3);
+		camera.origin = Vector3(Math::cos(t) * 30.0, Math::sin(t * 2.0) * 5.0, Math::sin(t) * 30.0);
+		if (frame % 150 == 149) {
+			camera.origin += Vector3(Z_FAR, 0, 0);
+		}
+		const Vector<Plane> planes = projection.get_projection_planes(camera);
+
+		const uint32_t previous_epoch = coherence.epoch;
+		coherence.update(planes, camera.origin, Z_FAR, cached);
+		epochs += coherence.epoch != previous_epoch;
+
+		// Moving instances drop their cached result, like _update_instance() does.
+		if (frame % 10 == 5) {
+			for (int i = 0; i < 50; i++) {
+				const uint32_t index = rng.rand(bounds.size());
+				bounds[index] = InstanceBounds(random_aabb(rng));
+				cached[index].epoch = 0;
+			}
+		}
+
+		mismatches += count_mismatches(coherence, bounds, cached, Frustum(planes));
+	}
+
+	CHECK(mismatches == 0);
+	CHECK_MESSAGE(epochs < 100, "Small camera motion should keep the cached results.");
+	CHECK_MESSAGE(epochs > 1, "Jumping the camera should start a new epoch.");
+
+	cached.reset();
+}
+
+TEST_CASE("[RendererSceneCull] Frame-coherent frustum culling across the epoch wraparound") {
+	const Projection projection = Projection::create_perspective(70.0, 1.0, 0.05, Z_FAR);
+	RandomPCG rng(7);
+
+	PagedArrayPool<InstanceFrustumCoherence> pool;
+	PagedArray<InstanceFrustumCoherence> cached;
+	cached.set_page_pool(&pool);
+	LocalVector<InstanceBounds> bounds;
+	for (int i = 0; i < 500; i++) {
+		bounds.push_back(InstanceBounds(random_aabb(rng)));
+		cached.push_back(InstanceFrustumCoherence());
+	}
+
+	// Test every instance with the camera looking one way in epoch 1.
+	FrustumCoherence coherence;
+	Transform3D camera;
+	Vector<Plane> planes = projection.get_projection_planes(camera);
+	coherence.update(planes, camera.origin, Z_FAR, cached);
+	REQUIRE(coherence.epoch == 1);
+	CHECK(count_mismatches(coherence, bounds, cached, Frustum(planes)) == 0);
+
+	// Much later, the counter wraps around to epoch 1 again, with the camera turned around.
+	// Entries not tested in between, like instances on hidden layers, still say epoch 1.
+	coherence.epoch = UINT32_MAX;
+	coherence.valid = false;
+	camera.basis = Basis(Vector3(0, 1, 0), Math::PI);
+	planes = projection.get_projection_planes(camera);
+	coherence.update(planes, camera.origin, Z_FAR, cached);
+	REQUIRE(coherence.epoch == 1);
+	CHECK_MESSAGE(count_mismatches(coherence, bounds, cached, Frustum(planes)) == 0, "Results cached before the wraparound must not be reused.");
+
+	cached.reset();
+}
+
+TEST_CASE("[SceneTree][RendererSceneCull] Threaded shadow caster culling matches serial culling") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RandomPCG rng(99);
+
+	RID scenario = rs->scenario_create();
+	// A surface without a material, so the instances cast shadows and have no animated materials.
+	RID mesh = rs->mesh_create();
+	Array arrays;
+	arrays.resize(RSE::ARRAY_MAX);
+	arrays[RSE::ARRAY_VERTEX] = PackedVector3Array({ Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(0, 1, 0) });
+	rs->mesh_add_surface_from_arrays(mesh, RSE::PRIMITIVE_TRIANGLES, arrays);
+	LocalVector<RID> instances;
+	for (int i = 0; i < 1000; i++) {
+		RID instance = rs->instance_create2(mesh, scenario);
+		rs->instance_set_custom_aabb(instance, random_aabb(rng));
+		if (i % 10 == 0) {
+			// Not shadow casters, so they must be skipped by both paths.
+			rs->instance_geometry_set_cast_shadows_setting(instance, RSE::SHADOW_CASTING_SETTING_OFF);
+		}
+		instances.push_back(instance);
+	}
+
+	// Spot light frusta pointing in random directions, several per light like omni shadow cubes.
+	LocalVector<Vector<Plane>> passes;
+	for (int i = 0; i < 24; i++) {
+		Projection projection;
+		projection.set_perspective(30.0 + rng.randf() * 90.0, 1.0, 0.025, 20.0 + rng.randf() * 60.0);
+		Transform3D xform;
+		xform.origin = Vector3(rng.random(-60.0, 60.0), rng.random(-10.0, 10.0), rng.random(-60.0, 60.0));
+		xform.basis = Basis::from_euler(Vector3(rng.randf(), rng.randf(), rng.randf()) * Math::TAU);
+		passes.push_back(projection.get_projection_planes(xform));
+	}
+
+	LocalVector<HashSet<RenderGeometryInstance *>> serial;
+	LocalVector<HashSet<RenderGeometryInstance *>> threaded;
+	TestRendererSceneCullAccessor::cull_shadow_casters(scenario, passes, false, serial);
+	TestRendererSceneCullAccessor::cull_shadow_casters(scenario, passes, true, threaded);
+
+	uint32_t total = 0;
+	for (uint32_t i = 0; i < passes.size(); i++) {
+		CHECK_MESSAGE(serial[i].size() == threaded[i].size(), vformat("Shadow pass %d should find the same number of casters.", i));
+		for (RenderGeometryInstance *caster : serial[i]) {
+			CHECK(threaded[i].has(caster));
+		}
+		total += serial[i].size();
+	}
+	CHECK_MESSAGE(total > 0, "The shadow passes should find casters.");
+
+	for (const RID &instance : instances) {
+		rs->free_rid(instance);
+	}
+	rs->free_rid(mesh);
+	rs->free_rid(scenario);
+}
+
+} // namespace TestRendererSceneCull
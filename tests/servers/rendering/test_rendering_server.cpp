@@ -0,0 +1,242 @@
+/**************************************************************************/
+/*  test_rendering_server.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_rendering_server)
+
+#include "core/math/random_pcg.h"
+#include "core/variant/typed_array.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/renderer_scene_cull.h"
+#include "servers/rendering/rendering_server.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+namespace TestRenderingServer {
+
+static Transform3D _random_transform_3d(RandomPCG &p_rng) {
+	Transform3D xform;
+	xform.basis = Basis::from_euler(Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()) * Math::TAU);
+	xform.basis.scale(Vector3(1.0, 1.0, 1.0) + Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()));
+	xform.origin = Vector3(p_rng.random(-100.0, 100.0), p_rng.random(-100.0, 100.0), p_rng.random(-100.0, 100.0));
+	return xform;
+}
+
+static Transform2D _random_transform_2d(RandomPCG &p_rng) {
+	return Transform2D(p_rng.randf() * Math::TAU, Size2(1.0, 1.0) + Size2(p_rng.randf(), p_rng.randf()), 0.0, Vector2(p_rng.random(-100.0, 100.0), p_rng.random(-100.0, 100.0)));
+}
+
+static Transform3D _get_instance_transform(RID p_instance) {
+	RendererSceneCull::Instance *instance = static_cast<RendererSceneCull *>(RSG::scene)->instance_owner.get_or_null(p_instance);
+	REQUIRE(instance);
+	return instance->transform;
+}
+
+static Transform2D _get_canvas_item_transform(RID p_item) {
+	RendererCanvasCull::Item *item = RSG::canvas->canvas_item_owner.get_or_null(p_item);
+	REQUIRE(item);
+	return item->xform_curr;
+}
+
+TEST_CASE("[SceneTree][RenderingServer] Setting instance transforms in a batch") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RandomPCG rng(7);
+
+	RID scenario = rs->scenario_create();
+	Vector<RID> batched;
+	Vector<RID> single;
+	Vector<Transform3D> transforms;
+	for (int i = 0; i < 64; i++) {
+		batched.push_back(rs->instance_create());
+		single.push_back(rs->instance_create());
+		rs->instance_set_scenario(batched[i], scenario);
+		rs->instance_set_scenario(single[i], scenario);
+		transforms.push_back(_random_transform_3d(rng));
+	}
+
+	SUBCASE("Results match setting the transforms one by one") {
+		rs->instance_set_transforms(batched, transforms);
+		for (int i = 0; i < single.size(); i++) {
+			rs->instance_set_transform(single[i], transforms[i]);
+		}
+		for (int i = 0; i < batched.size(); i++) {
+			CHECK(_get_instance_transform(batched[i]) == _get_instance_transform(single[i]));
+			CHECK(_get_instance_transform(batched[i]) == transforms[i]);
+		}
+	}
+
+	SUBCASE("Bound method takes typed arrays") {
+		TypedArray<RID> instances;
+		TypedArray<Transform3D> xforms;
+		for (int i = 0; i < batched.size(); i++) {
+			instances.push_back(batched[i]);
+			xforms.push_back(transforms[i]);
+		}
+		rs->call(SNAME("instance_set_transforms"), instances, xforms);
+		for (int i = 0; i < batched.size(); i++) {
+			CHECK(_get_instance_transform(batched[i]) == transforms[i]);
+		}
+	}
+
+	SUBCASE("Mismatched array sizes are rejected") {
+		Vector<Transform3D> too_few = transforms;
+		too_few.resize(transforms.size() - 1);
+		TypedArray<RID> instances;
+		TypedArray<Transform3D> xforms;
+		for (int i = 0; i < batched.size(); i++) {
+			instances.push_back(batched[i]);
+			if (i > 0) {
+				xforms.push_back(transforms[i]);
+			}
+		}
+
+		ERR_PRINT_OFF;
+		rs->instance_set_transforms(batched, too_few);
+		rs->call(SNAME("instance_set_transforms"), instances, xforms);
+		ERR_PRINT_ON;
+
+		for (int i = 0; i < batched.size(); i++) {
+			CHECK(_get_instance_transform(batched[i]) == Transform3D());
+		}
+	}
+
+	SUBCASE("Invalid RIDs are skipped") {
+		RID freed = rs->instance_create();
+		rs->free_rid(freed);
+		Vector<RID> instances = batched;
+		instances.write[1] = RID();
+		instances.write[2] = freed;
+		// Not an instance.
+		instances.write[3] = scenario;
+
+		ERR_PRINT_OFF;
+		rs->instance_set_transforms(instances, transforms);
+		ERR_PRINT_ON;
+
+		for (int i = 0; i < batched.size(); i++) {
+			CHECK(_get_instance_transform(batched[i]) == (i >= 1 && i <= 3 ? Transform3D() : transforms[i]));
+		}
+	}
+
+	for (int i = 0; i < batched.size(); i++) {
+		rs->free_rid(batched[i]);
+		rs->free_rid(single[i]);
+	}
+	rs->free_rid(scenario);
+}
+
+TEST_CASE("[SceneTree][RenderingServer] Setting canvas item transforms in a batch") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RandomPCG rng(11);
+
+	RID canvas = rs->canvas_create();
+	Vector<RID> batched;
+	Vector<RID> single;
+	Vector<Transform2D> transforms;
+	for (int i = 0; i < 64; i++) {
+		batched.push_back(rs->canvas_item_create());
+		single.push_back(rs->canvas_item_create());
+		rs->canvas_item_set_parent(batched[i], canvas);
+		rs->canvas_item_set_parent(single[i], canvas);
+		transforms.push_back(_random_transform_2d(rng));
+	}
+
+	SUBCASE("Results match setting the transforms one by one") {
+		rs->canvas_item_set_transforms(batched, transforms);
+		for (int i = 0; i < single.size(); i++) {
+			rs->canvas_item_set_transform(single[i], transforms[i]);
+		}
+		for (int i = 0; i < batched.size(); i++) {
+			CHECK(_get_canvas_item_transform(batched[i]) == _get_canvas_item_transform(single[i]));
+			CHECK(_get_canvas_item_transform(batched[i]) == transforms[i]);
+		}
+	}
+
+	SUBCASE("Bound method takes typed arrays") {
+		TypedArray<RID> items;
+		TypedArray<Transform2D> xforms;
+		for (int i = 0; i < batched.size(); i++) {
+			items.push_back(batched[i]);
+			xforms.push_back(transforms[i]);
+		}
+		rs->call(SNAME("canvas_item_set_transforms"), items, xforms);
+		for (int i = 0; i < batched.size(); i++) {
+			CHECK(_get_canvas_item_transform(batched[i]) == transforms[i]);
+		}
+	}
+
+	SUBCASE("Mismatched array sizes are rejected") {
+		Vector<Transform2D> too_few = transforms;
+		too_few.resize(transforms.size() - 1);
+		TypedArray<RID> items;
+		TypedArray<Transform2D> xforms;
+		for (int i = 0; i < batched.size(); i++) {
+			items.push_back(batched[i]);
+			if (i > 0) {
+				xforms.push_back(transforms[i]);
+			}
+		}
+
+		ERR_PRINT_OFF;
+		rs->canvas_item_set_transforms(batched, too_few);
+		rs->call(SNAME("canvas_item_set_transforms"), items, xforms);
+		ERR_PRINT_ON;
+
+		for (int i = 0; i < batched.size(); i++) {
+			CHECK(_get_canvas_item_transform(batched[i]) == Transform2D());
+		}
+	}
+
+	SUBCASE("Invalid RIDs are skipped") {
+		RID freed = rs->canvas_item_create();
+		rs->free_rid(freed);
+		Vector<RID> items = batched;
+		items.write[1] = RID();
+		items.write[2] = freed;
+		// Not a canvas item.
+		items.write[3] = canvas;
+
+		ERR_PRINT_OFF;
+		rs->canvas_item_set_transforms(items, transforms);
+		ERR_PRINT_ON;
+
+		for (int i = 0; i < batched.size(); i++) {
+			CHECK(_get_canvas_item_transform(batched[i]) == (i >= 1 && i <= 3 ? Transform2D() : transforms[i]));
+		}
+	}
+
+	for (int i = 0; i < batched.size(); i++) {
+		rs->free_rid(batched[i]);
+		rs->free_rid(single[i]);
+	}
+	rs->free_rid(canvas);
+}
+
+} // namespace TestRenderingServer
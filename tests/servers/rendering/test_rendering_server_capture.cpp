@@ -0,0 +1,139 @@
+/**************************************************************************/
+/*  test_rendering_server_capture.cpp                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_rendering_server_capture)
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/io/image.h"
+#include "servers/rendering/rendering_server.h"
+#include "servers/rendering/rendering_server_capture.h"
+#include "tests/test_utils.h"
+
+namespace TestRenderingServerCapture {
+
+TEST_CASE("[SceneTree][RenderingServerCapture] Recorded calls are replayed") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	const String path = TestUtils::get_temp_path("rendering_capture.rscap");
+	const AABB aabb(Vector3(-1, -1, -1), Vector3(2, 2, 2));
+
+	// Created before the capture, so calls using it cannot be resolved on replay.
+	RID existing = rs->mesh_create();
+
+	RenderingServerCapture capture;
+	REQUIRE(capture.start(path) == OK);
+	CHECK(RenderingServerCapture::is_recording());
+	RID mesh = rs->mesh_create();
+	rs->mesh_set_custom_aabb(mesh, aabb);
+	rs->mesh_set_custom_aabb(existing, aabb);
+	RID instance = rs->instance_create();
+	rs->instance_set_base(instance, mesh);
+	rs->free_rid(instance);
+	capture.stop();
+	CHECK_FALSE(RenderingServerCapture::is_recording());
+
+	rs->free_rid(mesh);
+	rs->free_rid(existing);
+	rs->sync();
+
+	RenderingServerCapture::ReplayStats stats;
+	CHECK(RenderingServerCapture::replay(path, &stats) == OK);
+	CHECK_MESSAGE(stats.calls == 5, "Both creations, the calls on their RIDs and free_rid() should be replayed.");
+	CHECK_MESSAGE(stats.skipped == 1, "The call on the RID created before the capture should be skipped.");
+	CHECK(stats.frames == 0);
+	CHECK(stats.unresolved == 0);
+
+	DirAccess::remove_file_or_error(path);
+}
+
+TEST_CASE("[SceneTree][RenderingServerCapture] Images and wrapped signatures are replayed") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	const String path = TestUtils::get_temp_path("rendering_capture_wrapped.rscap");
+	Ref<Image> image = Image::create_empty(4, 4, false, Image::FORMAT_RGBA8);
+	image->fill(Color(1, 0, 0));
+
+	RenderingServerCapture capture;
+	REQUIRE(capture.start(path) == OK);
+	RID texture = rs->texture_2d_create(image);
+	RID scenario = rs->scenario_create();
+	RID instance = rs->instance_create();
+	rs->instance_set_scenario(instance, scenario);
+	RID canvas_item = rs->canvas_item_create();
+	// Bound through _instance_set_transforms() and _canvas_item_set_transforms(), which take typed arrays.
+	rs->instance_set_transforms({ instance }, { Transform3D(Basis(), Vector3(1, 2, 3)) });
+	rs->canvas_item_set_transforms({ canvas_item }, { Transform2D(0.5, Vector2(4, 5)) });
+	// Not bound, so it is not written.
+	RID mesh = rs->mesh_create();
+	rs->mesh_set_path(mesh, "res://mesh.tres");
+	rs->free_rid(mesh);
+	rs->free_rid(canvas_item);
+	rs->free_rid(instance);
+	rs->free_rid(scenario);
+	rs->free_rid(texture);
+	capture.stop();
+	rs->sync();
+
+	RenderingServerCapture::ReplayStats stats;
+	CHECK(RenderingServerCapture::replay(path, &stats) == OK);
+	CHECK_MESSAGE(stats.calls == 13, "Every call except mesh_set_path() should be replayed.");
+	CHECK(stats.skipped == 0);
+	CHECK(stats.unresolved == 0);
+
+	DirAccess::remove_file_or_error(path);
+}
+
+TEST_CASE("[SceneTree][RenderingServerCapture] Calls without a bound method fail the replay") {
+	const String path = TestUtils::get_temp_path("rendering_capture_unbound.rscap");
+	{
+		// Header, then a call with no arguments to a method RenderingServer does not bind.
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		const uint8_t magic[4] = { 'G', 'D', 'R', 'C' };
+		f->store_buffer(magic, 4);
+		f->store_32(2);
+		f->store_8(0);
+		f->store_32(0);
+		f->store_pascal_string("no_such_method");
+		f->store_8(0);
+	}
+
+	RenderingServerCapture::ReplayStats stats;
+	ERR_PRINT_OFF;
+	CHECK(RenderingServerCapture::replay(path, &stats) == ERR_METHOD_NOT_FOUND);
+	ERR_PRINT_ON;
+	CHECK(stats.calls == 0);
+	CHECK(stats.unresolved == 1);
+
+	DirAccess::remove_file_or_error(path);
+}
+
+} // namespace TestRenderingServerCapture
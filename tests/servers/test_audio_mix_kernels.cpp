@@ -0,0 +1,201 @@
+/**************************************************************************/
+/*  test_audio_mix_kernels.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_audio_mix_kernels)
+
+#include "core/math/math_funcs.h"
+#include "core/math/random_number_generator.h"
+#include "core/os/os.h"
+#include "servers/audio/audio_mix_kernels.h"
+
+namespace TestAudioMixKernels {
+
+static const char *backend_names[AudioMixKernels::BACKEND_MAX] = { "Scalar", "SSE2", "AVX2", "NEON" };
+
+static Vector<AudioFrame> _random_frames(int p_count, uint64_t p_seed) {
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(p_seed);
+	Vector<AudioFrame> frames;
+	frames.resize(p_count);
+	for (AudioFrame &frame : frames) {
+		frame = AudioFrame(rng->randf_range(-1, 1), rng->randf_range(-1, 1));
+	}
+	return frames;
+}
+
+static void _prepare_filter(AudioFilterSW &r_filter, AudioFilterSW::Mode p_mode) {
+	r_filter.set_mode(p_mode);
+	r_filter.set_sampling_rate(44100);
+	r_filter.set_cutoff(2500);
+	r_filter.set_resonance(1);
+	r_filter.set_stages(1);
+	r_filter.set_gain(0.5);
+}
+
+static bool _frames_match(const Vector<AudioFrame> &p_expected, const Vector<AudioFrame> &p_actual) {
+	if (p_expected.size() != p_actual.size()) {
+		return false;
+	}
+	for (int i = 0; i < p_expected.size(); i++) {
+		// Compilers may fuse multiply-adds differently in the scalar path, so don't require bit-exact results.
+		if (!Math::is_equal_approx(p_expected[i].left, p_actual[i].left, 1e-5f) || !Math::is_equal_approx(p_expected[i].right, p_actual[i].right, 1e-5f)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Runs `p_kernel` with the scalar backend and with `p_backend` on the same input and checks that the outputs match.
+template <typename F>
+static void _check_against_scalar(AudioMixKernels::Backend p_backend, F p_kernel) {
+	Vector<AudioFrame> expected = _random_frames(509, 1);
+	Vector<AudioFrame> actual = expected;
+
+	AudioMixKernels::set_backend(AudioMixKernels::BACKEND_SCALAR);
+	p_kernel(expected.ptrw(), expected.size());
+	AudioMixKernels::set_backend(p_backend);
+	p_kernel(actual.ptrw(), actual.size());
+
+	CHECK_MESSAGE(_frames_match(expected, actual), backend_names[p_backend]);
+}
+
+TEST_CASE("[AudioMixKernels] Vectorized kernels match the scalar kernels") {
+	const AudioMixKernels::Backend previous_backend = AudioMixKernels::get_backend();
+	const Vector<AudioFrame> source = _random_frames(509, 2);
+
+	for (int i = AudioMixKernels::BACKEND_SCALAR + 1; i < AudioMixKernels::BACKEND_MAX; i++) {
+		const AudioMixKernels::Backend backend = AudioMixKernels::Backend(i);
+		if (!AudioMixKernels::is_backend_supported(backend)) {
+			continue;
+		}
+
+		_check_against_scalar(backend, [&](AudioFrame *p_out, int p_count) {
+			AudioMixKernels::mix_ramp(p_out, source.ptr(), AudioFrame(0.2, 0.7), AudioFrame(0.9, 0.1), p_count);
+		});
+
+		_check_against_scalar(backend, [&](AudioFrame *p_out, int p_count) {
+			AudioMixKernels::accumulate(p_out, source.ptr(), p_count);
+		});
+
+		// Filtered volume ramp, over several blocks.
+		{
+			AudioFilterSW filter;
+			_prepare_filter(filter, AudioFilterSW::HIGHSHELF);
+			_check_against_scalar(backend, [&](AudioFrame *p_out, int p_count) {
+				AudioFilterSW::Processor processor_l;
+				AudioFilterSW::Processor processor_r;
+				processor_l.set_filter(&filter);
+				processor_r.set_filter(&filter);
+				for (int block = 0; block < 4; block++) {
+					filter.set_gain(0.2 + 0.2 * block);
+					processor_l.update_coeffs(p_count);
+					processor_r.update_coeffs(p_count);
+					AudioMixKernels::mix_ramp_filtered(p_out, source.ptr(), AudioFrame(0.5, 0.5), AudioFrame(0.25, 0.75), p_count, &processor_l, &processor_r);
+				}
+			});
+		}
+
+		// Stereo filter.
+		{
+			AudioFilterSW filter;
+			_prepare_filter(filter, AudioFilterSW::LOWPASS);
+			_check_against_scalar(backend, [&](AudioFrame *p_out, int p_count) {
+				AudioFilterSW::Processor processor_l;
+				AudioFilterSW::Processor processor_r;
+				processor_l.set_filter(&filter);
+				processor_r.set_filter(&filter);
+				processor_l.update_coeffs();
+				processor_r.update_coeffs();
+				AudioMixKernels::filter_stereo(p_out, p_count, &processor_l, &processor_r);
+				filter.set_cutoff(500);
+				processor_l.update_coeffs(p_count);
+				processor_r.update_coeffs(p_count);
+				AudioMixKernels::filter_stereo(p_out, p_count, &processor_l, &processor_r, true);
+				filter.set_cutoff(2500);
+			});
+		}
+	}
+
+	AudioMixKernels::set_backend(previous_backend);
+}
+
+TEST_CASE("[AudioMixKernels] Backend selection") {
+	CHECK(AudioMixKernels::is_backend_supported(AudioMixKernels::BACKEND_SCALAR));
+	CHECK(AudioMixKernels::is_backend_supported(AudioMixKernels::get_best_backend()));
+	CHECK_FALSE(AudioMixKernels::is_backend_supported(AudioMixKernels::BACKEND_MAX));
+}
+
+TEST_CASE_BENCHMARK("[AudioMixKernels][Benchmark] Mixing throughput per backend") {
+	const AudioMixKernels::Backend previous_backend = AudioMixKernels::get_backend();
+	const int frames = 512;
+	const int iterations = 20000;
+	const Vector<AudioFrame> source = _random_frames(frames, 3);
+	Vector<AudioFrame> out = _random_frames(frames, 4);
+	AudioFilterSW filter;
+	_prepare_filter(filter, AudioFilterSW::HIGHSHELF);
+
+	for (int i = 0; i < AudioMixKernels::BACKEND_MAX; i++) {
+		const AudioMixKernels::Backend backend = AudioMixKernels::Backend(i);
+		if (!AudioMixKernels::is_backend_supported(backend)) {
+			continue;
+		}
+		AudioMixKernels::set_backend(backend);
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int j = 0; j < iterations; j++) {
+			AudioMixKernels::mix_ramp(out.ptrw(), source.ptr(), AudioFrame(0.1, 0.1), AudioFrame(0.2, 0.2), frames);
+		}
+		uint64_t ramp_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		AudioFilterSW::Processor processor_l;
+		AudioFilterSW::Processor processor_r;
+		processor_l.set_filter(&filter);
+		processor_r.set_filter(&filter);
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int j = 0; j < iterations; j++) {
+			processor_l.update_coeffs(frames);
+			processor_r.update_coeffs(frames);
+			AudioMixKernels::mix_ramp_filtered(out.ptrw(), source.ptr(), AudioFrame(0.1, 0.1), AudioFrame(0.2, 0.2), frames, &processor_l, &processor_r);
+		}
+		uint64_t filtered_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		String result = vformat("%s: volume ramp %.1f Mframes/s, filtered volume ramp %.1f Mframes/s.",
+				backend_names[i], double(frames) * iterations / MAX(ramp_usec, uint64_t(1)), double(frames) * iterations / MAX(filtered_usec, uint64_t(1)));
+		MESSAGE(result.utf8().get_data());
+	}
+
+	AudioMixKernels::set_backend(previous_backend);
+	CHECK(out.size() == frames);
+}
+
+} // namespace TestAudioMixKernels
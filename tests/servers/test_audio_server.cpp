@@ -0,0 +1,214 @@
+/**************************************************************************/
+/*  test_audio_server.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_audio_server)
+
+#include "core/math/math_funcs.h"
+#include "core/os/os.h"
+#include "scene/resources/audio_stream_wav.h"
+#include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_server.h"
+#include "servers/audio/effects/audio_effect_compressor.h"
+#include "servers/audio/effects/audio_effect_reverb.h"
+
+namespace TestAudioServer {
+
+// Mixing is driven manually from the test thread, so the dummy driver must not run its own thread.
+static void _use_manual_driver(bool p_manual) {
+	AudioDriverDummy *driver = AudioDriverDummy::get_dummy_singleton();
+	driver->finish();
+	driver->set_use_threads(!p_manual);
+	driver->init();
+	driver->start();
+}
+
+static Ref<AudioStreamWAV> _make_looping_sine(float p_frequency) {
+	const int mix_rate = 44100;
+	Vector<uint8_t> data;
+	data.resize(mix_rate * 2);
+	int16_t *samples = reinterpret_cast<int16_t *>(data.ptrw());
+	for (int i = 0; i < mix_rate; i++) {
+		samples[i] = int16_t(Math::sin(Math::TAU * p_frequency * i / mix_rate) * INT16_MAX * 0.5);
+	}
+
+	Ref<AudioStreamWAV> stream;
+	stream.instantiate();
+	stream->set_format(AudioStreamWAV::FORMAT_16_BITS);
+	stream->set_mix_rate(mix_rate);
+	stream->set_data(data);
+	stream->set_loop_mode(AudioStreamWAV::LOOP_FORWARD);
+	stream->set_loop_end(mix_rate);
+	return stream;
+}
+
+// Sets up a small bus tree (two leaves sending into a group bus, plus a bus sending straight to master),
+// plays `p_playback_count` streams spread over the buses and returns `p_blocks` mixed blocks of output.
+// With `p_sidechain`, the compressors listen to a bus mixed before them and to one mixed after them.
+static Vector<int32_t> _mix_scene(int p_thread_count, int p_playback_count, int p_blocks, uint64_t *r_usec = nullptr, bool p_sidechain = false) {
+	AudioServer *audio_server = AudioServer::get_singleton();
+	audio_server->set_mix_thread_count(p_thread_count);
+
+	const char *bus_names[] = { "Master", "Group", "LeafA", "LeafB", "Direct" };
+	audio_server->set_bus_count(5);
+	for (int i = 1; i < 5; i++) {
+		audio_server->set_bus_name(i, bus_names[i]);
+	}
+	audio_server->set_bus_send(2, "Group");
+	audio_server->set_bus_send(3, "Group");
+	audio_server->set_bus_send(4, "Master");
+	audio_server->set_bus_send(1, "Master");
+
+	Ref<AudioEffectReverb> reverb;
+	reverb.instantiate();
+	audio_server->add_bus_effect(2, reverb);
+	Ref<AudioEffectCompressor> compressor;
+	compressor.instantiate();
+	audio_server->add_bus_effect(1, compressor);
+	if (p_sidechain) {
+		compressor->set_sidechain("Direct");
+		compressor.instantiate();
+		compressor->set_sidechain("LeafA");
+	}
+	audio_server->add_bus_effect(4, compressor);
+
+	Vector<AudioFrame> volume;
+	volume.resize(4);
+	volume.fill(AudioFrame(0.1, 0.1));
+
+	LocalVector<Ref<AudioStreamPlayback>> playbacks;
+	for (int i = 0; i < p_playback_count; i++) {
+		Ref<AudioStreamWAV> stream = _make_looping_sine(220.0 + 20.0 * (i % 16));
+		Ref<AudioStreamPlayback> playback = stream->instantiate_playback();
+		audio_server->start_playback_stream(playback, bus_names[1 + (i % 4)], volume);
+		playbacks.push_back(playback);
+	}
+
+	const int frames = 512;
+	const int channels = AudioDriverDummy::get_dummy_singleton()->get_channels();
+	Vector<int32_t> output;
+	output.resize(frames * channels * p_blocks);
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < p_blocks; i++) {
+		AudioDriverDummy::get_dummy_singleton()->mix_audio(frames, output.ptrw() + i * frames * channels);
+	}
+	if (r_usec) {
+		*r_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	}
+
+	for (const Ref<AudioStreamPlayback> &playback : playbacks) {
+		audio_server->stop_playback_stream(playback);
+	}
+	// Let the fade-outs finish and the stopped playbacks get freed.
+	Vector<int32_t> tail;
+	tail.resize(frames * channels);
+	AudioDriverDummy::get_dummy_singleton()->mix_audio(frames, tail.ptrw());
+	audio_server->update();
+	audio_server->set_bus_count(1);
+
+	return output;
+}
+
+TEST_CASE("[Audio][AudioServer] Threaded mixing matches serial mixing") {
+	_use_manual_driver(true);
+
+	Vector<int32_t> serial = _mix_scene(0, 24, 8);
+	Vector<int32_t> threaded = _mix_scene(3, 24, 8);
+
+	CHECK(serial.size() == threaded.size());
+	bool has_audio = false;
+	bool identical = true;
+	for (int i = 0; i < serial.size(); i++) {
+		has_audio = has_audio || serial[i] != 0;
+		identical = identical && serial[i] == threaded[i];
+	}
+	CHECK_MESSAGE(has_audio, "The test scene should produce audible output.");
+	CHECK_MESSAGE(identical, "Threaded mixing should produce the exact same samples as serial mixing.");
+
+	_use_manual_driver(false);
+}
+
+TEST_CASE("[Audio][AudioServer] Threaded mixing with sidechains matches serial mixing") {
+	_use_manual_driver(true);
+
+	Vector<int32_t> serial = _mix_scene(0, 24, 8, nullptr, true);
+	Vector<int32_t> threaded = _mix_scene(3, 24, 8, nullptr, true);
+
+	CHECK(serial.size() == threaded.size());
+	bool identical = true;
+	for (int i = 0; i < serial.size(); i++) {
+		identical = identical && serial[i] == threaded[i];
+	}
+	CHECK_MESSAGE(identical, "Sidechained compressors should read the same buffers as with serial mixing.");
+
+	_use_manual_driver(false);
+}
+
+#ifdef THREADS_ENABLED
+TEST_CASE("[Audio][AudioServer] Changing the mix thread count") {
+	_use_manual_driver(true);
+	AudioServer *audio_server = AudioServer::get_singleton();
+
+	audio_server->set_mix_thread_count(2);
+	CHECK(audio_server->get_mix_thread_count() == 2);
+	audio_server->set_mix_thread_count(0);
+	CHECK(audio_server->get_mix_thread_count() == 0);
+
+	ERR_PRINT_OFF;
+	audio_server->set_mix_thread_count(-1);
+	ERR_PRINT_ON;
+	CHECK(audio_server->get_mix_thread_count() == 0);
+
+	_use_manual_driver(false);
+}
+#endif // THREADS_ENABLED
+
+TEST_CASE_BENCHMARK("[Audio][AudioServer][Benchmark] Mixing many playbacks over several buses") {
+	_use_manual_driver(true);
+
+	const int playback_count = 256;
+	const int blocks = 200;
+	const int thread_count = CLAMP(OS::get_singleton()->get_processor_count() - 1, 1, 8);
+
+	uint64_t serial_usec = 0;
+	uint64_t threaded_usec = 0;
+	_mix_scene(0, playback_count, blocks, &serial_usec);
+	_mix_scene(thread_count, playback_count, blocks, &threaded_usec);
+
+	String result = vformat("%d playbacks, %d blocks of 512 frames: serial %.3f ms/block, %d helper threads %.3f ms/block.",
+			playback_count, blocks, serial_usec / 1000.0 / blocks, thread_count, threaded_usec / 1000.0 / blocks);
+	MESSAGE(result.utf8().get_data());
+	CHECK(threaded_usec > 0);
+
+	_use_manual_driver(false);
+}
+
+} // namespace TestAudioServer